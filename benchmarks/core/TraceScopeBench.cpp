@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include <trace.h>
+
+using namespace lute::core::trace;
+
+namespace {
+
+constexpr TraceSite SITE{ "bench", "scope" };
+
+void BM_Baseline(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+    }
+}
+
+void BM_Ticks(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ticks());
+    }
+}
+
+/**
+ * Cost of one trace event: two TSC reads plus the store into the thread's ring. Subtract BM_Baseline.
+ */
+void BM_TraceScope(benchmark::State& state) {
+    attach_current_thread();
+    for (auto _ : state) {
+        const TraceScope scope(SITE);
+        benchmark::ClobberMemory();
+    }
+}
+
+/**
+ * Same event through the macro; matches BM_Baseline unless built with ENABLE_TRACING
+ */
+void BM_TraceMacro(benchmark::State& state) {
+    attach_current_thread();
+    for (auto _ : state) {
+        CORE_TRACE_SCOPE("bench", "macro");
+        benchmark::ClobberMemory();
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_Baseline);
+BENCHMARK(BM_Ticks);
+BENCHMARK(BM_TraceScope);
+BENCHMARK(BM_TraceMacro);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,165 @@
+#include <benchmark/benchmark.h>
+#include <transport/tcp_transport.h>
+#include <support/CpuPlacement.h>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace lute::runtime::transport;
+using lute::bench::CpuPlacement;
+using lute::bench::ScopedPin;
+
+namespace {
+
+/**
+ * Messages of \c range(0) bytes from a producer thread to this one over a loopback edge. The producer only
+ * copies into the edge's ring; the I/O threads coalesce whatever queued up into one write. Each iteration
+ * receives one whole message; \c bytes_per_write is the batching the sender side achieved.
+ */
+void BM_TransportLoopback(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const CpuPlacement cpus = CpuPlacement::preferred();
+
+    TransportOptions options;
+    options.io_threads = 2;
+    TcpTransport transport(options);
+    const std::uint16_t port = transport.listen("127.0.0.1", 0);
+
+    std::unique_ptr<OutboundEdge> out = transport.connect("127.0.0.1", port, 1);
+    std::unique_ptr<InboundEdge> in = transport.accept(1, std::chrono::seconds(5));
+    if (!in) {
+        state.SkipWithError("edge did not arrive");
+        return;
+    }
+
+    std::atomic<bool> stop{false};
+    std::thread producer([&]() {
+        ScopedPin pin(cpus.producer);
+        const std::vector<std::byte> message(size, std::byte{0x5a});
+
+        while (!stop.load(std::memory_order_relaxed)) {
+            std::size_t sent = 0;
+            while (sent < size && !stop.load(std::memory_order_relaxed)) {
+                const std::size_t n = out->send(message.data() + sent, size - sent);
+                if (n == 0) cpus.relax();
+                sent += n;
+            }
+        }
+    });
+
+    ScopedPin pin(cpus.consumer);
+    std::vector<std::byte> buffer(size);
+
+    for (auto _ : state) {
+        std::size_t received = 0;
+        while (received < size) {
+            const std::size_t n = in->receive(buffer.data() + received, size - received);
+            if (n == 0) cpus.relax();
+            received += n;
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    stop.store(true);
+    producer.join();
+
+    const TransportStats stats = transport.stats();
+    state.counters["bytes_per_write"] = stats.writes == 0 ? 0.0
+        : static_cast<double>(stats.bytes_sent) / static_cast<double>(stats.writes);
+    state.counters["wakeups"] = static_cast<double>(stats.wakeups);
+
+    state.SetLabel(cpus.label());
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(size));
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Baseline: the same stream over a plain loopback TCP socket with one blocking send per message
+ */
+void BM_SocketPerMessage(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const CpuPlacement cpus = CpuPlacement::preferred();
+
+    const int listener = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+
+    if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+        || ::listen(listener, 1) != 0
+        || ::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        ::close(listener);
+        state.SkipWithError("loopback listener failed");
+        return;
+    }
+
+    const int sender = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (::connect(sender, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        ::close(sender);
+        ::close(listener);
+        state.SkipWithError("loopback connect failed");
+        return;
+    }
+    const int receiver = ::accept(listener, nullptr, nullptr);
+    ::close(listener);
+
+    const int on = 1;
+    ::setsockopt(sender, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+    std::atomic<bool> stop{false};
+    std::thread producer([&]() {
+        ScopedPin pin(cpus.producer);
+        const std::vector<std::byte> message(size, std::byte{0x5a});
+
+        while (!stop.load(std::memory_order_relaxed)) {
+            std::size_t sent = 0;
+            while (sent < size) {
+                const ssize_t n = ::send(sender, message.data() + sent, size - sent, MSG_NOSIGNAL);
+                if (n <= 0) return;
+                sent += static_cast<std::size_t>(n);
+            }
+        }
+    });
+
+    ScopedPin pin(cpus.consumer);
+    std::vector<std::byte> buffer(size);
+
+    for (auto _ : state) {
+        std::size_t received = 0;
+        while (received < size) {
+            const ssize_t n = ::read(receiver, buffer.data() + received, size - received);
+            if (n <= 0) {
+                state.SkipWithError("producer went away");
+                break;
+            }
+            received += static_cast<std::size_t>(n);
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    stop.store(true);
+    ::shutdown(sender, SHUT_RDWR);        // unblocks a producer stuck in send
+    producer.join();
+    ::close(sender);
+    ::close(receiver);
+
+    state.SetLabel(cpus.label());
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(size));
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_TransportLoopback)->Name("Loopback/Transport")->Arg(64)->Arg(1024)->Arg(16384)->UseRealTime();
+BENCHMARK(BM_SocketPerMessage)->Name("Loopback/SocketPerMessage")->Arg(64)->Arg(1024)->Arg(16384)->UseRealTime();
+
+BENCHMARK_MAIN();
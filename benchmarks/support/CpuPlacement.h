@@ -0,0 +1,103 @@
+#pragma once
+
+#include <exec/backoff.h>
+#include <exec/cpu_affinity.h>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lute::bench {
+
+/**
+ * @struct CpuPlacement
+ * @brief Where the two sides of a producer/consumer benchmark run
+ *
+ * CPUs come from \c LUTE_BENCH_CPUS ("consumer,producer") when set, otherwise from the first two CPUs of the
+ * process affinity mask, so a run under \c taskset picks its own cores. When both sides share a CPU, waiting
+ * loops yield instead of spinning: a spinning waiter would otherwise burn its whole time slice before the
+ * other side can run.
+ */
+struct CpuPlacement {
+    int consumer = -1;
+    int producer = -1;
+
+    bool shared() const noexcept { return consumer == producer; }
+
+    /**
+     * @brief Consumer and producer on different CPUs; \c valid is false if only one CPU is available
+     */
+    static CpuPlacement cross_core(bool& valid) {
+        const std::vector<int> cpus = available();
+        valid = cpus.size() >= 2;
+        return valid ? CpuPlacement{cpus[0], cpus[1]} : CpuPlacement{cpus[0], cpus[0]};
+    }
+
+    static CpuPlacement same_core() {
+        const int cpu = available().front();
+        return {cpu, cpu};
+    }
+
+    /**
+     * @brief Cross-core if possible, otherwise both sides on the one CPU there is
+     */
+    static CpuPlacement preferred() {
+        bool valid = false;
+        return cross_core(valid);
+    }
+
+    std::string label() const {
+        return shared() ? "cpu=" + std::to_string(consumer)
+                        : "cpus=" + std::to_string(consumer) + "," + std::to_string(producer);
+    }
+
+    /**
+     * @brief Waits one round for the other side
+     */
+    void relax() const noexcept {
+        if (shared()) {
+            std::this_thread::yield();
+        } else {
+            runtime::exec::cpu_relax();
+        }
+    }
+
+private:
+    static std::vector<int> available() {
+        if (const char* env = std::getenv("LUTE_BENCH_CPUS")) {
+            std::vector<int> cpus;
+            std::istringstream in(env);
+            for (std::string item; std::getline(in, item, ',');) cpus.push_back(std::stoi(item));
+            if (!cpus.empty()) return cpus;
+        }
+        return runtime::exec::current_thread_affinity();
+    }
+};
+
+/**
+ * @class ScopedPin
+ * @brief Pins the calling thread to one CPU and restores its previous affinity on destruction, so one
+ * benchmark's placement does not leak into the next
+ */
+class ScopedPin {
+public:
+    explicit ScopedPin(const int cpu)
+        : previous_(runtime::exec::current_thread_affinity())
+    {
+        runtime::exec::pin_current_thread({cpu});
+    }
+
+    ScopedPin(const ScopedPin&) = delete;
+    ScopedPin& operator=(const ScopedPin&) = delete;
+
+    ~ScopedPin() {
+        runtime::exec::pin_current_thread(previous_);
+    }
+
+private:
+    std::vector<int> previous_;
+};
+
+} // namespace lute::bench
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace lute::bench {
+
+/**
+ * @class LatencySamples
+ * @brief Collects per-operation latencies during a benchmark run and reports percentiles as counters
+ *
+ * Storage is reserved up front so recording a sample never allocates inside the timed loop.
+ */
+class LatencySamples {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit LatencySamples(const std::size_t expected) {
+        samples_.reserve(expected);
+    }
+
+    void record(const Clock::time_point start, const Clock::time_point end) {
+        samples_.push_back(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+
+    void record(const std::uint64_t nanos) {
+        samples_.push_back(nanos);
+    }
+
+    /**
+     * @brief Publishes p50/p99/p999/max (in ns) into \p state's counters
+     */
+    void report(benchmark::State& state) {
+        if (samples_.empty()) return;
+
+        std::sort(samples_.begin(), samples_.end());
+        state.counters["p50_ns"] = static_cast<double>(percentile(0.50));
+        state.counters["p99_ns"] = static_cast<double>(percentile(0.99));
+        state.counters["p999_ns"] = static_cast<double>(percentile(0.999));
+        state.counters["max_ns"] = static_cast<double>(samples_.back());
+    }
+
+private:
+    std::uint64_t percentile(const double q) const {
+        const auto rank = static_cast<std::size_t>(q * static_cast<double>(samples_.size() - 1));
+        return samples_[rank];
+    }
+
+    std::vector<std::uint64_t> samples_;
+};
+
+} // namespace lute::bench
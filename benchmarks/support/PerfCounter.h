@@ -0,0 +1,65 @@
+#pragma once
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace lute::bench {
+
+/**
+ * @class PerfCounter
+ * @brief Per-thread hardware event counter backed by perf_event_open
+ *
+ * Counts events of the thread that constructed it. When the kernel refuses the event (containers,
+ * perf_event_paranoid, virtual machines without a PMU) the counter stays invalid and reads 0, so
+ * benchmarks still run and simply report no cache data.
+ */
+class PerfCounter {
+public:
+    explicit PerfCounter(const std::uint32_t type = PERF_TYPE_HARDWARE,
+                         const std::uint64_t config = PERF_COUNT_HW_CACHE_MISSES) noexcept {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        fd_ = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+
+    ~PerfCounter() {
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    bool valid() const noexcept { return fd_ >= 0; }
+
+    void start() noexcept {
+        if (fd_ < 0) return;
+        ::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+        ::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    std::uint64_t stop() noexcept {
+        if (fd_ < 0) return 0;
+        ::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+
+        std::uint64_t value = 0;
+        if (::read(fd_, &value, sizeof(value)) != sizeof(value)) return 0;
+        return value;
+    }
+
+private:
+    int fd_;
+};
+
+} // namespace lute::bench
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include <channels/CachedInMemoryChannel.h>
+#include <channels/InMemoryChannel.h>
+#include <support/PerfCounter.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using namespace lute::tm::channels;
+using lute::bench::PerfCounter;
+
+namespace {
+
+constexpr std::size_t CHANNEL_CAPACITY = 1 << 16;
+
+/**
+ * Streams fixed-size messages from a producer thread to the benchmark thread. Reports throughput and
+ * the hardware cache misses of both sides, normalised per message.
+ */
+template<typename ChannelType>
+void BM_SpscStream(benchmark::State& state) {
+    const auto messageSize = static_cast<std::size_t>(state.range(0));
+
+    ChannelType channel(CHANNEL_CAPACITY);
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint64_t> producerMisses{0};
+
+    std::thread producer([&]() {
+        alignas(64) std::byte message[256]{};
+        PerfCounter misses;
+
+        misses.start();
+        while (!stop.load(std::memory_order_relaxed)) {
+            const WritableRegion region = channel.reserve(messageSize);
+            if (region.size() == messageSize) {
+                copy_into(region, message, messageSize);
+                channel.publish(messageSize);
+            }
+        }
+        producerMisses.store(misses.stop());
+    });
+
+    alignas(64) std::byte sink[256];
+    PerfCounter consumerMisses;
+
+    consumerMisses.start();
+    for (auto _ : state) {
+        ReadableRegion region;
+        while ((region = channel.peek(messageSize)).size() < messageSize) {}
+        copy_from(region, sink, messageSize);
+        channel.release(messageSize);
+        benchmark::DoNotOptimize(sink);
+    }
+    const std::uint64_t consumed = consumerMisses.stop();
+
+    stop.store(true);
+    producer.join();
+
+    const auto messages = static_cast<double>(state.iterations());
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(messageSize));
+    if (consumerMisses.valid()) {
+        state.counters["consumer_misses/msg"] = static_cast<double>(consumed) / messages;
+        state.counters["producer_misses/msg"] = static_cast<double>(producerMisses.load()) / messages;
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_SpscStream<InMemoryChannel>)->Name("SpscStream/Shared")
+    ->Arg(8)->Arg(64)->Arg(256)->UseRealTime();
+BENCHMARK(BM_SpscStream<CachedInMemoryChannel>)->Name("SpscStream/CachedIndex")
+    ->Arg(8)->Arg(64)->Arg(256)->UseRealTime();
+
+BENCHMARK_MAIN();
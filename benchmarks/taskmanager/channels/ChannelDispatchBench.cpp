@@ -0,0 +1,140 @@
+#include <benchmark/benchmark.h>
+#include <channels/CachedInMemoryChannel.h>
+#include <channels/ChannelAdapter.h>
+#include <channels/InMemoryChannel.h>
+#include <channels/MpscChannel.h>
+#include <channels/StaticInMemoryChannel.h>
+#include <support/PerfCounter.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <variant>
+
+using namespace lute::tm::channels;
+using lute::bench::PerfCounter;
+
+namespace {
+
+constexpr std::size_t CHANNEL_CAPACITY = 4096;
+constexpr std::size_t PATTERN_LENGTH = 4096;
+
+/**
+ * One instance of every channel type, plus their L3 adapters. Each "operator step" is a send followed by
+ * a receive of one 8-byte record on the same channel, so the work per call is tiny and dispatch dominates.
+ */
+struct ChannelSet {
+    InMemoryChannel spsc{CHANNEL_CAPACITY};
+    CachedInMemoryChannel cached{CHANNEL_CAPACITY};
+    std::unique_ptr<StaticInMemoryChannel<CHANNEL_CAPACITY>> fixed = std::make_unique<StaticInMemoryChannel<CHANNEL_CAPACITY>>();
+    MpscChannel mpsc{256, 8};
+
+    ChannelAdapter<InMemoryChannel> spscAdapter{spsc};
+    ChannelAdapter<CachedInMemoryChannel> cachedAdapter{cached};
+    ChannelAdapter<StaticInMemoryChannel<CHANNEL_CAPACITY>> fixedAdapter{*fixed};
+    ChannelAdapter<MpscChannel> mpscAdapter{mpsc};
+
+    std::array<IChannel*, 4> erased{ &spscAdapter, &cachedAdapter, &fixedAdapter, &mpscAdapter };
+
+    using Static = std::variant<InMemoryChannel*, CachedInMemoryChannel*,
+                                StaticInMemoryChannel<CHANNEL_CAPACITY>*, MpscChannel*>;
+    std::array<Static, 4> specialized{ &spsc, &cached, fixed.get(), &mpsc };
+};
+
+/**
+ * Channel selection sequence: either always the same channel (predictable) or uniformly random
+ * (the indirect/conditional branch target changes unpredictably)
+ */
+std::array<std::uint8_t, PATTERN_LENGTH> makePattern(const bool random) {
+    std::array<std::uint8_t, PATTERN_LENGTH> pattern{};
+    std::mt19937 rng(42);
+    for (auto& index : pattern) {
+        index = random ? static_cast<std::uint8_t>(rng() % 4) : 0;
+    }
+    return pattern;
+}
+
+template<typename C>
+inline std::uint64_t step(C& channel, std::uint64_t value) {
+    channel.send(&value, sizeof(value));
+    channel.receive(&value, sizeof(value));
+    return value;
+}
+
+void reportBranchMisses(benchmark::State& state, PerfCounter& misses) {
+    const std::uint64_t count = misses.stop();
+    if (misses.valid()) {
+        state.counters["branch_misses/op"] = static_cast<double>(count) /
+            static_cast<double>(state.iterations() * static_cast<std::int64_t>(PATTERN_LENGTH));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(PATTERN_LENGTH));
+}
+
+/**
+ * L4 tier: the operator is instantiated for the concrete channel type, so calls are direct.
+ */
+void BM_L4_Specialized(benchmark::State& state) {
+    ChannelSet set;
+    PerfCounter misses(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    std::uint64_t value = 0;
+
+    misses.start();
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < PATTERN_LENGTH; ++i) {
+            value = step(set.spsc, value + 1);
+        }
+    }
+    benchmark::DoNotOptimize(value);
+    reportBranchMisses(state, misses);
+}
+
+/**
+ * L4 tier over a heterogeneous edge set: the channel type is picked per step through a variant, i.e. a
+ * conditional branch instead of an indirect call.
+ */
+void BM_L4_VariantDispatch(benchmark::State& state) {
+    ChannelSet set;
+    const auto pattern = makePattern(state.range(0) != 0);
+    PerfCounter misses(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    std::uint64_t value = 0;
+
+    misses.start();
+    for (auto _ : state) {
+        for (const std::uint8_t index : pattern) {
+            value = std::visit([&](auto* channel) { return step(*channel, value + 1); }, set.specialized[index]);
+        }
+    }
+    benchmark::DoNotOptimize(value);
+    reportBranchMisses(state, misses);
+}
+
+/**
+ * L3 tier: every call goes through IChannel. With a fixed pattern the indirect branch is perfectly
+ * predicted; with a random pattern it mispredicts roughly 3 times in 4.
+ */
+void BM_L3_VirtualDispatch(benchmark::State& state) {
+    ChannelSet set;
+    const auto pattern = makePattern(state.range(0) != 0);
+    PerfCounter misses(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    std::uint64_t value = 0;
+
+    misses.start();
+    for (auto _ : state) {
+        for (const std::uint8_t index : pattern) {
+            IChannel* channel = set.erased[index];
+            benchmark::DoNotOptimize(channel);
+            value = step(*channel, value + 1);
+        }
+    }
+    benchmark::DoNotOptimize(value);
+    reportBranchMisses(state, misses);
+}
+
+} // namespace
+
+BENCHMARK(BM_L4_Specialized)->Name("Dispatch/L4/specialized");
+BENCHMARK(BM_L4_VariantDispatch)->Name("Dispatch/L4/variant")->ArgName("random")->Arg(0)->Arg(1);
+BENCHMARK(BM_L3_VirtualDispatch)->Name("Dispatch/L3/virtual")->ArgName("random")->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
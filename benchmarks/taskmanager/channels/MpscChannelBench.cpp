@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <channels/MpscChannel.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace lute::tm::channels;
+
+namespace {
+
+constexpr std::size_t SLOT_COUNT = 4096;
+constexpr std::size_t MESSAGE_SIZE = 64;
+
+/**
+ * Fan-in throughput: \c state.range(0) producer threads hammer one channel while the benchmark thread
+ * drains it. Reports consumed messages per second and the fraction of sends that found the channel full.
+ */
+void BM_MpscFanIn(benchmark::State& state) {
+    const auto producerCount = static_cast<std::size_t>(state.range(0));
+
+    MpscChannel channel(SLOT_COUNT, MESSAGE_SIZE);
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint64_t> rejected{0};
+    std::atomic<std::uint64_t> accepted{0};
+
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p < producerCount; ++p) {
+        producers.emplace_back([&]() {
+            std::byte message[MESSAGE_SIZE]{};
+            std::uint64_t ok = 0;
+            std::uint64_t full = 0;
+
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (channel.send(message, MESSAGE_SIZE) != 0) ++ok; else ++full;
+            }
+
+            accepted.fetch_add(ok);
+            rejected.fetch_add(full);
+        });
+    }
+
+    std::uint64_t checksum = 0;
+    for (auto _ : state) {
+        std::span<const std::byte> message;
+        while ((message = channel.peek()).empty()) {}
+
+        checksum += static_cast<std::uint64_t>(message[0]);
+        channel.release();
+    }
+
+    stop.store(true);
+    for (auto& t : producers) t.join();
+
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations());
+
+    const auto attempts = static_cast<double>(accepted.load() + rejected.load());
+    state.counters["full_ratio"] = attempts == 0 ? 0.0 : static_cast<double>(rejected.load()) / attempts;
+}
+
+} // namespace
+
+BENCHMARK(BM_MpscFanIn)->Name("MpscFanIn/producers")
+    ->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->Arg(32)->UseRealTime();
+
+BENCHMARK_MAIN();
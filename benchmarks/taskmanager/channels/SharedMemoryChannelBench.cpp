@@ -0,0 +1,160 @@
+#include <benchmark/benchmark.h>
+#include <channels/SharedMemoryChannel.h>
+#include <support/CpuPlacement.h>
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
+
+using namespace lute::tm::channels;
+using lute::bench::CpuPlacement;
+using lute::bench::ScopedPin;
+
+namespace {
+
+constexpr std::size_t RING_CAPACITY = 1 << 20;
+
+/**
+ * Stop flag shared with the forked producer through an anonymous shared page
+ */
+class SharedFlag {
+public:
+    SharedFlag()
+        : page_(::mmap(nullptr, 4096, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0)),
+          flag_(new (page_) std::atomic<bool>(false))
+    {}
+
+    ~SharedFlag() { ::munmap(page_, 4096); }
+
+    void set() noexcept { flag_->store(true, std::memory_order_relaxed); }
+    bool get() const noexcept { return flag_->load(std::memory_order_relaxed); }
+
+private:
+    void* page_;
+    std::atomic<bool>* flag_;
+};
+
+/**
+ * Forks a producer pinned to \p cpu that runs \p produce until the flag is set, then exits
+ */
+template<typename Produce>
+pid_t forkProducer(const int cpu, Produce produce) {
+    const pid_t child = ::fork();
+    if (child == 0) {
+        ScopedPin pin(cpu);
+        produce();
+        ::_exit(0);
+    }
+    return child;
+}
+
+/**
+ * Messages of \c range(0) bytes from a forked producer process to this one through a shared-memory ring.
+ * Each iteration receives one whole message, so the rate compares directly with the socket baseline.
+ */
+void BM_SharedMemoryStream(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const CpuPlacement cpus = CpuPlacement::preferred();
+
+    SharedMemoryChannel channel = SharedMemoryChannel::create_memfd(RING_CAPACITY);
+    SharedFlag stop;
+
+    const int fd = channel.fd();
+    const pid_t child = forkProducer(cpus.producer, [&]() {
+        SharedMemoryChannel producer = SharedMemoryChannel::attach(fd);
+        const std::vector<std::byte> message(size, std::byte{0x5a});
+
+        while (!stop.get()) {
+            if (producer.reserve(size).size() < size) {
+                cpus.relax();
+                continue;
+            }
+            producer.send(message.data(), size);
+        }
+    });
+
+    ScopedPin pin(cpus.consumer);
+    std::vector<std::byte> buffer(size);
+
+    for (auto _ : state) {
+        while (channel.peek(size).size() < size) cpus.relax();
+        channel.receive(buffer.data(), size);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    stop.set();
+    ::waitpid(child, nullptr, 0);
+
+    state.SetLabel(cpus.label());
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(size));
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Same stream over a Unix stream socketpair: one write per message on the producer, reads until the whole
+ * message has arrived on the consumer
+ */
+void BM_UnixSocketStream(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const CpuPlacement cpus = CpuPlacement::preferred();
+
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        state.SkipWithError("socketpair failed");
+        return;
+    }
+
+    SharedFlag stop;
+    const pid_t child = forkProducer(cpus.producer, [&]() {
+        ::close(fds[0]);
+        const std::vector<std::byte> message(size, std::byte{0x5a});
+
+        while (!stop.get()) {
+            std::size_t sent = 0;
+            while (sent < size) {
+                const ssize_t n = ::send(fds[1], message.data() + sent, size - sent, MSG_NOSIGNAL);
+                if (n <= 0) return;
+                sent += static_cast<std::size_t>(n);
+            }
+        }
+    });
+    ::close(fds[1]);
+
+    ScopedPin pin(cpus.consumer);
+    std::vector<std::byte> buffer(size);
+
+    for (auto _ : state) {
+        std::size_t received = 0;
+        while (received < size) {
+            const ssize_t n = ::read(fds[0], buffer.data() + received, size - received);
+            if (n <= 0) {
+                state.SkipWithError("producer went away");
+                break;
+            }
+            received += static_cast<std::size_t>(n);
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    stop.set();
+    ::close(fds[0]);        // unblocks a producer stuck in send
+    ::waitpid(child, nullptr, 0);
+
+    state.SetLabel(cpus.label());
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(size));
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_SharedMemoryStream)->Name("CrossProcess/SharedMemory")->Arg(64)->Arg(1024)->Arg(16384)->UseRealTime();
+BENCHMARK(BM_UnixSocketStream)->Name("CrossProcess/UnixSocket")->Arg(64)->Arg(1024)->Arg(16384)->UseRealTime();
+
+BENCHMARK_MAIN();
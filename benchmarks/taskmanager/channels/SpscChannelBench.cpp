@@ -0,0 +1,227 @@
+#include <benchmark/benchmark.h>
+#include <channels/CachedInMemoryChannel.h>
+#include <channels/InMemoryChannel.h>
+#include <channels/WaitableChannel.h>
+#include <exec/cpu_affinity.h>
+#include <support/CpuPlacement.h>
+#include <support/LatencySamples.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using namespace lute::tm::channels;
+using lute::bench::CpuPlacement;
+using lute::bench::LatencySamples;
+using lute::bench::ScopedPin;
+
+namespace {
+
+constexpr std::size_t MAX_MESSAGE = 1024;
+constexpr std::size_t PING_PONG_CAPACITY = 4096;
+
+/**
+ * Streams fixed-size messages from a pinned producer to the pinned benchmark thread.
+ * Arguments: message size, ring capacity.
+ */
+template<typename ChannelType>
+void BM_Throughput(benchmark::State& state) {
+    const auto messageSize = static_cast<std::size_t>(state.range(0));
+    const auto capacity = static_cast<std::size_t>(state.range(1));
+    const CpuPlacement cpus = CpuPlacement::preferred();
+
+    ChannelType channel(capacity);
+    std::atomic<bool> stop{false};
+
+    ScopedPin pin(cpus.consumer);
+    std::thread producer([&]() {
+        lute::runtime::exec::pin_current_thread({cpus.producer});
+
+        alignas(64) std::byte message[MAX_MESSAGE]{};
+        while (!stop.load(std::memory_order_relaxed)) {
+            const WritableRegion region = channel.reserve(messageSize);
+            if (region.size() < messageSize) {
+                cpus.relax();
+                continue;
+            }
+            copy_into(region, message, messageSize);
+            channel.publish(messageSize);
+        }
+    });
+
+    alignas(64) std::byte sink[MAX_MESSAGE];
+    for (auto _ : state) {
+        ReadableRegion region;
+        while ((region = channel.peek(messageSize)).size() < messageSize) cpus.relax();
+        copy_from(region, sink, messageSize);
+        channel.release(messageSize);
+        benchmark::DoNotOptimize(sink);
+    }
+
+    stop.store(true);
+    producer.join();
+
+    state.SetLabel(cpus.label());
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(messageSize));
+}
+
+/**
+ * Round trip of one 8-byte message through a pair of channels to an echo thread and back.
+ * Argument: 0 = both threads on one CPU, 1 = on two CPUs.
+ */
+template<typename ChannelType>
+void BM_PingPong(benchmark::State& state) {
+    bool valid = true;
+    const CpuPlacement cpus = state.range(0) == 0 ? CpuPlacement::same_core() : CpuPlacement::cross_core(valid);
+    if (!valid) {
+        state.SkipWithError("cross-core ping-pong needs two CPUs");
+        return;
+    }
+
+    ChannelType ping(PING_PONG_CAPACITY);
+    ChannelType pong(PING_PONG_CAPACITY);
+    std::atomic<bool> stop{false};
+
+    ScopedPin pin(cpus.consumer);
+    std::thread echo([&]() {
+        lute::runtime::exec::pin_current_thread({cpus.producer});
+
+        std::uint64_t value = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (ping.receive(&value, sizeof(value)) == 0) {
+                cpus.relax();
+                continue;
+            }
+            while (pong.send(&value, sizeof(value)) == 0) cpus.relax();
+        }
+    });
+
+    LatencySamples latencies(1 << 22);
+    std::uint64_t sequence = 0;
+    std::uint64_t reply = 0;
+
+    for (auto _ : state) {
+        const LatencySamples::Clock::time_point start = LatencySamples::Clock::now();
+        ping.send(&sequence, sizeof(sequence));
+        while (pong.receive(&reply, sizeof(reply)) == 0) cpus.relax();
+        latencies.record(start, LatencySamples::Clock::now());
+        ++sequence;
+    }
+
+    stop.store(true);
+    echo.join();
+
+    benchmark::DoNotOptimize(reply);
+    latencies.report(state);
+    state.SetLabel(cpus.label());
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Ping-pong through \ref WaitableChannel with both threads waiting instead of spinning: with a spin budget
+ * of 0 every round trip pays two futex wakes, with a large budget it converges to the spinning case.
+ * Arguments: 0 = one CPU / 1 = two CPUs, spin iterations before parking.
+ */
+void BM_PingPongWaitable(benchmark::State& state) {
+    bool valid = true;
+    const CpuPlacement cpus = state.range(0) == 0 ? CpuPlacement::same_core() : CpuPlacement::cross_core(valid);
+    if (!valid) {
+        state.SkipWithError("cross-core ping-pong needs two CPUs");
+        return;
+    }
+
+    const WaitPolicy policy{ .spinIterations = static_cast<std::uint32_t>(state.range(1)) };
+    InMemoryChannel pingRing(PING_PONG_CAPACITY);
+    InMemoryChannel pongRing(PING_PONG_CAPACITY);
+    WaitableChannel<InMemoryChannel> ping(pingRing, policy);
+    WaitableChannel<InMemoryChannel> pong(pongRing, policy);
+
+    ScopedPin pin(cpus.consumer);
+    std::thread echo([&]() {
+        lute::runtime::exec::pin_current_thread({cpus.producer});
+
+        std::uint64_t value = 0;
+        while (ping.receive_wait(&value, sizeof(value)) != 0) {
+            pong.send_wait(&value, sizeof(value));
+        }
+    });
+
+    LatencySamples latencies(1 << 22);
+    std::uint64_t sequence = 0;
+    std::uint64_t reply = 0;
+
+    for (auto _ : state) {
+        const LatencySamples::Clock::time_point start = LatencySamples::Clock::now();
+        ping.send_wait(&sequence, sizeof(sequence));
+        pong.receive_wait(&reply, sizeof(reply));
+        latencies.record(start, LatencySamples::Clock::now());
+        ++sequence;
+    }
+
+    ping.close();
+    echo.join();
+
+    const WaitStats stats = ping.stats();
+    const auto iterations = static_cast<double>(state.iterations());
+    benchmark::DoNotOptimize(reply);
+    latencies.report(state);
+    state.counters["parks/msg"] = static_cast<double>(stats.consumerParks + pong.stats().consumerParks) / iterations;
+    state.counters["wakes/msg"] = static_cast<double>(stats.wakes + pong.stats().wakes) / iterations;
+    state.SetLabel(cpus.label());
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Single-threaded reserve/publish/peek/release of one message in a ring exactly one message large.
+ * With offset 0 every region is contiguous; with offset size/2 every region is split at the ring end,
+ * which isolates the cost of the two-part copy.
+ * Arguments: message size, start offset.
+ */
+void BM_WrapAround(benchmark::State& state) {
+    const auto messageSize = static_cast<std::size_t>(state.range(0));
+    const auto offset = static_cast<std::size_t>(state.range(1));
+
+    InMemoryChannel channel(messageSize);
+    if (offset != 0) {
+        channel.reserve(offset);
+        channel.publish(offset);
+        channel.peek(offset);
+        channel.release(offset);
+    }
+
+    alignas(64) std::byte message[MAX_MESSAGE]{};
+    alignas(64) std::byte sink[MAX_MESSAGE];
+
+    for (auto _ : state) {
+        copy_into(channel.reserve(messageSize), message, messageSize);
+        channel.publish(messageSize);
+
+        const ReadableRegion region = channel.peek(messageSize);
+        copy_from(region, sink, messageSize);
+        channel.release(messageSize);
+        benchmark::DoNotOptimize(sink);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(messageSize));
+}
+
+} // namespace
+
+BENCHMARK(BM_Throughput<InMemoryChannel>)->Name("Throughput/Shared")
+    ->ArgsProduct({ {8, 64, 256, 1024}, {1 << 12, 1 << 16, 1 << 20} })->UseRealTime();
+BENCHMARK(BM_Throughput<CachedInMemoryChannel>)->Name("Throughput/CachedIndex")
+    ->ArgsProduct({ {8, 64, 256, 1024}, {1 << 12, 1 << 16, 1 << 20} })->UseRealTime();
+
+BENCHMARK(BM_PingPong<InMemoryChannel>)->Name("PingPong/Shared")->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK(BM_PingPong<CachedInMemoryChannel>)->Name("PingPong/CachedIndex")->Arg(0)->Arg(1)->UseRealTime();
+
+BENCHMARK(BM_PingPongWaitable)->Name("PingPong/Waitable")
+    ->ArgsProduct({ {0, 1}, {0, 1000} })->UseRealTime();
+
+BENCHMARK(BM_WrapAround)->Name("WrapAround")
+    ->Args({64, 0})->Args({64, 32})
+    ->Args({256, 0})->Args({256, 128})
+    ->Args({1024, 0})->Args({1024, 512});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include <checkpoint/PagedState.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace lute::tm::checkpoint;
+
+namespace {
+
+constexpr std::size_t WRITES_PER_INTERVAL = 4096;
+
+std::vector<std::size_t> randomIndices(const std::size_t elements) {
+    std::mt19937_64 rng(42);
+    std::vector<std::size_t> indices(WRITES_PER_INTERVAL);
+    for (std::size_t& index : indices) index = rng() % elements;
+    return indices;
+}
+
+/**
+ * The barrier stall of an operator with \c range(0) MiB of state: one checkpoint interval of random writes,
+ * then an incremental snapshot. The writes are paused from the timer; items are checkpoints.
+ */
+void BM_PagedSnapshot(benchmark::State& state) {
+    const std::size_t elements = static_cast<std::size_t>(state.range(0)) * (1 << 20) / sizeof(std::uint64_t);
+    const std::vector<std::size_t> indices = randomIndices(elements);
+
+    PagedState<std::uint64_t> paged(elements);
+    CheckpointId checkpoint = 0;
+    std::size_t pages = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (const std::size_t i : indices) ++paged.mutate(i);
+        state.ResumeTiming();
+
+        ++checkpoint;
+        const StateSnapshot snapshot = paged.snapshot(checkpoint, checkpoint == 1);
+        pages += snapshot.pages.size();
+        benchmark::DoNotOptimize(snapshot.pages.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    state.counters["pages"] = static_cast<double>(pages) / static_cast<double>(state.iterations());
+}
+
+/**
+ * The same stall if the barrier copied the whole state before handing it to the writer
+ */
+void BM_DeepCopySnapshot(benchmark::State& state) {
+    const std::size_t elements = static_cast<std::size_t>(state.range(0)) * (1 << 20) / sizeof(std::uint64_t);
+    const std::vector<std::size_t> indices = randomIndices(elements);
+
+    std::vector<std::uint64_t> live(elements);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (const std::size_t i : indices) ++live[i];
+        state.ResumeTiming();
+
+        std::vector<std::uint64_t> copy(live);
+        benchmark::DoNotOptimize(copy.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+/**
+ * One interval of writes while the previous snapshot is still held by the writer (every first write to a
+ * page copies it, \c range(1) = 1) or already released (\c range(1) = 0). Items are writes.
+ */
+void BM_MutateDuringSnapshot(benchmark::State& state) {
+    const std::size_t elements = static_cast<std::size_t>(state.range(0)) * (1 << 20) / sizeof(std::uint64_t);
+    const bool held = state.range(1) != 0;
+    const std::vector<std::size_t> indices = randomIndices(elements);
+
+    PagedState<std::uint64_t> paged(elements);
+    CheckpointId checkpoint = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StateSnapshot snapshot = paged.snapshot(++checkpoint, true);
+        if (!held) snapshot = StateSnapshot{};
+        state.ResumeTiming();
+
+        for (const std::size_t i : indices) ++paged.mutate(i);
+
+        state.PauseTiming();
+        snapshot = StateSnapshot{};
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(WRITES_PER_INTERVAL));
+    state.counters["copies"] = static_cast<double>(paged.copies()) / static_cast<double>(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_PagedSnapshot)->Name("Snapshot/Paged")->RangeMultiplier(8)->Range(1, 512)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DeepCopySnapshot)->Name("Snapshot/DeepCopy")->RangeMultiplier(8)->Range(1, 512)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MutateDuringSnapshot)->Name("Snapshot/Mutate")->ArgsProduct({ {64}, {0, 1} })->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
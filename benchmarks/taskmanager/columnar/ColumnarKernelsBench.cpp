@@ -0,0 +1,190 @@
+#include <benchmark/benchmark.h>
+#include <columnar/Kernels.h>
+#include <gates/ColumnarGate.h>
+#include <gates/InputGate.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace lute::tm::columnar;
+using lute::tm::gates::ColumnarGate;
+using lute::tm::gates::InputGate;
+
+namespace {
+
+constexpr std::size_t RECORDS = 4096;
+constexpr std::uint32_t PARTITIONS = 64;
+
+struct Trade {
+    std::uint64_t time;
+    std::int64_t price;
+    double quantity;
+    std::uint64_t account;
+};
+
+std::vector<Trade> trades() {
+    std::mt19937_64 rng(1);
+    std::uniform_int_distribution<std::int64_t> price(0, 999);
+    std::vector<Trade> result(RECORDS);
+    for (std::size_t i = 0; i < RECORDS; ++i) {
+        result[i] = Trade{ i, price(rng), static_cast<double>(rng() % 100), rng() };
+    }
+    return result;
+}
+
+/**
+ * Prices above this select about a quarter of the trades
+ */
+constexpr std::int64_t THRESHOLD = 750;
+
+/**
+ * The AoS gate and its columnar counterpart, holding the same trades. Batches are fetched but never
+ * committed, so every iteration reads the same records.
+ */
+struct Gates {
+    InputGate<Trade> rows{RECORDS};
+    ColumnarGate<std::int64_t, double, std::uint64_t> columns{RECORDS};
+
+    Gates() {
+        const std::vector<Trade> source = trades();
+        rows.push(source.data(), source.size());
+        columns.transpose(source.data(), source.size(), &Trade::price, &Trade::quantity, &Trade::account);
+    }
+};
+
+/**
+ * Pins the kernels to the level in \p state's argument; false (and the run skipped) if this CPU lacks it
+ */
+bool level(benchmark::State& state, const Kernels*& table) {
+    const auto requested = static_cast<SimdLevel>(state.range(0));
+    if (!supported(requested)) {
+        state.SkipWithError("SIMD level not supported on this CPU");
+        return false;
+    }
+    table = &kernels(requested);
+    return true;
+}
+
+/**
+ * Total quantity of trades priced above \ref THRESHOLD, record by record over the AoS batch
+ */
+void BM_AosFilterSum(benchmark::State& state) {
+    Gates gates;
+
+    for (auto _ : state) {
+        const auto batch = gates.rows.fetch(RECORDS);
+        double sum = 0;
+        for (std::size_t i = 0; i < batch.recordCount; ++i) {
+            if (batch.data[i].price > THRESHOLD) sum += batch.data[i].quantity;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+}
+
+/**
+ * The same query over the columnar batch: filter the price column into a selection, then aggregate the
+ * selected quantities
+ */
+void BM_SoaFilterSum(benchmark::State& state) {
+    const Kernels* table = nullptr;
+    if (!level(state, table)) return;
+
+    Gates gates;
+    SelectionVector selection(RECORDS);
+
+    for (auto _ : state) {
+        const auto batch = gates.columns.fetch(RECORDS);
+        filter<std::int64_t>(batch.column<0>(), Compare::Greater, THRESHOLD, selection, *table);
+        benchmark::DoNotOptimize(aggregate<double>(batch.column<1>(), selection, *table));
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+    state.counters["selected"] = static_cast<double>(selection.size());
+}
+
+/**
+ * Sum, minimum and maximum of the price over the whole AoS batch
+ */
+void BM_AosAggregate(benchmark::State& state) {
+    Gates gates;
+
+    for (auto _ : state) {
+        const auto batch = gates.rows.fetch(RECORDS);
+        Aggregate<std::int64_t> result;
+        for (std::size_t i = 0; i < batch.recordCount; ++i) {
+            const std::int64_t price = batch.data[i].price;
+            result.sum += price;
+            result.min = std::min(result.min, price);
+            result.max = std::max(result.max, price);
+        }
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+}
+
+void BM_SoaAggregate(benchmark::State& state) {
+    const Kernels* table = nullptr;
+    if (!level(state, table)) return;
+
+    Gates gates;
+
+    for (auto _ : state) {
+        const auto batch = gates.columns.fetch(RECORDS);
+        benchmark::DoNotOptimize(aggregate<std::int64_t>(batch.column<0>(), *table));
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+}
+
+/**
+ * Partition id of every trade by account, one hash per record over the AoS batch
+ */
+void BM_AosHashPartition(benchmark::State& state) {
+    Gates gates;
+    std::vector<std::uint32_t> partitions(RECORDS);
+
+    for (auto _ : state) {
+        const auto batch = gates.rows.fetch(RECORDS);
+        for (std::size_t i = 0; i < batch.recordCount; ++i) {
+            partitions[i] = partition_of(hash_key(batch.data[i].account), PARTITIONS);
+        }
+        benchmark::DoNotOptimize(partitions.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+}
+
+void BM_SoaHashPartition(benchmark::State& state) {
+    const Kernels* table = nullptr;
+    if (!level(state, table)) return;
+
+    Gates gates;
+    std::vector<std::uint32_t> partitions(RECORDS);
+
+    for (auto _ : state) {
+        const auto batch = gates.columns.fetch(RECORDS);
+        hash_partition(batch.column<2>(), PARTITIONS, partitions.data(), *table);
+        benchmark::DoNotOptimize(partitions.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+}
+
+} // namespace
+
+// Argument of the Soa runs: 0 scalar, 1 AVX2, 2 AVX-512
+BENCHMARK(BM_AosFilterSum)->Name("Columnar/FilterSum/Aos");
+BENCHMARK(BM_SoaFilterSum)->Name("Columnar/FilterSum/Soa")->DenseRange(0, 2);
+BENCHMARK(BM_AosAggregate)->Name("Columnar/Aggregate/Aos");
+BENCHMARK(BM_SoaAggregate)->Name("Columnar/Aggregate/Soa")->DenseRange(0, 2);
+BENCHMARK(BM_AosHashPartition)->Name("Columnar/HashPartition/Aos");
+BENCHMARK(BM_SoaHashPartition)->Name("Columnar/HashPartition/Soa")->DenseRange(0, 2);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include <exec/cpu_affinity.h>
+#include <gates/InputGate.h>
+#include <support/CpuPlacement.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace lute::tm::gates;
+using lute::bench::CpuPlacement;
+using lute::bench::ScopedPin;
+
+namespace {
+
+constexpr std::size_t GATE_CAPACITY = 4096;
+
+/**
+ * Fetch→commit cycles of up to \c range(0) records on the pinned operator thread, with a pinned
+ * InputGate thread pushing records in batches of the same size. Items are records, so the rate shows
+ * how much of the per-cycle cost batching amortises.
+ */
+void BM_FetchCommitBatch(benchmark::State& state) {
+    const auto batchSize = static_cast<std::size_t>(state.range(0));
+    const CpuPlacement cpus = CpuPlacement::preferred();
+
+    InputGate<std::uint64_t> gate(GATE_CAPACITY);
+    std::atomic<bool> stop{false};
+
+    ScopedPin pin(cpus.consumer);
+    std::thread producer([&]() {
+        lute::runtime::exec::pin_current_thread({cpus.producer});
+
+        std::vector<std::uint64_t> records(batchSize);
+        std::uint64_t sequence = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            for (std::uint64_t& record : records) record = sequence++;
+            if (gate.push(records.data(), records.size()) == 0) cpus.relax();
+        }
+    });
+
+    std::uint64_t records = 0;
+    std::uint64_t checksum = 0;
+
+    for (auto _ : state) {
+        InputGate<std::uint64_t>::RecordBatch batch;
+        while ((batch = gate.fetch(batchSize)).recordCount == 0) cpus.relax();
+
+        for (std::size_t i = 0; i < batch.recordCount; ++i) checksum += batch.data[i];
+        gate.commit(batch.recordCount);
+        records += batch.recordCount;
+    }
+
+    stop.store(true);
+    producer.join();
+
+    benchmark::DoNotOptimize(checksum);
+    state.SetLabel(cpus.label());
+    state.SetItemsProcessed(static_cast<std::int64_t>(records));
+    state.counters["records/cycle"] = static_cast<double>(records) / static_cast<double>(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_FetchCommitBatch)->Name("FetchCommit/Batch")
+    ->Arg(1)->Arg(8)->Arg(64)->Arg(256)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include <gates/InputGate.h>
+#include <support/LatencySamples.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+using namespace lute::tm::gates;
+using lute::bench::LatencySamples;
+
+namespace {
+
+constexpr std::size_t GATE_CAPACITY = 1024;
+
+/**
+ * Cache-line sized record that needs no destruction
+ */
+struct PlainRecord {
+    std::uint64_t sequence;
+    std::uint64_t payload[7];
+};
+
+/**
+ * Cache-line sized record whose destructor returns a lease, standing in for records that own a buffer
+ * reference. This is the cleanup work the policies move around.
+ */
+struct LeasedRecord {
+    static inline std::atomic<std::uint64_t> outstanding{0};
+
+    explicit LeasedRecord(std::uint64_t seq) noexcept : sequence(seq) {
+        outstanding.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~LeasedRecord() { outstanding.fetch_sub(1, std::memory_order_relaxed); }
+
+    std::uint64_t sequence;
+    std::uint64_t payload[7];
+};
+
+template<typename Gate>
+void runProducer(Gate& gate, const std::atomic<bool>& stop) {
+    using Policy = typename Gate::cleanup_policy;
+
+    std::uint64_t sequence = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+        if (gate.emplace(sequence)) ++sequence;
+
+        // Signaled cleanup is serviced by its own thread; the gate must have a single cleaner
+        if constexpr (!std::is_same_v<Policy, SignaledCleanup>) gate.service();
+    }
+}
+
+/**
+ * Measures one fetch→commit cycle on the operator thread while a producer keeps the gate fed.
+ * The producer doubles as the InputGate thread, so deferred cleanup runs there; signaled cleanup gets
+ * its own parked thread.
+ */
+template<typename Policy, typename Record>
+void BM_FetchCommit(benchmark::State& state) {
+    InputGate<Record, Policy> gate(GATE_CAPACITY);
+    std::atomic<bool> stop{false};
+
+    std::thread producer([&]() { runProducer(gate, stop); });
+
+    std::thread cleaner;
+    if constexpr (std::is_same_v<Policy, SignaledCleanup>) {
+        cleaner = std::thread([&]() {
+            while (!stop.load()) {
+                gate.service();
+                gate.waitForCommits(stop);
+            }
+        });
+    }
+
+    LatencySamples latencies(1 << 22);
+    std::uint64_t checksum = 0;
+
+    for (auto _ : state) {
+        typename decltype(gate)::RecordBatch batch{};
+        LatencySamples::Clock::time_point start;
+        do {
+            start = LatencySamples::Clock::now();
+            batch = gate.fetch();
+        } while (batch.recordCount == 0);
+
+        checksum += batch.data->sequence;
+        gate.commit(batch.recordCount);
+
+        latencies.record(start, LatencySamples::Clock::now());
+    }
+
+    stop.store(true);
+    if constexpr (std::is_same_v<Policy, SignaledCleanup>) {
+        gate.wakeCleanup();
+        cleaner.join();
+    }
+    producer.join();
+
+    benchmark::DoNotOptimize(checksum);
+    latencies.report(state);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+} // namespace
+
+BENCHMARK(BM_FetchCommit<SynchronousCleanup, LeasedRecord>)->Name("FetchCommit/Synchronous")->UseRealTime();
+BENCHMARK(BM_FetchCommit<DeferredCleanup, LeasedRecord>)->Name("FetchCommit/Deferred")->UseRealTime();
+BENCHMARK(BM_FetchCommit<SignaledCleanup, LeasedRecord>)->Name("FetchCommit/Signaled")->UseRealTime();
+BENCHMARK(BM_FetchCommit<OmittedCleanup, PlainRecord>)->Name("FetchCommit/Omitted")->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+#include <channels/InMemoryChannel.h>
+#include <gates/OutputGate.h>
+#include <gates/Partitioners.h>
+
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace lute::tm::gates;
+using lute::tm::channels::InMemoryChannel;
+namespace columnar = lute::tm::columnar;
+
+namespace {
+
+constexpr std::size_t RECORDS = 4096;
+
+struct Event {
+    std::uint64_t key;
+    std::uint64_t time;
+    std::int64_t value;
+    std::uint64_t sequence;
+};
+
+struct KeyOf {
+    std::uint64_t operator()(const Event& event) const noexcept { return event.key; }
+};
+
+std::vector<Event> events() {
+    std::mt19937_64 rng(1);
+    std::vector<Event> result(RECORDS);
+    for (std::size_t i = 0; i < RECORDS; ++i) {
+        result[i] = Event{ rng() % 100'000, i, static_cast<std::int64_t>(rng() % 1000), i };
+    }
+    return result;
+}
+
+/**
+ * One channel per partition, each with room for twice its share of a batch. \ref drain plays the
+ * downstream consumers, releasing everything without reading it.
+ */
+struct Downstream {
+    explicit Downstream(const std::size_t partitions) {
+        const std::size_t bytes = std::bit_ceil(std::max<std::size_t>(2 * RECORDS * sizeof(Event) / partitions, 4096));
+        for (std::size_t i = 0; i < partitions; ++i) {
+            owned.push_back(std::make_unique<InMemoryChannel>(bytes));
+            channels.push_back(owned.back().get());
+        }
+    }
+
+    void drain() noexcept {
+        for (InMemoryChannel* const channel : channels) channel->release(channel->peek().size());
+    }
+
+    std::vector<std::unique_ptr<InMemoryChannel>> owned;
+    std::vector<InMemoryChannel*> channels;
+};
+
+/**
+ * Baseline shuffle: hash each record on its own and send it straight to its channel, one publish per record
+ */
+void BM_SendPerRecord(benchmark::State& state) {
+    const auto partitions = static_cast<std::uint32_t>(state.range(0));
+    const std::vector<Event> input = events();
+    Downstream downstream(partitions);
+
+    for (auto _ : state) {
+        for (const Event& event : input) {
+            const std::uint32_t partition = columnar::partition_of(columnar::hash_key(event.key), partitions);
+            downstream.channels[partition]->send(&event, sizeof(Event));
+        }
+        downstream.drain();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+}
+
+/**
+ * The same shuffle through an \ref OutputGate with default staging; hashing on \p level
+ */
+void shuffle(benchmark::State& state, const columnar::SimdLevel level) {
+    if (!columnar::supported(level)) {
+        state.SkipWithError("SIMD level not supported on this CPU");
+        return;
+    }
+
+    const auto partitions = static_cast<std::uint32_t>(state.range(0));
+    const std::vector<Event> input = events();
+    Downstream downstream(partitions);
+    OutputGate<Event, InMemoryChannel, HashPartitioner<KeyOf>> gate(
+        downstream.channels, HashPartitioner(partitions, KeyOf{}, columnar::kernels(level)));
+
+    for (auto _ : state) {
+        gate.push(input.data(), input.size());
+        gate.flush();
+        downstream.drain();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+    state.counters["records_per_publish"] = static_cast<double>(gate.published()) / static_cast<double>(gate.publishes());
+    state.counters["staging_records"] = static_cast<double>(gate.stagingRecords());
+}
+
+void BM_OutputGate(benchmark::State& state) {
+    shuffle(state, columnar::detected_level());
+}
+
+void BM_OutputGateScalarHash(benchmark::State& state) {
+    shuffle(state, columnar::SimdLevel::Scalar);
+}
+
+} // namespace
+
+// Argument: downstream partitions
+BENCHMARK(BM_SendPerRecord)->Name("OutputGate/SendPerRecord")->Arg(8)->Arg(64)->Arg(512);
+BENCHMARK(BM_OutputGate)->Name("OutputGate/Staged")->Arg(8)->Arg(64)->Arg(512);
+BENCHMARK(BM_OutputGateScalarHash)->Name("OutputGate/StagedScalarHash")->Arg(8)->Arg(64)->Arg(512);
+
+BENCHMARK_MAIN();
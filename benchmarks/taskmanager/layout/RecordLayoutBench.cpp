@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+#include <layout/RecordLayout.h>
+#include <layout/Schema.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace lute::tm::layout;
+
+namespace {
+
+constexpr std::size_t RECORDS = 4096;
+
+using TradeV1 = RecordLayout<Field<std::uint64_t>, Field<std::uint32_t>>;
+using TradeV2 = RecordLayout<Field<std::uint64_t>, Field<std::uint64_t>, Field<std::int64_t>, Field<std::uint32_t, ByteOrder::Big>>;
+using Trades = Schema<1, TradeV1, TradeV2>;
+
+/**
+ * What an operator would deserialize into without in-place access
+ */
+struct Trade {
+    std::uint64_t time;
+    std::uint64_t quantity;
+    std::int64_t price;
+    std::uint32_t venue;
+};
+
+/**
+ * \p RECORDS back-to-back records of \p SchemaType's current version, as they sit in a channel
+ */
+template<typename SchemaType>
+std::vector<std::byte> records() {
+    std::vector<std::byte> buffer(RECORDS * SchemaType::recordBytes);
+    for (std::size_t i = 0; i < RECORDS; ++i) {
+        auto writer = SchemaType::initialize(buffer.data() + i * SchemaType::recordBytes);
+        writer.template set<0>(i).template set<1>(i % 100);
+        if constexpr (SchemaType::version == 2) writer.template set<2>(static_cast<std::int64_t>(i * 3)).template set<3>(7u);
+    }
+    return buffer;
+}
+
+/**
+ * Sum of quantity × price read in place through a \ref SchemaReader; items are records
+ */
+void BM_ReadInPlace(benchmark::State& state) {
+    const std::vector<std::byte> buffer = records<Trades>();
+    SchemaReader<Trades> reader;
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < RECORDS; ++i) {
+            const auto view = reader.read(std::span(buffer).subspan(i * Trades::recordBytes, Trades::recordBytes));
+            sum += static_cast<std::int64_t>(view->get<1>()) * view->get<2>() + view->get<3>();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+}
+
+/**
+ * The same sum after deserializing each record field by field into a struct, checking its header as the
+ * reader does
+ */
+void BM_Deserialize(benchmark::State& state) {
+    const std::vector<std::byte> buffer = records<Trades>();
+    std::vector<Trade> trades(RECORDS);
+
+    for (auto _ : state) {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < RECORDS; ++i) {
+            const std::byte* const record = buffer.data() + i * Trades::recordBytes;
+            const RecordView<RecordHeader> header(record);
+            if (header.get<HEADER_SCHEMA>() != Trades::id || header.get<HEADER_VERSION>() != Trades::version) continue;
+
+            const RecordView<TradeV2> view(record + RecordHeader::size);
+            trades[count++] = Trade{ view.get<0>(), view.get<1>(), view.get<2>(), view.get<3>() };
+        }
+        benchmark::DoNotOptimize(count);
+
+        std::int64_t sum = 0;
+        for (const Trade& trade : trades) sum += static_cast<std::int64_t>(trade.quantity) * trade.price + trade.venue;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+}
+
+/**
+ * The sum over records an old producer wrote at v1, upgraded one by one as they are read
+ */
+void BM_ReadUpgraded(benchmark::State& state) {
+    const std::vector<std::byte> buffer = records<Schema<1, TradeV1>>();
+    constexpr std::size_t STRIDE = Schema<1, TradeV1>::recordBytes;
+    SchemaReader<Trades> reader;
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < RECORDS; ++i) {
+            const auto view = reader.read(std::span(buffer).subspan(i * STRIDE, STRIDE));
+            sum += static_cast<std::int64_t>(view->get<1>()) * view->get<2>() + view->get<3>();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+}
+
+} // namespace
+
+BENCHMARK(BM_ReadInPlace)->Name("Layout/ReadInPlace");
+BENCHMARK(BM_Deserialize)->Name("Layout/Deserialize");
+BENCHMARK(BM_ReadUpgraded)->Name("Layout/ReadUpgraded");
+
+BENCHMARK_MAIN();
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+#include <replay/Recorder.h>
+#include <replay/Replayer.h>
+
+#include <gates/InputGate.h>
+#include <watermarks/Watermark.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using namespace lute::tm::replay;
+using lute::tm::gates::InputGate;
+using lute::tm::watermarks::Element;
+
+namespace {
+
+constexpr std::size_t BATCH = 64;
+
+using Gate = InputGate<Element<std::uint64_t>>;
+
+void fill(Gate& gate, std::uint64_t& t) {
+    for (std::size_t i = 0; i < BATCH; ++i, ++t) gate.emplace(Element<std::uint64_t>::record(t, t * 31));
+}
+
+/**
+ * Fetch + commit of a 64-record batch straight from the gate; refilling the gate is paused from the timer
+ */
+void BM_GateConsume(benchmark::State& state) {
+    Gate gate(BATCH);
+    std::uint64_t t = 0;
+    std::uint64_t sum = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        fill(gate, t);
+        state.ResumeTiming();
+
+        const auto batch = gate.fetch(BATCH);
+        for (std::size_t i = 0; i < batch.recordCount; ++i) sum += batch.data[i].value;
+        gate.commit(batch.recordCount);
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BATCH));
+}
+
+/**
+ * The same batch through a \ref RecordingGate: what Sim recording costs the operator per record
+ */
+void BM_RecordingGateConsume(benchmark::State& state) {
+    Gate gate(BATCH);
+    std::size_t logged = 0;
+    Recorder<> recorder([&](std::vector<std::byte>&& chunk) { logged += chunk.size(); });
+    RecordingGate<Gate> recording(gate, recorder, 0);
+    std::uint64_t t = 0;
+    std::uint64_t sum = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        fill(gate, t);
+        state.ResumeTiming();
+
+        const auto batch = recording.fetch(BATCH);
+        for (std::size_t i = 0; i < batch.recordCount; ++i) sum += batch.data[i].value;
+        recording.commit(batch.recordCount);
+    }
+    recorder.flush();
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BATCH));
+    state.counters["bytes_per_record"] = static_cast<double>(logged) / (static_cast<double>(state.iterations()) * BATCH);
+}
+
+/**
+ * Replaying a recorded stream of timed records and watermarks into a summing operator. Items are records.
+ */
+void BM_Replay(benchmark::State& state) {
+    constexpr std::uint64_t RECORDS = 1 << 16;
+
+    std::vector<std::byte> stream;
+    {
+        Recorder<> recorder([&](std::vector<std::byte>&& chunk) { stream.insert(stream.end(), chunk.begin(), chunk.end()); });
+        for (std::uint64_t t = 0; t < RECORDS; ++t) {
+            if (t % BATCH == 0) recorder.tick();
+            const std::uint64_t value = t * 31;
+            recorder.timedRecord(static_cast<std::uint32_t>(t % 4), t, std::as_bytes(std::span(&value, 1)));
+            if (t % BATCH == BATCH - 1) recorder.watermark(0, t);
+        }
+        recorder.flush();
+    }
+
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        Replayer replayer(stream);
+        replayer.poll(
+            [&](std::size_t, std::uint64_t time, std::span<const std::byte> payload) {
+                sum += time + static_cast<std::uint64_t>(payload.size());
+                return true;
+            },
+            [&](std::size_t, std::uint64_t watermark) { sum ^= watermark; },
+            [](std::size_t, std::uint64_t) {});
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RECORDS));
+    state.counters["log_bytes"] = static_cast<double>(stream.size());
+}
+
+} // namespace
+
+BENCHMARK(BM_GateConsume)->Name("Replay/Consume/Gate");
+BENCHMARK(BM_RecordingGateConsume)->Name("Replay/Consume/RecordingGate");
+BENCHMARK(BM_Replay)->Name("Replay/Replay");
+
+BENCHMARK_MAIN();
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <watermarks/WatermarkMerger.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace lute::tm::watermarks;
+
+namespace {
+
+/**
+ * Every iteration raises the input holding the combined watermark back (the worst case: a full replay to
+ * the root) and reads the combined watermark, over \c range(0) inputs
+ */
+void BM_TournamentLaggard(benchmark::State& state) {
+    const auto inputs = static_cast<std::size_t>(state.range(0));
+
+    WatermarkMerger merger(inputs);
+    for (std::size_t i = 0; i < inputs; ++i) merger.observe(i, i + 1);
+    merger.settle();
+
+    for (auto _ : state) {
+        const std::size_t laggard = merger.laggard();
+        merger.update(laggard, merger.watermark(laggard) + inputs);
+        benchmark::DoNotOptimize(merger.current());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+/**
+ * Same updates against a flat array rescanned for its minimum
+ */
+void BM_LinearLaggard(benchmark::State& state) {
+    const auto inputs = static_cast<std::size_t>(state.range(0));
+
+    std::vector<EventTime> watermarks(inputs);
+    for (std::size_t i = 0; i < inputs; ++i) watermarks[i] = i + 1;
+
+    for (auto _ : state) {
+        const auto laggard = std::min_element(watermarks.begin(), watermarks.end());
+        *laggard += inputs;
+        benchmark::DoNotOptimize(*std::min_element(watermarks.begin(), watermarks.end()));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+/**
+ * A round in which \c range(1) random inputs send a watermark: observed one by one, settled once
+ */
+void BM_TournamentRound(benchmark::State& state) {
+    const auto inputs = static_cast<std::size_t>(state.range(0));
+    const auto updates = static_cast<std::size_t>(state.range(1));
+
+    std::mt19937_64 rng(3);
+    std::vector<std::uint32_t> picks(1 << 12);
+    for (std::uint32_t& pick : picks) pick = static_cast<std::uint32_t>(rng() % inputs);
+
+    WatermarkMerger merger(inputs);
+    EventTime clock = 0;
+    std::size_t next = 0;
+
+    for (auto _ : state) {
+        ++clock;
+        for (std::size_t i = 0; i < updates; ++i) merger.observe(picks[next++ & (picks.size() - 1)], clock);
+        benchmark::DoNotOptimize(merger.settle());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(updates));
+}
+
+} // namespace
+
+BENCHMARK(BM_TournamentLaggard)->Name("Watermark/Tournament/Laggard")->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(BM_LinearLaggard)->Name("Watermark/Linear/Laggard")->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(BM_TournamentRound)->Name("Watermark/Tournament/Round")->ArgsProduct({ {64, 1024}, {1, 16, 256} });
+
+BENCHMARK_MAIN();
@@ -0,0 +1,164 @@
+#include <benchmark/benchmark.h>
+#include <windows/AbelianWindow.h>
+#include <windows/MonoidWindow.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace lute::tm::windows;
+
+namespace {
+
+constexpr std::size_t INPUT_SIZE = 1 << 16;
+
+std::vector<std::int64_t> randomValues() {
+    std::mt19937_64 rng(42);
+    std::vector<std::int64_t> values(INPUT_SIZE);
+    for (std::int64_t& value : values) value = static_cast<std::int64_t>(rng() % 1'000'000);
+    return values;
+}
+
+/**
+ * Timestamps 0, 1, 2, ... shuffled within blocks of \p disorder
+ */
+std::vector<std::uint64_t> disorderedTimestamps(const std::size_t disorder) {
+    std::mt19937_64 rng(7);
+    std::vector<std::uint64_t> timestamps(INPUT_SIZE);
+    std::iota(timestamps.begin(), timestamps.end(), 0);
+
+    for (std::size_t begin = 0; begin < timestamps.size(); begin += disorder) {
+        const auto first = timestamps.begin() + static_cast<std::ptrdiff_t>(begin);
+        std::shuffle(first, first + static_cast<std::ptrdiff_t>(std::min(disorder, timestamps.size() - begin)), rng);
+    }
+    return timestamps;
+}
+
+/**
+ * One slide (evict oldest + insert) and one query of a full count-based Max window of \c range(0) values
+ */
+void BM_MonoidMax(benchmark::State& state) {
+    const auto window_size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> values = randomValues();
+
+    MonoidWindow<Max<std::int64_t>> window(window_size);
+    std::uint64_t t = 0;
+    for (; t < window_size; ++t) window.insert(t, values[t % INPUT_SIZE]);
+
+    for (auto _ : state) {
+        window.insert(t, values[t % INPUT_SIZE]);
+        benchmark::DoNotOptimize(window.query());
+        ++t;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+/**
+ * Same slide, recomputing the maximum over the whole window for every query
+ */
+void BM_NaiveMax(benchmark::State& state) {
+    const auto window_size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> values = randomValues();
+
+    std::deque<std::int64_t> window(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(window_size));
+    std::size_t t = window_size;
+
+    for (auto _ : state) {
+        window.pop_front();
+        window.push_back(values[t % INPUT_SIZE]);
+        benchmark::DoNotOptimize(*std::max_element(window.begin(), window.end()));
+        ++t;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+/**
+ * One in-order insert and one query of a Sum + Count window spanning \c range(0) ticks, one value per tick
+ */
+void BM_AbelianSum(benchmark::State& state) {
+    const auto range = static_cast<std::uint64_t>(state.range(0));
+    const std::vector<std::int64_t> values = randomValues();
+
+    AbelianWindow<Sum<std::int64_t>, Count<std::int64_t>> window(range);
+    std::uint64_t t = 0;
+
+    for (auto _ : state) {
+        window.insert(t, values[t % INPUT_SIZE]);
+        benchmark::DoNotOptimize(window.query());
+        ++t;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+void BM_NaiveSum(benchmark::State& state) {
+    const auto window_size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> values = randomValues();
+
+    std::deque<std::int64_t> window(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(window_size));
+    std::size_t t = window_size;
+
+    for (auto _ : state) {
+        window.pop_front();
+        window.push_back(values[t % INPUT_SIZE]);
+        benchmark::DoNotOptimize(std::accumulate(window.begin(), window.end(), std::int64_t{0}));
+        benchmark::DoNotOptimize(window.size());
+        ++t;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+/**
+ * Batches of 256 values whose timestamps are shuffled within blocks of \c range(0), into a window of 4096
+ * ticks with 64-tick panes; \c range(1) = 1 uses \c insert_batch, 0 inserts value by value. Items are values.
+ */
+void BM_AbelianBatch(benchmark::State& state) {
+    constexpr std::size_t BATCH = 256;
+    const auto disorder = static_cast<std::size_t>(state.range(0));
+    const bool batched = state.range(1) != 0;
+
+    const std::vector<std::int64_t> values = randomValues();
+    const std::vector<std::uint64_t> timestamps = disorderedTimestamps(disorder);
+
+    AbelianWindow<Sum<std::int64_t>, Count<std::int64_t>> window(4096, 64);
+    std::uint64_t epoch = 0;
+    std::size_t offset = 0;
+    std::vector<std::uint64_t> batch(BATCH);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < BATCH; ++i) batch[i] = timestamps[offset + i] + epoch;
+
+        if (batched) {
+            benchmark::DoNotOptimize(window.insert_batch(batch.data(), values.data() + offset, BATCH));
+        } else {
+            for (std::size_t i = 0; i < BATCH; ++i) window.insert(batch[i], values[offset + i]);
+        }
+        benchmark::DoNotOptimize(window.query());
+
+        offset += BATCH;
+        if (offset == INPUT_SIZE) {
+            offset = 0;
+            epoch += INPUT_SIZE;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BATCH));
+    state.counters["late"] = static_cast<double>(window.late());
+}
+
+} // namespace
+
+BENCHMARK(BM_MonoidMax)->Name("Window/Monoid/Max")->RangeMultiplier(16)->Range(64, 16384);
+BENCHMARK(BM_NaiveMax)->Name("Window/Naive/Max")->RangeMultiplier(16)->Range(64, 16384);
+BENCHMARK(BM_AbelianSum)->Name("Window/Abelian/SumCount")->RangeMultiplier(16)->Range(64, 16384);
+BENCHMARK(BM_NaiveSum)->Name("Window/Naive/SumCount")->RangeMultiplier(16)->Range(64, 16384);
+BENCHMARK(BM_AbelianBatch)->Name("Window/Abelian/Batch")->ArgsProduct({ {1, 64, 1024}, {0, 1} });
+
+BENCHMARK_MAIN();
@@ -2,5 +2,6 @@ option(ENABLE_ASSERTS "Enable runtime assertions" ON)
 option(ENABLE_LOGGING "Enable logging" ON)
 option(ENABLE_TRACING "Enable tracing" OFF)
 option(ENABLE_SANITIZERS "Enable sanitizers" OFF)
+option(ENABLE_BENCHMARKS "Build benchmarks" OFF)
 
 add_compile_options(-march=native)
\ No newline at end of file
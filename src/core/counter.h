@@ -0,0 +1,18 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace lute::core {
+
+/**
+ * @brief Adds \p by to a counter that only the calling thread writes
+ *
+ * A relaxed load and store instead of a locked read-modify-write; readers on other threads (stats, metrics)
+ * see a whole value that may lag by the increments still in flight.
+ */
+inline void bump(std::atomic<std::uint64_t>& counter, const std::uint64_t by = 1) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+}
+
+} // namespace lute::core
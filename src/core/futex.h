@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+#endif
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * Primitives for threads that wait on a 32-bit word: a spin hint and private futex wait/wake.
+ *
+ * These are the only syscalls on the data-plane wait paths; callers keep them off the fast path by
+ * announcing themselves before parking and letting the other side check that announcement.
+ */
+
+namespace lute::core {
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t));
+
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+/**
+ * @brief Parks the calling thread on \p word while it still holds \p expected, for at most \p timeout.
+ * Returns early on a wake, on a signal, or immediately if \p word no longer holds \p expected.
+ */
+inline void futex_wait(const std::atomic<std::uint32_t>& word, const std::uint32_t expected,
+                       const std::chrono::nanoseconds timeout) noexcept {
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    const timespec ts {
+        .tv_sec = static_cast<time_t>(seconds.count()),
+        .tv_nsec = static_cast<long>((timeout - seconds).count()),
+    };
+
+    ::syscall(SYS_futex, reinterpret_cast<const std::uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0);
+}
+
+/**
+ * @brief Parks without a timeout; same contract otherwise
+ */
+inline void futex_wait(const std::atomic<std::uint32_t>& word, const std::uint32_t expected) noexcept {
+    ::syscall(SYS_futex, reinterpret_cast<const std::uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+}
+
+/**
+ * @brief Wakes up to \p count threads parked on \p word
+ */
+inline void futex_wake(const std::atomic<std::uint32_t>& word, const int count = INT_MAX) noexcept {
+    ::syscall(SYS_futex, reinterpret_cast<const std::uint32_t*>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+} // namespace lute::core
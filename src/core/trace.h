@@ -0,0 +1,238 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * Hot-path tracing.
+ *
+ * \c CORE_TRACE_SCOPE(category, name) records one complete event (begin and end TSC) for the enclosing
+ * scope into the calling thread's ring. The ring is a flight recorder: it keeps the newest events and
+ * overwrites the oldest, so tracing a long run costs bounded memory. A control-plane thread snapshots
+ * the rings (see \ref lute::core::trace::snapshot) and writes them out as Chrome trace JSON.
+ *
+ * Recording an event is two TSC reads, three relaxed stores and one release store on a thread-local
+ * ring; no locks, no allocation once the thread is attached.
+ *
+ * Without \c CORE_TRACING_ENABLED (CMake option \c ENABLE_TRACING) the macro expands to nothing.
+ */
+
+namespace lute::core::trace {
+
+struct TraceSite {
+    const char* category;
+    const char* name;
+};
+
+inline std::uint64_t ticks() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * @brief Per-thread event ring. One writer (the owning thread), any number of snapshotting readers.
+ *
+ * Slots are relaxed atomics so a reader may copy them while the writer overwrites; the reader
+ * discards any slot the writer may have lapped (seqlock on \c head).
+ */
+struct TraceRing {
+    struct Slot {
+        std::atomic<const TraceSite*> site{nullptr};
+        std::atomic<std::uint64_t> begin{0};
+        std::atomic<std::uint64_t> end{0};
+    };
+
+    explicit TraceRing(const std::size_t capacity_power_of_two)
+        : slots(capacity_power_of_two),
+          mask(capacity_power_of_two - 1),
+          tid(static_cast<std::int64_t>(::syscall(SYS_gettid)))
+    {
+        char buffer[16] = {};
+        ::pthread_getname_np(::pthread_self(), buffer, sizeof(buffer));
+        name = buffer;
+    }
+
+    std::vector<Slot> slots;
+    const std::size_t mask;
+    const std::int64_t tid;
+    std::string name;
+
+    alignas(64) std::atomic<std::uint64_t> head{0};
+};
+
+/**
+ * @brief Registry of every ring ever attached. Rings outlive their threads so a dump at shutdown still
+ * sees workers that have already exited.
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<TraceRing>> rings;
+    std::size_t ring_events = 64 * 1024;
+
+    // Clock pair taken at first attach; dumps convert ticks to time against it
+    std::uint64_t base_ticks = 0;
+    std::chrono::steady_clock::time_point base_time{};
+};
+
+inline Registry& registry() {
+    static Registry* instance = new Registry();     // never destroyed: threads may trace during exit
+    return *instance;
+}
+
+inline thread_local TraceRing* t_ring = nullptr;
+
+inline TraceRing* attach_slow() noexcept {
+    try {
+        Registry& r = registry();
+        std::lock_guard lock(r.mutex);
+
+        if (r.rings.empty() && r.base_ticks == 0) {
+            r.base_time = std::chrono::steady_clock::now();
+            r.base_ticks = ticks();
+        }
+
+        r.rings.push_back(std::make_shared<TraceRing>(r.ring_events));
+        t_ring = r.rings.back().get();
+        return t_ring;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Allocates the calling thread's ring up front so its first trace point does not allocate
+ */
+inline bool attach_current_thread() noexcept {
+    return t_ring != nullptr || attach_slow() != nullptr;
+}
+
+/**
+ * @brief Sets the capacity, in events, of rings attached from now on. Must be a power of two.
+ */
+inline void set_ring_events(const std::size_t events) {
+    Registry& r = registry();
+    std::lock_guard lock(r.mutex);
+    r.ring_events = events;
+}
+
+inline void record(const TraceSite& site, const std::uint64_t begin, const std::uint64_t end) noexcept {
+    TraceRing* ring = t_ring != nullptr ? t_ring : attach_slow();
+    if (ring == nullptr) return;
+
+    const std::uint64_t i = ring->head.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);        // orders head = i before the overwrite below
+
+    TraceRing::Slot& slot = ring->slots[i & ring->mask];
+    slot.site.store(&site, std::memory_order_relaxed);
+    slot.begin.store(begin, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+
+    ring->head.store(i + 1, std::memory_order_release);
+}
+
+class TraceScope {
+public:
+    explicit TraceScope(const TraceSite& site) noexcept
+        : site_(site),
+          begin_(ticks())
+    {}
+
+    ~TraceScope() { record(site_, begin_, ticks()); }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const TraceSite& site_;
+    const std::uint64_t begin_;
+};
+
+struct TraceEvent {
+    const TraceSite* site;
+    std::uint64_t begin;
+    std::uint64_t end;
+};
+
+struct ThreadTrace {
+    std::int64_t tid;
+    std::string name;
+    std::vector<TraceEvent> events;     // oldest first
+};
+
+/**
+ * @brief Consistent copy of every ring, without stopping the traced threads
+ *
+ * A wrapped ring yields its newest capacity - 1 events: the slot the writer fills next may be
+ * mid-overwrite and is dropped.
+ *
+ * @thread Control plane
+ */
+inline std::vector<ThreadTrace> snapshot() {
+    Registry& r = registry();
+    std::lock_guard lock(r.mutex);
+
+    std::vector<ThreadTrace> traces;
+    traces.reserve(r.rings.size());
+
+    for (const auto& ring : r.rings) {
+        const std::uint64_t capacity = ring->slots.size();
+        const std::uint64_t first = ring->head.load(std::memory_order_acquire);
+        const std::uint64_t from = first > capacity ? first - capacity : 0;
+
+        ThreadTrace trace{ ring->tid, ring->name, {} };
+        trace.events.reserve(static_cast<std::size_t>(first - from));
+        for (std::uint64_t i = from; i < first; ++i) {
+            const TraceRing::Slot& slot = ring->slots[i & ring->mask];
+            trace.events.push_back({ slot.site.load(std::memory_order_relaxed),
+                                     slot.begin.load(std::memory_order_relaxed),
+                                     slot.end.load(std::memory_order_relaxed) });
+        }
+
+        // Drop whatever the writer may have overwritten while we were copying
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::uint64_t last = ring->head.load(std::memory_order_relaxed);
+        const std::uint64_t valid_from = last >= capacity ? last - capacity + 1 : 0;
+        if (valid_from > from) {
+            const auto stale = static_cast<std::ptrdiff_t>(std::min(valid_from, first) - from);
+            trace.events.erase(trace.events.begin(), trace.events.begin() + stale);
+        }
+
+        traces.push_back(std::move(trace));
+    }
+
+    return traces;
+}
+
+} // namespace lute::core::trace
+
+#define CORE_TRACE_CONCAT_IMPL(a, b) a##b
+#define CORE_TRACE_CONCAT(a, b) CORE_TRACE_CONCAT_IMPL(a, b)
+
+#if defined(CORE_TRACING_ENABLED)
+    #define CORE_TRACE_SCOPE(category, name)                                                            \
+        static constexpr ::lute::core::trace::TraceSite                                                \
+            CORE_TRACE_CONCAT(lute_trace_site_, __LINE__){ category, name };                           \
+        const ::lute::core::trace::TraceScope                                                          \
+            CORE_TRACE_CONCAT(lute_trace_scope_, __LINE__)(CORE_TRACE_CONCAT(lute_trace_site_, __LINE__))
+#else
+    #define CORE_TRACE_SCOPE(category, name) ((void)(0))
+#endif
@@ -26,9 +26,13 @@ int run_daemon(int argc, char** argv, RunFn&& run_fn) noexcept(false) {
             .mode = cli.mode
         };
 
-        return std::forward<RunFn>(run_fn)(ctx, config);
+        const int status = std::forward<RunFn>(run_fn)(ctx, config);
+
+        lute::runtime::logging::shutdown_logging();
+        return status;
 
     } catch (const std::exception& e) {
+        lute::runtime::logging::shutdown_logging();
         std::cerr << "Fatal error: " << e.what() << '\n';
         return EXIT_FAILURE;
     }    
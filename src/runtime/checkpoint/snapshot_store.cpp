@@ -0,0 +1,220 @@
+#include <checkpoint/snapshot_store.h>
+#include <util/helpers.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+namespace lute::runtime::checkpoint {
+
+namespace fs = std::filesystem;
+
+using util::file_error;
+using util::write_all;
+
+static constexpr std::uint64_t SNAPSHOT_MAGIC = 0x4c55544543484b31;     // "LUTECHK1"
+static constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+static constexpr std::string_view DIRECTORY_PREFIX = "chk-";
+static constexpr std::string_view COMPLETE_MARKER = "_COMPLETE";
+
+struct FileHeader {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t element_bytes;
+    std::uint64_t checkpoint;
+    std::uint64_t base;
+    std::uint64_t page_elements;
+    std::uint64_t elements;
+    std::uint64_t page_count;
+};
+
+struct PageHeader {
+    std::uint64_t index;
+    std::uint64_t size;
+};
+
+/**
+ * @brief Closes the descriptor on every exit path
+ */
+class FileDescriptor {
+public:
+    explicit FileDescriptor(const int fd) noexcept : fd_(fd) {}
+    ~FileDescriptor() { if (fd_ >= 0) ::close(fd_); }
+
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    int get() const noexcept { return fd_; }
+
+private:
+    int fd_;
+};
+
+static void read_all(const int fd, void* data, std::size_t size, const std::string& path) {
+    auto* bytes = static_cast<std::byte*>(data);
+    while (size != 0) {
+        const ssize_t n = ::read(fd, bytes, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) throw file_error("read", path, errno);
+        if (n == 0) throw std::runtime_error("snapshot " + path + " is truncated");
+
+        bytes += n;
+        size -= static_cast<std::size_t>(n);
+    }
+}
+
+static void sync_directory(const std::string& path) {
+    const FileDescriptor dir(::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (dir.get() < 0) throw file_error("open", path, errno);
+    if (::fsync(dir.get()) != 0) throw file_error("fsync", path, errno);
+}
+
+static bool valid_name(const std::string& name) {
+    if (name.empty() || name.front() == '.') return false;
+    return std::all_of(name.begin(), name.end(), [](const char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.';
+    });
+}
+
+static std::string state_path(const std::string& root, const CheckpointId checkpoint, const std::string& name) {
+    return checkpoint_directory(root, checkpoint) + "/" + name + ".state";
+}
+
+std::string checkpoint_directory(const std::string& root, const CheckpointId checkpoint) {
+    return root + "/" + std::string(DIRECTORY_PREFIX) + std::to_string(checkpoint);
+}
+
+std::size_t write_snapshot(const std::string& root, const std::string& name, const StateSnapshot& snapshot) {
+    if (!valid_name(name)) throw std::runtime_error("invalid operator state name '" + name + "'");
+
+    const std::string directory = checkpoint_directory(root, snapshot.checkpoint);
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    if (ec) throw std::runtime_error("creating " + directory + " failed: " + ec.message());
+
+    const std::string path = state_path(root, snapshot.checkpoint, name);
+    const std::string temporary = path + ".tmp";
+
+    std::size_t written = 0;
+    {
+        const FileDescriptor file(::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644));
+        if (file.get() < 0) throw file_error("open", temporary, errno);
+
+        const FileHeader header {
+            .magic = SNAPSHOT_MAGIC,
+            .version = SNAPSHOT_VERSION,
+            .element_bytes = snapshot.elementBytes,
+            .checkpoint = snapshot.checkpoint,
+            .base = snapshot.base,
+            .page_elements = snapshot.pageElements,
+            .elements = snapshot.elements,
+            .page_count = snapshot.pages.size(),
+        };
+        write_all(file.get(), &header, sizeof(header), temporary);
+        written += sizeof(header);
+
+        for (const tm::checkpoint::SnapshotPage& page : snapshot.pages) {
+            const PageHeader page_header{ .index = page.index, .size = page.size };
+            write_all(file.get(), &page_header, sizeof(page_header), temporary);
+            write_all(file.get(), page.bytes.get(), page.size, temporary);
+            written += sizeof(page_header) + page.size;
+        }
+
+        if (::fsync(file.get()) != 0) throw file_error("fsync", temporary, errno);
+    }
+
+    if (::rename(temporary.c_str(), path.c_str()) != 0) throw file_error("rename", temporary, errno);
+    sync_directory(directory);
+    return written;
+}
+
+StateSnapshot read_snapshot(const std::string& root, const CheckpointId checkpoint, const std::string& name) {
+    const std::string path = state_path(root, checkpoint, name);
+
+    const FileDescriptor file(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+    if (file.get() < 0) throw file_error("open", path, errno);
+
+    FileHeader header;
+    read_all(file.get(), &header, sizeof(header), path);
+
+    if (header.magic != SNAPSHOT_MAGIC) throw std::runtime_error(path + " is not a lute snapshot");
+    if (header.version != SNAPSHOT_VERSION) throw std::runtime_error(path + ": unsupported snapshot version");
+    if (header.checkpoint != checkpoint) throw std::runtime_error(path + " belongs to another checkpoint");
+
+    StateSnapshot snapshot {
+        .checkpoint = header.checkpoint,
+        .base = header.base,
+        .elementBytes = header.element_bytes,
+        .pageElements = header.page_elements,
+        .elements = header.elements,
+        .pages = {},
+    };
+
+    const std::uint64_t page_limit = header.page_elements * header.element_bytes;
+    snapshot.pages.reserve(header.page_count);
+    for (std::uint64_t i = 0; i < header.page_count; ++i) {
+        PageHeader page;
+        read_all(file.get(), &page, sizeof(page), path);
+        if (page.size > page_limit) throw std::runtime_error(path + ": page larger than the state's pages");
+
+        std::shared_ptr<std::byte[]> bytes(new std::byte[page.size]);
+        read_all(file.get(), bytes.get(), page.size, path);
+        snapshot.pages.push_back({ .index = page.index, .bytes = { bytes, bytes.get() }, .size = page.size });
+    }
+
+    return snapshot;
+}
+
+std::vector<StateSnapshot> read_snapshot_chain(const std::string& root, const CheckpointId checkpoint, const std::string& name) {
+    std::vector<StateSnapshot> chain;
+    for (CheckpointId next = checkpoint; next != tm::checkpoint::NO_CHECKPOINT;) {
+        chain.push_back(read_snapshot(root, next, name));
+
+        const CheckpointId base = chain.back().base;
+        if (base >= next) throw std::runtime_error("snapshot chain of " + name + " does not move backwards");
+        next = base;
+    }
+
+    std::reverse(chain.begin(), chain.end());
+    return chain;
+}
+
+void mark_complete(const std::string& root, const CheckpointId checkpoint) {
+    const std::string directory = checkpoint_directory(root, checkpoint);
+    const std::string path = directory + "/" + std::string(COMPLETE_MARKER);
+
+    const FileDescriptor marker(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644));
+    if (marker.get() < 0) throw file_error("open", path, errno);
+    if (::fsync(marker.get()) != 0) throw file_error("fsync", path, errno);
+
+    sync_directory(directory);
+}
+
+CheckpointId latest_complete(const std::string& root) {
+    CheckpointId latest = tm::checkpoint::NO_CHECKPOINT;
+
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(root, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (!name.starts_with(DIRECTORY_PREFIX)) continue;
+
+        CheckpointId id = 0;
+        const char* const begin = name.data() + DIRECTORY_PREFIX.size();
+        const char* const end = name.data() + name.size();
+        const auto [parsed, error] = std::from_chars(begin, end, id);
+        if (error != std::errc{} || parsed != end) continue;
+
+        if (id > latest && fs::exists(entry.path() / COMPLETE_MARKER, ec)) latest = id;
+    }
+    return latest;
+}
+
+} // namespace lute::runtime::checkpoint
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <checkpoint/StateSnapshot.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace lute::runtime::checkpoint {
+
+using tm::checkpoint::CheckpointId;
+using tm::checkpoint::StateSnapshot;
+
+/**
+ * On-disk layout under the checkpoint root:
+ *
+ *     <root>/chk-<id>/<operator>.state     one file per operator state
+ *     <root>/chk-<id>/_COMPLETE            present once every operator of the checkpoint is durable
+ *
+ * A state file is written under a temporary name, fsynced and renamed, so a file that exists is whole.
+ * Files are in host byte order: they restore on the machine (or architecture) that wrote them.
+ */
+
+/**
+ * @brief Directory holding checkpoint \p checkpoint under \p root
+ */
+std::string checkpoint_directory(const std::string& root, CheckpointId checkpoint);
+
+/**
+ * @brief Persists \p snapshot as the state of \p name in its checkpoint's directory
+ *
+ * @param name Operator state name; letters, digits, '-', '_' and '.' only
+ * @return Bytes written
+ * @throw std::runtime_error if the name is unusable or a file operation fails
+ */
+std::size_t write_snapshot(const std::string& root, const std::string& name, const StateSnapshot& snapshot);
+
+/**
+ * @throw std::runtime_error if the file is missing, truncated, or not a snapshot this build reads
+ */
+StateSnapshot read_snapshot(const std::string& root, CheckpointId checkpoint, const std::string& name);
+
+/**
+ * @brief Snapshots needed to restore \p name as of \p checkpoint, oldest (the full one) first
+ */
+std::vector<StateSnapshot> read_snapshot_chain(const std::string& root, CheckpointId checkpoint, const std::string& name);
+
+/**
+ * @brief Records that every state of \p checkpoint is durable
+ */
+void mark_complete(const std::string& root, CheckpointId checkpoint);
+
+/**
+ * @return The newest complete checkpoint under \p root, or \ref tm::checkpoint::NO_CHECKPOINT
+ */
+CheckpointId latest_complete(const std::string& root);
+
+} // namespace lute::runtime::checkpoint
@@ -0,0 +1,159 @@
+#include <checkpoint/snapshot_writer.h>
+#include <logging/log.h>
+#include <counter.h>
+
+#include <pthread.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace lute::runtime::checkpoint {
+
+using core::bump;
+
+SnapshotWriter::SnapshotWriter(SnapshotWriterOptions options)
+    : options_(std::move(options))
+{
+    if (options_.directory.empty()) {
+        throw std::runtime_error("Snapshot writer needs a checkpoint directory");
+    }
+    if (options_.states == 0) {
+        throw std::runtime_error("Snapshot writer needs at least one operator state per checkpoint");
+    }
+}
+
+SnapshotWriter::~SnapshotWriter() {
+    stop();
+}
+
+void SnapshotWriter::start() {
+    if (thread_.joinable()) return;
+
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = false;
+    }
+    thread_ = std::thread([this]() { run(); });
+    ::pthread_setname_np(thread_.native_handle(), "lute-checkpoint");
+}
+
+void SnapshotWriter::stop() noexcept {
+    if (!thread_.joinable()) return;
+
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+}
+
+void SnapshotWriter::submit(std::string name, StateSnapshot snapshot) {
+    {
+        std::lock_guard lock(mutex_);
+        queue_.push_back(Job{ std::move(name), std::move(snapshot) });
+    }
+    wake_.notify_one();
+}
+
+bool SnapshotWriter::needs_full(const std::string& name) const {
+    std::lock_guard lock(mutex_);
+    return broken_.contains(name);
+}
+
+bool SnapshotWriter::wait_for(const CheckpointId checkpoint, const std::chrono::milliseconds timeout) {
+    std::unique_lock lock(mutex_);
+    return completed_.wait_for(lock, timeout, [&]() { return latest_completed() >= checkpoint; });
+}
+
+SnapshotWriterStats SnapshotWriter::stats() const noexcept {
+    return SnapshotWriterStats {
+        .snapshots = snapshots_.load(std::memory_order_relaxed),
+        .bytes = bytes_.load(std::memory_order_relaxed),
+        .completed = completed_count_.load(std::memory_order_relaxed),
+        .failed = failed_.load(std::memory_order_relaxed),
+    };
+}
+
+void SnapshotWriter::run() noexcept {
+    logging::attach_current_thread();
+
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lock(mutex_);
+            wake_.wait(lock, [&]() { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) return;        // stopping, and everything queued is written
+
+            job = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        write(job);
+        // Dropping the job releases the pages; the operator writes to them in place again
+    }
+}
+
+void SnapshotWriter::write(Job& job) noexcept {
+    const CheckpointId checkpoint = job.snapshot.checkpoint;
+    Progress& progress = progress_[checkpoint];
+
+    bool broken;
+    {
+        std::lock_guard lock(mutex_);
+        broken = broken_.contains(job.name);
+    }
+
+    if (broken && job.snapshot.incremental()) {
+        // Restoring it would need the snapshot that failed; only a full snapshot mends the chain
+        RUNTIME_LOG_ERROR("checkpoint {}: state {} is incremental on a failed snapshot, not written", checkpoint, job.name.c_str());
+        bump(failed_);
+        progress.failed = true;
+    } else {
+        try {
+            const std::size_t bytes = write_snapshot(options_.directory, job.name, job.snapshot);
+            bump(snapshots_);
+            bump(bytes_, bytes);
+            ++progress.written;
+            broken = false;
+        } catch (const std::exception& e) {
+            RUNTIME_LOG_ERROR("checkpoint {}: writing state {} failed: {}", checkpoint, job.name.c_str(), e.what());
+            bump(failed_);
+            progress.failed = true;
+            broken = true;
+        }
+
+        std::lock_guard lock(mutex_);
+        if (broken) {
+            broken_.insert(job.name);
+        } else {
+            broken_.erase(job.name);
+        }
+    }
+
+    if (progress.failed || progress.written < options_.states) return;
+
+    try {
+        mark_complete(options_.directory, checkpoint);
+    } catch (const std::exception& e) {
+        RUNTIME_LOG_ERROR("checkpoint {}: completing failed: {}", checkpoint, e.what());
+        bump(failed_);
+        progress.failed = true;
+        return;
+    }
+
+    // Older checkpoints that are still incomplete will never be needed
+    progress_.erase(progress_.begin(), progress_.upper_bound(checkpoint));
+    bump(completed_count_);
+    RUNTIME_LOG_INFO("checkpoint {} complete", checkpoint);
+
+    {
+        std::lock_guard lock(mutex_);
+        if (checkpoint > latest_completed_.load(std::memory_order_relaxed)) {
+            latest_completed_.store(checkpoint, std::memory_order_release);
+        }
+    }
+    completed_.notify_all();
+}
+
+} // namespace lute::runtime::checkpoint
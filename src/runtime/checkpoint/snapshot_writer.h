@@ -0,0 +1,123 @@
+#pragma once
+
+#include <checkpoint/snapshot_store.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+namespace lute::runtime::checkpoint {
+
+struct SnapshotWriterOptions {
+    std::string directory;          // checkpoint root, see snapshot_store.h
+    std::size_t states = 1;         // operator states per checkpoint; it completes once all of them are durable
+};
+
+/**
+ * @struct SnapshotWriterStats
+ * @brief Totals since the writer started
+ */
+struct SnapshotWriterStats {
+    std::uint64_t snapshots;
+    std::uint64_t bytes;
+    std::uint64_t completed;
+    std::uint64_t failed;           // snapshots that could not be written or whose base failed; their checkpoint never completes
+};
+
+/**
+ * @class SnapshotWriter
+ * @brief Control-plane thread that streams operator snapshots to local files
+ *
+ * Operators hand over their \ref StateSnapshot at the aligned barrier and move on; the pages they reference
+ * stay shared with the live state until written (see \ref tm::checkpoint::PagedState), so the data plane pays
+ * for one short queue lock per operator and checkpoint, never for the I/O. A checkpoint is marked complete
+ * once all \c states snapshots with its id are durable; that is the checkpoint a restart resumes from.
+ *
+ * A state whose snapshot fails has a broken chain: its later incremental snapshots are not written (their
+ * checkpoints never complete) until a full one starts a new chain. Operators ask \ref needs_full before each
+ * snapshot, so that happens at the next checkpoint rather than at the next scheduled full snapshot.
+ */
+class SnapshotWriter {
+public:
+    /**
+     * @throw std::runtime_error if \c directory is empty or \c states is 0
+     */
+    explicit SnapshotWriter(SnapshotWriterOptions options);
+    ~SnapshotWriter();
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    void start();
+
+    /**
+     * @brief Writes what is still queued, then stops the thread. Idempotent.
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief Queues \p snapshot as the state named \p name. Safe from any thread.
+     */
+    void submit(std::string name, StateSnapshot snapshot);
+
+    /**
+     * @brief Whether the next snapshot of \p name must be full because a snapshot of its chain failed
+     */
+    bool needs_full(const std::string& name) const;
+
+    /**
+     * @brief Blocks until \p checkpoint (or a newer one) is complete, for at most \p timeout
+     *
+     * @return true if it completed
+     */
+    bool wait_for(CheckpointId checkpoint, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Newest checkpoint whose states are all durable
+     */
+    CheckpointId latest_completed() const noexcept { return latest_completed_.load(std::memory_order_acquire); }
+
+    SnapshotWriterStats stats() const noexcept;
+
+private:
+    struct Job {
+        std::string name;
+        StateSnapshot snapshot;
+    };
+
+    struct Progress {
+        std::size_t written = 0;
+        bool failed = false;
+    };
+
+    void run() noexcept;
+    void write(Job& job) noexcept;
+
+    const SnapshotWriterOptions options_;
+
+    std::thread thread_;
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable completed_;
+    std::deque<Job> queue_;
+    bool stopping_ = false;
+    std::set<std::string, std::less<>> broken_;         // states whose chain lost a snapshot
+
+    std::map<CheckpointId, Progress> progress_;         // writer thread only
+    std::atomic<CheckpointId> latest_completed_{tm::checkpoint::NO_CHECKPOINT};
+
+    std::atomic<std::uint64_t> snapshots_{0};
+    std::atomic<std::uint64_t> bytes_{0};
+    std::atomic<std::uint64_t> completed_count_{0};
+    std::atomic<std::uint64_t> failed_{0};
+};
+
+} // namespace lute::runtime::checkpoint
@@ -1,9 +1,326 @@
 #include <config/config.h>
+#include <numa/topology.h>
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
 
 namespace lute::runtime::config {
 
+using lute::tm::flow::Backpressure;
+using lute::tm::memory::HugePages;
+using lute::tm::memory::MemoryPlacement;
+using lute::tm::memory::NumaPolicy;
+
+static std::string_view trim(std::string_view s) {
+    const auto space = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+    while (!s.empty() && space(s.front())) s.remove_prefix(1);
+    while (!s.empty() && space(s.back())) s.remove_suffix(1);
+    return s;
+}
+
+template<typename Int>
+static Int parse_number(std::string_view text) {
+    Int value{};
+    const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (ec == std::errc::result_out_of_range) {
+        throw std::runtime_error("value '" + std::string(text) + "' is out of range");
+    }
+    if (ec != std::errc{} || end != text.data() + text.size()) {
+        throw std::runtime_error("expected an integer, got '" + std::string(text) + "'");
+    }
+    return value;
+}
+
+/**
+ * @brief Accepts a cpu list ("0-3,8") like sysfs or taskset -c, or a hex mask ("0xf0") like taskset
+ */
+static std::vector<int> parse_cpus(std::string_view text) {
+    if (text.empty() || text == "none") return {};
+
+    if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        std::vector<int> cpus;
+        int cpu = 0;
+        for (auto it = text.rbegin(); it != text.rend() - 2; ++it) {
+            const char c = *it;
+            if (c == ',' || c == '_') continue;     // long masks are often grouped per 32 bits
+
+            int nibble;
+            if (c >= '0' && c <= '9') nibble = c - '0';
+            else if (c >= 'a' && c <= 'f') nibble = c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') nibble = c - 'A' + 10;
+            else throw std::runtime_error("malformed cpu mask '" + std::string(text) + "'");
+
+            for (int bit = 0; bit < 4; ++bit, ++cpu) {
+                if (nibble & (1 << bit)) cpus.push_back(cpu);
+            }
+        }
+        std::sort(cpus.begin(), cpus.end());
+        return cpus;
+    }
+
+    return numa::parse_cpu_list(text);
+}
+
+template<typename Enum>
+static Enum parse_choice(std::string_view text, std::initializer_list<std::pair<std::string_view, Enum>> choices) {
+    std::string expected;
+    for (const auto& [name, value] : choices) {
+        if (text == name) return value;
+        expected += expected.empty() ? "" : ", ";
+        expected += name;
+    }
+    throw std::runtime_error("unknown value '" + std::string(text) + "', expected one of: " + expected);
+}
+
+static std::uint32_t parse_u32(std::string_view text) { return parse_number<std::uint32_t>(text); }
+static std::size_t parse_size(std::string_view text) { return parse_number<std::size_t>(text); }
+
+using Setter = std::function<void(AppConfig&, std::string_view)>;
+
+static const std::map<std::string, Setter, std::less<>>& setters() {
+    static const std::map<std::string, Setter, std::less<>> table {
+        // ---- Execution ----
+        { "execution.worker_threads", [](AppConfig& c, std::string_view v) { c.execution.worker_threads = parse_number<int>(v); } },
+        { "execution.worker_cpus", [](AppConfig& c, std::string_view v) { c.execution.worker_cpus = parse_cpus(v); } },
+        { "execution.control_cpus", [](AppConfig& c, std::string_view v) { c.execution.control_cpus = parse_cpus(v); } },
+
+        // ---- Backoff ----
+        { "backoff.spin_iterations", [](AppConfig& c, std::string_view v) { c.backoff.spin_iterations = parse_u32(v); } },
+        { "backoff.pause_iterations", [](AppConfig& c, std::string_view v) { c.backoff.pause_iterations = parse_u32(v); } },
+        { "backoff.park_timeout_us", [](AppConfig& c, std::string_view v) { c.backoff.park_timeout_us = parse_u32(v); } },
+
+        // ---- Channels ----
+        { "channels.capacity", [](AppConfig& c, std::string_view v) { c.channels.capacity = parse_size(v); } },
+        { "channels.mpsc_slots", [](AppConfig& c, std::string_view v) { c.channels.mpsc_slots = parse_size(v); } },
+        { "channels.mpsc_slot_payload", [](AppConfig& c, std::string_view v) { c.channels.mpsc_slot_payload = parse_size(v); } },
+        { "channels.batch_max_records", [](AppConfig& c, std::string_view v) { c.channels.batch_max_records = parse_size(v); } },
+        { "channels.batch_max_bytes", [](AppConfig& c, std::string_view v) { c.channels.batch_max_bytes = parse_size(v); } },
+        { "channels.batch_max_delay_us", [](AppConfig& c, std::string_view v) { c.channels.batch_max_delay_us = parse_u32(v); } },
+        { "channels.wait", [](AppConfig& c, std::string_view v) {
+            c.channels.wait = parse_choice<ChannelWait>(v, {
+                { "spin", ChannelWait::Spin },
+                { "park", ChannelWait::Park },
+            });
+        } },
+        { "channels.wait_spin_iterations", [](AppConfig& c, std::string_view v) { c.channels.wait_spin_iterations = parse_u32(v); } },
+
+        // ---- Gates ----
+        { "gates.capacity", [](AppConfig& c, std::string_view v) { c.gates.capacity = parse_size(v); } },
+        { "gates.fetch_batch", [](AppConfig& c, std::string_view v) { c.gates.fetch_batch = parse_size(v); } },
+        { "gates.cleanup", [](AppConfig& c, std::string_view v) {
+            c.gates.cleanup = parse_choice<GateCleanup>(v, {
+                { "synchronous", GateCleanup::Synchronous },
+                { "deferred", GateCleanup::Deferred },
+                { "signaled", GateCleanup::Signaled },
+                { "omitted", GateCleanup::Omitted },
+            });
+        } },
+
+        // ---- Flow ----
+        { "flow.backpressure", [](AppConfig& c, std::string_view v) {
+            c.flow.backpressure = parse_choice<Backpressure>(v, {
+                { "block", Backpressure::Block },
+                { "spill", Backpressure::Spill },
+                { "shed", Backpressure::Shed },
+            });
+        } },
+        { "flow.spill_bytes", [](AppConfig& c, std::string_view v) { c.flow.spill_bytes = parse_size(v); } },
+        { "flow.grant_batch", [](AppConfig& c, std::string_view v) { c.flow.grant_batch = parse_u32(v); } },
+
+        // ---- Memory ----
+        { "memory.numa_node", [](AppConfig& c, std::string_view v) {
+            c.memory.node = v == "any" ? MemoryPlacement::ANY_NODE : parse_number<int>(v);
+        } },
+        { "memory.numa_policy", [](AppConfig& c, std::string_view v) {
+            c.memory.policy = parse_choice<NumaPolicy>(v, {
+                { "first_touch", NumaPolicy::FirstTouch },
+                { "preferred", NumaPolicy::Preferred },
+                { "bind", NumaPolicy::Bind },
+            });
+        } },
+        { "memory.huge_pages", [](AppConfig& c, std::string_view v) {
+            c.memory.hugePages = parse_choice<HugePages>(v, {
+                { "never", HugePages::Never },
+                { "if_available", HugePages::IfAvailable },
+            });
+        } },
+
+        // ---- Transport ----
+        { "transport.io_threads", [](AppConfig& c, std::string_view v) { c.transport.io_threads = parse_size(v); } },
+        { "transport.io_cpus", [](AppConfig& c, std::string_view v) { c.transport.io_cpus = parse_cpus(v); } },
+        { "transport.ring_bytes", [](AppConfig& c, std::string_view v) { c.transport.ring_bytes = parse_size(v); } },
+        { "transport.max_write_bytes", [](AppConfig& c, std::string_view v) { c.transport.max_write_bytes = parse_size(v); } },
+
+        // ---- Sim ----
+        { "sim.action", [](AppConfig& c, std::string_view v) {
+            c.sim.action = parse_choice<SimAction>(v, {
+                { "record", SimAction::Record },
+                { "replay", SimAction::Replay },
+            });
+        } },
+        { "sim.log_path", [](AppConfig& c, std::string_view v) { c.sim.log_path = std::string(v); } },
+
+        // ---- Logging ----
+        { "logging.level", [](AppConfig& c, std::string_view v) {
+            c.logging.level = parse_choice<logging::LogLevel>(v, {
+                { "trace", logging::LogLevel::Trace },
+                { "debug", logging::LogLevel::Debug },
+                { "info", logging::LogLevel::Info },
+                { "warn", logging::LogLevel::Warn },
+                { "error", logging::LogLevel::Error },
+                { "off", logging::LogLevel::Off },
+            });
+        } },
+        { "logging.path", [](AppConfig& c, std::string_view v) { c.logging.path = std::string(v); } },
+        { "logging.ring_bytes", [](AppConfig& c, std::string_view v) { c.logging.ring_bytes = parse_size(v); } },
+        { "logging.flush_interval_ms", [](AppConfig& c, std::string_view v) { c.logging.flush_interval_ms = parse_u32(v); } },
+
+        // ---- Tracing ----
+        { "tracing.path", [](AppConfig& c, std::string_view v) { c.tracing.path = std::string(v); } },
+        { "tracing.ring_events", [](AppConfig& c, std::string_view v) { c.tracing.ring_events = parse_size(v); } },
+
+        // ---- Metrics ----
+        { "metrics.interval_ms", [](AppConfig& c, std::string_view v) { c.metrics.interval_ms = parse_u32(v); } },
+        { "metrics.path", [](AppConfig& c, std::string_view v) { c.metrics.path = std::string(v); } },
+        { "metrics.format", [](AppConfig& c, std::string_view v) {
+            c.metrics.format = parse_choice<metrics::MetricsFormat>(v, {
+                { "text", metrics::MetricsFormat::Text },
+                { "json", metrics::MetricsFormat::Json },
+            });
+        } },
+    };
+    return table;
+}
+
+static bool is_power_of_two(const std::size_t value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+static void require(const bool condition, const std::string& message) {
+    if (!condition) throw std::runtime_error("Invalid config: " + message);
+}
+
+AppConfig parse_config(std::istream& in, const std::string& source) {
+    AppConfig config{};
+    std::set<std::string, std::less<>> seen;
+
+    std::string section;
+    std::string line;
+    int line_number = 0;
+
+    while (std::getline(in, line)) {
+        ++line_number;
+        const std::string where = source + ":" + std::to_string(line_number) + ": ";
+
+        std::string_view text = line;
+        if (const std::size_t comment = text.find('#'); comment != std::string_view::npos) {
+            text = text.substr(0, comment);
+        }
+        text = trim(text);
+        if (text.empty()) continue;
+
+        if (text.front() == '[') {
+            if (text.back() != ']') throw std::runtime_error(where + "unterminated section header");
+            section = std::string(trim(text.substr(1, text.size() - 2)));
+            continue;
+        }
+
+        const std::size_t equals = text.find('=');
+        if (equals == std::string_view::npos) throw std::runtime_error(where + "expected 'key = value'");
+        if (section.empty()) throw std::runtime_error(where + "key outside of a [section]");
+
+        const std::string key = section + "." + std::string(trim(text.substr(0, equals)));
+        const std::string_view value = trim(text.substr(equals + 1));
+
+        const auto setter = setters().find(key);
+        if (setter == setters().end()) throw std::runtime_error(where + "unknown key '" + key + "'");
+        if (!seen.insert(key).second) throw std::runtime_error(where + "duplicate key '" + key + "'");
+
+        try {
+            setter->second(config, value);
+        } catch (const std::runtime_error& e) {
+            throw std::runtime_error(where + key + ": " + e.what());
+        }
+    }
+
+    return config;
+}
+
+void validate(const AppConfig& config) {
+    const ExecutionConfig& exec = config.execution;
+    require(exec.worker_threads > 0, "execution.worker_threads must be at least 1");
+    require(exec.worker_cpus.empty() || exec.worker_cpus.size() >= static_cast<std::size_t>(exec.worker_threads),
+            "execution.worker_cpus needs one CPU per worker thread (" + std::to_string(exec.worker_threads) + ")");
+    require(std::set<int>(exec.worker_cpus.begin(), exec.worker_cpus.end()).size() == exec.worker_cpus.size(),
+            "execution.worker_cpus lists a CPU twice");
+    for (const int cpu : exec.control_cpus) {
+        require(std::find(exec.worker_cpus.begin(), exec.worker_cpus.end(), cpu) == exec.worker_cpus.end(),
+                "CPU " + std::to_string(cpu) + " is in both execution.control_cpus and execution.worker_cpus");
+    }
+
+    require(config.backoff.park_timeout_us > 0, "backoff.park_timeout_us must be positive");
+
+    const ChannelConfig& channels = config.channels;
+    require(is_power_of_two(channels.capacity) && channels.capacity >= 64,
+            "channels.capacity must be a power of two of at least 64 bytes");
+    require(is_power_of_two(channels.mpsc_slots), "channels.mpsc_slots must be a power of two");
+    require(channels.mpsc_slot_payload > 0 && channels.mpsc_slot_payload <= std::numeric_limits<std::uint32_t>::max(),
+            "channels.mpsc_slot_payload must be between 1 and 2^32-1 bytes");
+    require(channels.batch_max_records > 0, "channels.batch_max_records must be at least 1");
+    require(channels.batch_max_bytes > 0 && channels.batch_max_bytes <= channels.capacity,
+            "channels.batch_max_bytes must be between 1 and channels.capacity");
+
+    require(is_power_of_two(config.gates.capacity), "gates.capacity must be a power of two");
+    require(config.gates.fetch_batch > 0 && config.gates.fetch_batch <= config.gates.capacity,
+            "gates.fetch_batch must be between 1 and gates.capacity");
+
+    require(config.flow.grant_batch <= config.gates.capacity, "flow.grant_batch must not exceed gates.capacity");
+    require(config.flow.backpressure != Backpressure::Spill || config.flow.spill_bytes >= 64,
+            "flow.spill_bytes must be at least 64 bytes when flow.backpressure = spill");
+
+    const MemoryPlacement& memory = config.memory;
+    require(memory.node >= MemoryPlacement::ANY_NODE, "memory.numa_node must be 'any' or a node id");
+    require(memory.policy != NumaPolicy::Bind || memory.node != MemoryPlacement::ANY_NODE,
+            "memory.numa_policy = bind needs an explicit memory.numa_node");
+
+    const transport::TransportOptions& transport = config.transport;
+    require(transport.io_threads > 0, "transport.io_threads must be at least 1");
+    require(is_power_of_two(transport.ring_bytes) && transport.ring_bytes >= 64,
+            "transport.ring_bytes must be a power of two of at least 64 bytes");
+    require(transport.max_write_bytes > 0, "transport.max_write_bytes must be positive");
+    for (const int cpu : transport.io_cpus) {
+        require(std::find(exec.worker_cpus.begin(), exec.worker_cpus.end(), cpu) == exec.worker_cpus.end(),
+                "CPU " + std::to_string(cpu) + " is in both transport.io_cpus and execution.worker_cpus");
+    }
+
+    require(!config.sim.log_path.empty(), "sim.log_path must not be empty");
+
+    require(is_power_of_two(config.logging.ring_bytes) && config.logging.ring_bytes >= 1024,
+            "logging.ring_bytes must be a power of two of at least 1024 bytes");
+    require(config.logging.flush_interval_ms > 0, "logging.flush_interval_ms must be positive");
+
+    require(!config.tracing.path.empty(), "tracing.path must not be empty");
+    require(is_power_of_two(config.tracing.ring_events), "tracing.ring_events must be a power of two");
+}
+
 AppConfig load_config(const std::string& config_path) {
-    return AppConfig {};
+    std::ifstream in(config_path);
+    if (!in) {
+        throw std::runtime_error("Cannot open config file: " + config_path);
+    }
+
+    AppConfig config = parse_config(in, config_path);
+    validate(config);
+    return config;
 }
 
-} // namespace lute::runtime::config
\ No newline at end of file
+} // namespace lute::runtime::config
@@ -1,12 +1,138 @@
 #pragma once
+
+#include <logging/log_config.h>
+#include <metrics/metrics_config.h>
+#include <transport/transport.h>
+#include <flow/EdgePolicy.h>
+#include <memory/MemoryPlacement.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
 #include <string>
+#include <vector>
 
 namespace lute::runtime::config {
 
+/**
+ * @brief Where InputGate cleanup runs; selects the gate's CleanupPolicy when the job graph is deployed
+ */
+enum class GateCleanup : std::uint8_t {
+    Synchronous,
+    Deferred,
+    Signaled,
+    Omitted,
+};
+
+/**
+ * @brief How threads that own a channel end will wait on it; \c Park is meant to wrap the channel in a
+ * WaitableChannel. Reserved with the rest of \ref ChannelConfig
+ */
+enum class ChannelWait : std::uint8_t {
+    Spin,
+    Park,
+};
+
+/**
+ * @brief What a \c --mode sim run does with \c sim.log_path
+ */
+enum class SimAction : std::uint8_t {
+    Record,
+    Replay,
+};
+
+struct ExecutionConfig {
+    int worker_threads = 1;
+    std::vector<int> worker_cpus;           // one CPU per data-plane worker; empty = unpinned
+    std::vector<int> control_cpus;          // control-plane threads; must not overlap worker_cpus
+};
+
+struct BackoffConfig {
+    std::uint32_t spin_iterations = 1000;
+    std::uint32_t pause_iterations = 10000;
+    std::uint32_t park_timeout_us = 100;
+};
+
+/**
+ * @brief Reserved: parsed and validated, but not read until job graphs deploy their channels
+ */
+struct ChannelConfig {
+    std::size_t capacity = 1 << 20;         // SPSC ring bytes, power of two
+    std::size_t mpsc_slots = 1024;          // power of two
+    std::size_t mpsc_slot_payload = 256;
+    std::size_t batch_max_records = 64;
+    std::size_t batch_max_bytes = 16 * 1024;
+    std::uint32_t batch_max_delay_us = 50;
+    ChannelWait wait = ChannelWait::Spin;
+    std::uint32_t wait_spin_iterations = 1000;  // polls before a parking waiter sleeps
+};
+
+/**
+ * @brief Reserved: parsed and validated, but not read until job graphs deploy their gates
+ */
+struct GateConfig {
+    std::size_t capacity = 4096;            // records, power of two
+    std::size_t fetch_batch = 64;
+    GateCleanup cleanup = GateCleanup::Synchronous;
+};
+
+/**
+ * @brief Default credit flow control of an edge; \c backpressure can be overridden per edge at deployment
+ *
+ * Reserved: parsed and validated, but not read until job graphs deploy their edges
+ */
+struct FlowConfig {
+    lute::tm::flow::Backpressure backpressure = lute::tm::flow::Backpressure::Block;
+    std::size_t spill_bytes = 1 << 20;      // per-edge overflow buffer for backpressure = spill
+    std::uint32_t grant_batch = 0;          // records committed per credit grant; 0 = gates.capacity / 4
+};
+
+/**
+ * @brief Record/replay log of \c --mode sim; ignored in the other modes
+ */
+struct SimConfig {
+    SimAction action = SimAction::Record;
+    std::string log_path = "lute-replay.log";
+};
+
+struct TracingConfig {
+    std::string path = "lute-trace.json";   // Chrome trace JSON, written on shutdown and on SIGUSR2
+    std::size_t ring_events = 64 * 1024;    // per-thread flight recorder, power of two
+};
+
 struct AppConfig {
-    int worker_threads;
+    ExecutionConfig execution;
+    BackoffConfig backoff;
+    ChannelConfig channels;
+    GateConfig gates;
+    FlowConfig flow;
+    lute::tm::memory::MemoryPlacement memory;       // reserved, like channels, gates and flow
+
+    transport::TransportOptions transport;          // reserved until remote edges are deployed
+    SimConfig sim;
+    logging::LogConfig logging;
+    TracingConfig tracing;
+    metrics::MetricsConfig metrics;
 };
 
+/**
+ * @brief Reads and validates the config file at \p path
+ *
+ * @throw std::runtime_error if the file cannot be read, does not parse, or fails \ref validate
+ */
 AppConfig load_config(const std::string& path);
 
-} // namespace lute::runtime::config
\ No newline at end of file
+/**
+ * @brief Parses the INI-style config format; see configs/prod/taskmanager.conf. Keys that are absent keep
+ * their defaults, unknown sections or keys are errors.
+ *
+ * @param source Name used in error messages
+ */
+AppConfig parse_config(std::istream& in, const std::string& source = "<config>");
+
+/**
+ * @throw std::runtime_error describing the first value that cannot work at runtime
+ */
+void validate(const AppConfig& config);
+
+} // namespace lute::runtime::config
@@ -0,0 +1,14 @@
+#include <exec/backoff.h>
+
+namespace lute::runtime::exec {
+
+void park_on(const std::atomic<std::uint32_t>& word, const std::uint32_t expected,
+             const std::chrono::microseconds timeout) noexcept {
+    core::futex_wait(word, expected, timeout);
+}
+
+void unpark_all(const std::atomic<std::uint32_t>& word) noexcept {
+    core::futex_wake(word);
+}
+
+} // namespace lute::runtime::exec
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <futex.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace lute::runtime::exec {
+
+/**
+ * @struct BackoffPolicy
+ * @brief Idle strategy of a data-plane worker: busy-spin, then spin with a pause hint, then park
+ *
+ * Spinning keeps wake-up latency at a few nanoseconds, pausing stops the idle core from starving its
+ * hyper-thread sibling and the memory bus, parking gives the core back to the OS for low-rate streams.
+ */
+struct BackoffPolicy {
+    std::uint32_t spin_iterations = 1000;
+    std::uint32_t pause_iterations = 10000;
+    std::chrono::microseconds park_timeout{100};
+};
+
+using core::cpu_relax;
+
+/**
+ * @brief Parks the calling thread on \p word while it still holds \p expected, for at most \p timeout
+ */
+void park_on(const std::atomic<std::uint32_t>& word, std::uint32_t expected,
+             std::chrono::microseconds timeout) noexcept;
+
+/**
+ * @brief Wakes every thread parked on \p word
+ */
+void unpark_all(const std::atomic<std::uint32_t>& word) noexcept;
+
+/**
+ * @class Backoff
+ * @brief Per-worker idle state machine driven by \ref BackoffPolicy
+ */
+class Backoff {
+public:
+    enum class Stage : std::uint8_t { Spin, Pause, Park };
+
+    explicit Backoff(const BackoffPolicy& policy) noexcept
+        : policy_(policy)
+    {}
+
+    /**
+     * @brief Called after a poll round that found no work
+     *
+     * @param doorbell Word the worker parks on; ringing it ends the park early
+     * @param ticket Value of \p doorbell read before the poll round, so a ring that raced with the
+     * round makes the park return immediately instead of being lost
+     * @return Stage that was applied
+     */
+    Stage idle(const std::atomic<std::uint32_t>& doorbell, const std::uint32_t ticket) noexcept {
+        if (idle_rounds_ < policy_.spin_iterations) {
+            ++idle_rounds_;
+            return Stage::Spin;
+        }
+
+        if (idle_rounds_ < policy_.spin_iterations + policy_.pause_iterations) {
+            ++idle_rounds_;
+            cpu_relax();
+            return Stage::Pause;
+        }
+
+        park_on(doorbell, ticket, policy_.park_timeout);
+        return Stage::Park;
+    }
+
+    /**
+     * @brief Called after a poll round that did work
+     */
+    void reset() noexcept { idle_rounds_ = 0; }
+
+    /**
+     * @return true if the next idle round parks
+     */
+    bool parking() const noexcept {
+        return idle_rounds_ >= policy_.spin_iterations + policy_.pause_iterations;
+    }
+
+private:
+    const BackoffPolicy policy_;
+    std::uint32_t idle_rounds_ = 0;
+};
+
+} // namespace lute::runtime::exec
@@ -0,0 +1,47 @@
+#include <exec/cpu_affinity.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace lute::runtime::exec {
+
+void pin_current_thread(const std::vector<int>& cpus) {
+    pin_thread(::pthread_self(), cpus);
+}
+
+void pin_thread(const pthread_t thread, const std::vector<int>& cpus) {
+    if (cpus.empty()) return;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const int cpu : cpus) {
+        if (cpu < 0 || cpu >= CPU_SETSIZE) {
+            throw std::runtime_error("CPU id out of range: " + std::to_string(cpu));
+        }
+        CPU_SET(static_cast<std::size_t>(cpu), &set);
+    }
+
+    const int rc = ::pthread_setaffinity_np(thread, sizeof(set), &set);
+    if (rc != 0) {
+        throw std::runtime_error("pthread_setaffinity_np failed: " + std::string(std::strerror(rc)));
+    }
+}
+
+std::vector<int> current_thread_affinity() {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    std::vector<int> cpus;
+    if (::pthread_getaffinity_np(::pthread_self(), sizeof(set), &set) != 0) return cpus;
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(static_cast<std::size_t>(cpu), &set)) cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+} // namespace lute::runtime::exec
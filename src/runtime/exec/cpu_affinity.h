@@ -0,0 +1,26 @@
+#pragma once
+
+#include <pthread.h>
+
+#include <vector>
+
+namespace lute::runtime::exec {
+
+/**
+ * @brief Restricts the calling thread to \p cpus. An empty set leaves the affinity untouched.
+ *
+ * @throw std::runtime_error if the kernel rejects the mask (offline or out-of-cpuset CPUs)
+ */
+void pin_current_thread(const std::vector<int>& cpus);
+
+/**
+ * @brief Restricts \p thread to \p cpus; same contract as \ref pin_current_thread
+ */
+void pin_thread(pthread_t thread, const std::vector<int>& cpus);
+
+/**
+ * @brief CPUs the calling thread is currently allowed to run on
+ */
+std::vector<int> current_thread_affinity();
+
+} // namespace lute::runtime::exec
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <exec/task.h>
+
+#include <channels/ChannelConcept.h>
+#include <channels/RecordFraming.h>
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace lute::runtime::exec {
+
+/**
+ * @class OperatorTask
+ * @brief Channel → operator → channel step over framed records
+ *
+ * Each \ref poll fetches up to \c max_batch frames from the input channel in place, hands every record to
+ * the operator together with the output writer, releases what was consumed and gives the output writer a
+ * chance to publish on its delay budget. The operator returns false when it could not emit (output full);
+ * the remaining frames stay in the input channel for the next poll, so backpressure propagates upstream.
+ *
+ * @tparam Operator callable as <tt>bool(std::span<const std::byte>, FramedWriter<Out>&)</tt>
+ */
+template<tm::channels::ZeroCopyChannel In, tm::channels::ZeroCopyChannel Out, typename Operator>
+    requires std::invocable<Operator&, std::span<const std::byte>, tm::channels::FramedWriter<Out>&>
+class OperatorTask final : public Task {
+public:
+    OperatorTask(In& input, Out& output, Operator op,
+                 const tm::channels::BatchPolicy output_batching = {}, const std::size_t max_batch = 64)
+        : reader_(input),
+          writer_(output, output_batching),
+          op_(std::move(op)),
+          max_batch_(max_batch)
+    {}
+
+    std::size_t poll() override {
+        const tm::channels::FrameBatch batch = reader_.fetch(max_batch_);
+        if (batch.empty()) {
+            writer_.poll();
+            return 0;
+        }
+
+        std::size_t processed = 0;
+        auto it = batch.begin();
+        for (; it != batch.end(); ++it) {
+            if (!op_((*it).payload, writer_)) break;
+            ++processed;
+        }
+
+        reader_.release(batch.prefix(it, processed));
+        writer_.poll();
+        return processed;
+    }
+
+    /**
+     * @brief Publishes any output still held back by the batch policy, e.g. before shutdown
+     */
+    void flush() noexcept { writer_.flush(); }
+
+private:
+    tm::channels::FramedReader<In> reader_;
+    tm::channels::FramedWriter<Out> writer_;
+    Operator op_;
+    const std::size_t max_batch_;
+};
+
+} // namespace lute::runtime::exec
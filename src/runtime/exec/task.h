@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+
+namespace lute::runtime::exec {
+
+/**
+ * @class Task
+ * @brief Unit of data-plane work scheduled on a worker: one channel → operator → channel step
+ *
+ * Tasks are bound to a single worker for their whole life (no work stealing), so \ref poll is never
+ * called concurrently and implementations need no synchronisation beyond their channels.
+ */
+class Task {
+public:
+    virtual ~Task() = default;
+
+    /**
+     * @brief Runs one bounded round of work
+     *
+     * @return Number of records processed; 0 tells the worker this task is idle
+     */
+    virtual std::size_t poll() = 0;
+};
+
+} // namespace lute::runtime::exec
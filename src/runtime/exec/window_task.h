@@ -0,0 +1,71 @@
+#pragma once
+
+#include <exec/task.h>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace lute::runtime::exec {
+
+/**
+ * @class WindowTask
+ * @brief InputGate → sliding window step
+ *
+ * Each \ref poll fetches up to \c max_batch records from the gate in place, extracts their timestamps and
+ * values into two preallocated columns, hands both to the window in one \c insert_batch call, commits the
+ * batch and emits the window's result as of the batch's last record. Use \c max_batch = 1 for one result per
+ * record.
+ *
+ * @tparam Window \ref tm::windows::MonoidWindow or \ref tm::windows::AbelianWindow
+ * @tparam Extract callable as <tt>std::pair<std::uint64_t, Window::input_type>(const record_type&)</tt>
+ * @tparam Emit callable as <tt>void(std::uint64_t timestamp, const Window::Results&)</tt>
+ */
+template<typename Gate, typename Window, typename Extract, typename Emit>
+    requires std::invocable<Extract&, const typename Gate::record_type&>
+          && std::invocable<Emit&, std::uint64_t, const typename Window::Results&>
+class WindowTask final : public Task {
+public:
+    WindowTask(Gate& gate, Window window, Extract extract, Emit emit, const std::size_t max_batch = 64)
+        : gate_(gate),
+          window_(std::move(window)),
+          extract_(std::move(extract)),
+          emit_(std::move(emit)),
+          max_batch_(max_batch),
+          timestamps_(max_batch),
+          values_(max_batch)
+    {}
+
+    std::size_t poll() override {
+        const auto batch = gate_.fetch(max_batch_);
+        const std::size_t count = batch.recordCount;
+        if (count == 0) return 0;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            std::tie(timestamps_[i], values_[i]) = extract_(std::as_const(batch.data[i]));
+        }
+
+        window_.insert_batch(timestamps_.data(), values_.data(), count);
+        gate_.commit(count);
+
+        emit_(timestamps_[count - 1], window_.results());
+        return count;
+    }
+
+    Window& window() noexcept { return window_; }
+
+private:
+    Gate& gate_;
+    Window window_;
+    Extract extract_;
+    Emit emit_;
+    const std::size_t max_batch_;
+
+    std::vector<std::uint64_t> timestamps_;
+    std::vector<typename Window::input_type> values_;
+};
+
+} // namespace lute::runtime::exec
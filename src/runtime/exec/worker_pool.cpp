@@ -0,0 +1,143 @@
+#include <exec/worker_pool.h>
+#include <exec/cpu_affinity.h>
+#include <logging/log.h>
+#include <counter.h>
+#include <trace.h>
+
+#include <pthread.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace lute::runtime::exec {
+
+// Counters have a single writer, the worker, so the hot path stays free of locked RMWs
+using core::bump;
+
+WorkerPool::WorkerPool(WorkerPoolOptions options)
+    : options_(std::move(options))
+{
+    if (options_.worker_threads == 0) {
+        throw std::runtime_error("Worker pool needs at least one worker thread");
+    }
+    if (!options_.worker_cpus.empty() && options_.worker_cpus.size() < options_.worker_threads) {
+        throw std::runtime_error("worker_cpus lists " + std::to_string(options_.worker_cpus.size()) +
+                                 " CPUs for " + std::to_string(options_.worker_threads) + " worker threads");
+    }
+
+    workers_.reserve(options_.worker_threads);
+    for (std::size_t i = 0; i < options_.worker_threads; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    stop();
+}
+
+void WorkerPool::assign(const std::size_t worker, Task& task) {
+    if (running_.load()) {
+        throw std::runtime_error("Tasks must be assigned before the worker pool starts");
+    }
+    workers_.at(worker)->tasks.push_back(&task);
+}
+
+void WorkerPool::start() {
+    if (running_.exchange(true)) return;
+    released_.store(false);
+
+    try {
+        for (std::size_t i = 0; i < workers_.size(); ++i) {
+            Worker& worker = *workers_[i];
+            worker.thread = std::thread([this, &worker]() { run(worker); });
+            ::pthread_setname_np(worker.thread.native_handle(), ("lute-worker-" + std::to_string(i)).c_str());
+
+            if (!options_.worker_cpus.empty()) {
+                pin_thread(worker.thread.native_handle(), { options_.worker_cpus[i] });
+            }
+        }
+    } catch (...) {
+        stop();
+        throw;
+    }
+
+    // Workers only start polling once all of them are pinned
+    released_.store(true, std::memory_order_release);
+}
+
+void WorkerPool::stop() noexcept {
+    running_.store(false);
+    released_.store(true, std::memory_order_release);
+
+    for (auto& worker : workers_) {
+        worker->doorbell.fetch_add(1, std::memory_order_release);
+        unpark_all(worker->doorbell);
+    }
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) worker->thread.join();
+    }
+}
+
+void WorkerPool::notify(const std::size_t worker) noexcept {
+    Worker& w = *workers_[worker];
+    w.doorbell.fetch_add(1, std::memory_order_release);
+
+    // Pairs with the fence in run: either the worker's park sees the new ticket and returns, or this sees
+    // the worker sleeping and wakes it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (w.sleeping.load(std::memory_order_relaxed)) unpark_all(w.doorbell);
+}
+
+WorkerUtilization WorkerPool::utilization(const std::size_t worker) const noexcept {
+    const Worker& w = *workers_[worker];
+    return WorkerUtilization {
+        .busy_polls = w.busy_polls.load(std::memory_order_relaxed),
+        .idle_polls = w.idle_polls.load(std::memory_order_relaxed),
+        .work_items = w.work_items.load(std::memory_order_relaxed),
+        .parks = w.parks.load(std::memory_order_relaxed),
+    };
+}
+
+void WorkerPool::run(Worker& worker) noexcept {
+    while (!released_.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+
+    // Allocate the log and trace rings before the loop; the hot path never allocates
+    logging::attach_current_thread();
+#if defined(CORE_TRACING_ENABLED)
+    core::trace::attach_current_thread();
+#endif
+
+    Backoff backoff(options_.backoff);
+
+    while (running_.load(std::memory_order_relaxed)) {
+        const std::uint32_t ticket = worker.doorbell.load(std::memory_order_acquire);
+
+        std::size_t work = 0;
+        for (Task* task : worker.tasks) {
+            work += task->poll();
+        }
+
+        if (work != 0) {
+            bump(worker.busy_polls);
+            bump(worker.work_items, work);
+            backoff.reset();
+            continue;
+        }
+
+        bump(worker.idle_polls);
+        if (!backoff.parking()) {
+            backoff.idle(worker.doorbell, ticket);
+            continue;
+        }
+
+        bump(worker.parks);
+        worker.sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        backoff.idle(worker.doorbell, ticket);
+        worker.sleeping.store(false, std::memory_order_relaxed);
+    }
+}
+
+} // namespace lute::runtime::exec
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <exec/backoff.h>
+#include <exec/task.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace lute::runtime::exec {
+
+struct WorkerPoolOptions {
+    std::size_t worker_threads = 1;
+    std::vector<int> worker_cpus;       // worker i is pinned to worker_cpus[i]; empty leaves workers unpinned
+    BackoffPolicy backoff;
+};
+
+/**
+ * @struct WorkerUtilization
+ * @brief Snapshot of one worker's counters; read by the control plane without stopping the worker
+ */
+struct WorkerUtilization {
+    std::uint64_t busy_polls;
+    std::uint64_t idle_polls;
+    std::uint64_t work_items;
+    std::uint64_t parks;
+
+    /**
+     * @return Fraction of poll rounds that found work
+     */
+    double utilization() const noexcept {
+        const std::uint64_t total = busy_polls + idle_polls;
+        return total == 0 ? 0.0 : static_cast<double>(busy_polls) / static_cast<double>(total);
+    }
+};
+
+/**
+ * @class WorkerPool
+ * @brief Fixed set of pinned data-plane threads, each looping over its own tasks
+ *
+ * Tasks are assigned before \ref start and stay on their worker. A worker that finds no work backs off
+ * according to \ref BackoffPolicy; \ref notify rings its doorbell to end a park early.
+ */
+class WorkerPool {
+public:
+    /**
+     * @throw std::runtime_error if \c worker_cpus is non-empty but shorter than \c worker_threads
+     */
+    explicit WorkerPool(WorkerPoolOptions options);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief Binds \p task to \p worker. The pool does not own the task. Only valid before \ref start.
+     */
+    void assign(std::size_t worker, Task& task);
+
+    /**
+     * @throw std::runtime_error if pinning a worker fails; already started workers are stopped again
+     */
+    void start();
+
+    /**
+     * @brief Stops and joins every worker. Idempotent.
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief Wakes \p worker if it is parked. Safe from any thread.
+     *
+     * Only a parked worker costs a wake syscall; ringing a busy or spinning one is an increment and a fence.
+     */
+    void notify(std::size_t worker) noexcept;
+
+    WorkerUtilization utilization(std::size_t worker) const noexcept;
+
+    std::size_t size() const noexcept { return workers_.size(); }
+
+private:
+    struct alignas(64) Worker {
+        std::vector<Task*> tasks;
+        std::thread thread;
+
+        alignas(64) std::atomic<std::uint32_t> doorbell{0};
+        std::atomic<bool> sleeping{false};      // set around a park, so notify skips the syscall otherwise
+
+        alignas(64) std::atomic<std::uint64_t> busy_polls{0};
+        std::atomic<std::uint64_t> idle_polls{0};
+        std::atomic<std::uint64_t> work_items{0};
+        std::atomic<std::uint64_t> parks{0};
+    };
+
+    void run(Worker& worker) noexcept;
+
+    const WorkerPoolOptions options_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    std::atomic<bool> running_{false};
+    std::atomic<bool> released_{false};
+};
+
+} // namespace lute::runtime::exec
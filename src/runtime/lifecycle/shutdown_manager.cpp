@@ -1,5 +1,23 @@
 #include <lifecycle/shutdown_manager.h>
 
+#include <thread>
+
 namespace lute::runtime::lifecycle {
 
-} // lute::runtime::lifecycle
\ No newline at end of file
+std::atomic<bool> ShutdownManager::requested_{false};
+
+void ShutdownManager::request_shutdown() noexcept {
+    requested_.store(true, std::memory_order_release);
+}
+
+bool ShutdownManager::shutdown_requested() noexcept {
+    return requested_.load(std::memory_order_acquire);
+}
+
+void ShutdownManager::wait_for_shutdown(const std::chrono::milliseconds poll_interval) {
+    while (!shutdown_requested()) {
+        std::this_thread::sleep_for(poll_interval);
+    }
+}
+
+} // lute::runtime::lifecycle
@@ -1,12 +1,32 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+
 namespace lute::runtime::lifecycle {
 
+/**
+ * @class ShutdownManager
+ * @brief Process-wide shutdown flag shared by signal handlers and the control plane
+ */
 class ShutdownManager {
 public:
-    
+    /**
+     * @brief Requests an orderly shutdown. Async-signal-safe.
+     */
+    static void request_shutdown() noexcept;
+
+    static bool shutdown_requested() noexcept;
+
+    /**
+     * @brief Blocks the calling control-plane thread until shutdown is requested
+     */
+    static void wait_for_shutdown(std::chrono::milliseconds poll_interval = std::chrono::milliseconds(50));
+
 private:
+    static std::atomic<bool> requested_;
 
+    static_assert(std::atomic<bool>::is_always_lock_free, "Signal handlers need a lock-free flag");
 };
 
-} // lute::runtime::lifecycle
\ No newline at end of file
+} // lute::runtime::lifecycle
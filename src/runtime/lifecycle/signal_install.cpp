@@ -1,10 +1,38 @@
 #include <lifecycle/signal_install.h>
+#include <lifecycle/shutdown_manager.h>
+#include <tracing/trace_dump.h>
+
+#include <csignal>
+#include <cstring>
+#include <stdexcept>
+#include <string>
 
 namespace lute::runtime::lifecycle
 {
-    
+
+static void on_shutdown_signal(int) {
+    ShutdownManager::request_shutdown();
+}
+
+static void on_trace_dump_signal(int) {
+    tracing::request_trace_dump();
+}
+
+static void install(const int signal_number, void (*handler)(int)) {
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = handler;
+    sigemptyset(&action.sa_mask);
+
+    if (::sigaction(signal_number, &action, nullptr) != 0) {
+        throw std::runtime_error("Failed to install handler for signal " + std::to_string(signal_number));
+    }
+}
+
 void setup_signal_handlers() {
-    
+    install(SIGINT, on_shutdown_signal);
+    install(SIGTERM, on_shutdown_signal);
+    install(SIGUSR2, on_trace_dump_signal);
 }
 
 } // namespace lute::runtime::lifecycle
@@ -0,0 +1,49 @@
+#include <logging/backends/file_backend.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace lute::runtime::logging {
+
+FileBackend::FileBackend(const std::string& path)
+    : fd_(STDERR_FILENO),
+      owns_fd_(false)
+{
+    if (!path.empty()) {
+        fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (fd_ < 0) {
+            throw std::runtime_error("Cannot open log file " + path + ": " + std::strerror(errno));
+        }
+        owns_fd_ = true;
+    }
+    buffer_.reserve(FLUSH_THRESHOLD * 2);
+}
+
+FileBackend::~FileBackend() {
+    flush();
+    if (owns_fd_) ::close(fd_);
+}
+
+void FileBackend::write(const std::string_view line) {
+    buffer_ += line;
+    if (buffer_.size() >= FLUSH_THRESHOLD) flush();
+}
+
+void FileBackend::flush() {
+    std::size_t written = 0;
+    while (written < buffer_.size()) {
+        const ssize_t n = ::write(fd_, buffer_.data() + written, buffer_.size() - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            break;      // Nowhere left to report it; drop the buffer rather than stall the formatter
+        }
+        written += static_cast<std::size_t>(n);
+    }
+    buffer_.clear();
+}
+
+} // lute::runtime::logging
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <logging/backends/log_backend.h>
+
+#include <string>
+
+namespace lute::runtime::logging {
+
+/**
+ * @class FileBackend
+ * @brief Appends lines to a file (or stderr) through a user-space buffer, one write(2) per flush
+ */
+class FileBackend final : public LogBackend {
+public:
+    /**
+     * @param path File to append to; created if missing. Empty writes to stderr.
+     *
+     * @throw std::runtime_error if the file cannot be opened
+     */
+    explicit FileBackend(const std::string& path);
+    ~FileBackend() override;
+
+    FileBackend(const FileBackend&) = delete;
+    FileBackend& operator=(const FileBackend&) = delete;
+
+    void write(std::string_view line) override;
+    void flush() override;
+
+private:
+    static constexpr std::size_t FLUSH_THRESHOLD = 64 * 1024;
+
+    int fd_;
+    bool owns_fd_;
+    std::string buffer_;
+};
+
+} // lute::runtime::logging
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string_view>
+
+namespace lute::runtime::logging {
+
+/**
+ * @class LogBackend
+ * @brief Sink for formatted log lines. Only ever called from the formatter thread.
+ */
+class LogBackend {
+public:
+    virtual ~LogBackend() = default;
+
+    /**
+     * @param line One formatted record including its trailing newline
+     */
+    virtual void write(std::string_view line) = 0;
+
+    /**
+     * @brief Called when the formatter runs out of records and before logging stops
+     */
+    virtual void flush() = 0;
+};
+
+} // lute::runtime::logging
@@ -0,0 +1,9 @@
+#include <logging/backends/null_backend.h>
+
+namespace lute::runtime::logging {
+
+void NullBackend::write(std::string_view) {}
+
+void NullBackend::flush() {}
+
+} // lute::runtime::logging
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <logging/backends/log_backend.h>
+
+namespace lute::runtime::logging {
+
+/**
+ * @class NullBackend
+ * @brief Discards every line; records are still drained and counted
+ */
+class NullBackend final : public LogBackend {
+public:
+    void write(std::string_view line) override;
+    void flush() override;
+};
+
+} // lute::runtime::logging
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <logging/log_config.h>
+
+#include <channels/InMemoryChannel.h>
+#include <channels/RecordFraming.h>
+#include <counter.h>
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Asynchronous binary logging.
+ *
+ * A call site expands to a \c static \c constexpr \ref lute::runtime::logging::LogSite holding the level,
+ * format string, source location and a decoder for the argument types; its address is the format ID.
+ * The calling thread only copies that ID, a timestamp and the raw arguments into its own SPSC ring:
+ * no formatting, no locks and, once the thread is attached, no allocation. When the ring is full the
+ * record is dropped and counted. A control-plane thread drains every ring, formats records and hands
+ * the lines to a \ref lute::runtime::logging::LogBackend.
+ *
+ * Format strings use \c {} placeholders; their count is checked against the arguments at compile time.
+ * Arguments may be arithmetic types, enums, pointers and strings (copied into the record).
+ *
+ * Without \c RUNTIME_LOGGING_ENABLED (CMake option \c ENABLE_LOGGING) the macros expand to nothing and
+ * their arguments are not evaluated.
+ */
+
+namespace lute::runtime::logging {
+
+class LogBackend;
+
+using FormatFn = void (*)(std::string& out, std::string_view format, const std::byte* args) noexcept;
+
+struct LogSite {
+    LogLevel level;
+    std::string_view format;
+    const char* file;
+    int line;
+    FormatFn format_args;
+};
+
+/**
+ * @struct LogStats
+ * @brief Totals over every thread ring since the process started
+ */
+struct LogStats {
+    std::uint64_t written;
+    std::uint64_t dropped;
+};
+
+namespace detail {
+
+inline std::atomic<LogLevel> g_min_level{LogLevel::Off};
+
+struct RecordHeader {
+    const LogSite* site;
+    std::int64_t timestamp_ns;
+};
+
+/**
+ * @brief Per-thread record ring. The owning thread is the only writer, the formatter the only reader.
+ */
+struct ThreadRing {
+    explicit ThreadRing(const std::size_t bytes)
+        : channel(bytes),
+          writer(channel, tm::channels::BatchPolicy{ .maxRecords = 1, .maxBytes = SIZE_MAX, .maxDelay = {} }),
+          reader(channel)
+    {}
+
+    tm::channels::InMemoryChannel channel;
+    tm::channels::FramedWriter<tm::channels::InMemoryChannel> writer;
+    tm::channels::FramedReader<tm::channels::InMemoryChannel> reader;
+
+    alignas(64) std::atomic<std::uint64_t> dropped{0};
+    std::atomic<bool> retired{false};
+
+    // Formatter-owned
+    alignas(64) std::uint64_t reported_dropped = 0;
+};
+
+inline thread_local ThreadRing* t_ring = nullptr;
+
+ThreadRing* attach_slow() noexcept;
+
+// ---- Argument wire format ----
+
+template<typename T>
+concept StringArg = std::is_convertible_v<const T&, std::string_view>;
+
+template<typename T>
+struct Wire { using type = T; };
+
+template<StringArg T>
+struct Wire<T> { using type = std::string_view; };
+
+template<typename T> requires std::is_enum_v<T>
+struct Wire<T> { using type = std::underlying_type_t<T>; };
+
+template<typename T> requires (std::is_pointer_v<T> && !StringArg<T>)
+struct Wire<T> { using type = const void*; };
+
+template<typename T>
+using wire_t = typename Wire<std::remove_cvref_t<std::decay_t<T>>>::type;
+
+template<typename T>
+concept WireType = std::is_arithmetic_v<T> || std::is_same_v<T, const void*> || std::is_same_v<T, std::string_view>;
+
+template<typename W, typename T>
+std::size_t encoded_size(const T& value) noexcept {
+    if constexpr (std::is_same_v<W, std::string_view>) {
+        return sizeof(std::uint32_t) + std::string_view(value).size();
+    } else {
+        return sizeof(W);
+    }
+}
+
+template<typename W, typename T>
+void encode(std::byte*& at, const T& value) noexcept {
+    if constexpr (std::is_same_v<W, std::string_view>) {
+        const std::string_view text(value);
+        const auto length = static_cast<std::uint32_t>(text.size());
+        std::memcpy(at, &length, sizeof(length));
+        std::memcpy(at + sizeof(length), text.data(), text.size());
+        at += sizeof(length) + text.size();
+    } else {
+        const W wire = static_cast<W>(value);
+        std::memcpy(at, &wire, sizeof(wire));
+        at += sizeof(wire);
+    }
+}
+
+template<typename W>
+W decode(const std::byte*& at) noexcept {
+    if constexpr (std::is_same_v<W, std::string_view>) {
+        std::uint32_t length;
+        std::memcpy(&length, at, sizeof(length));
+        const std::string_view text(reinterpret_cast<const char*>(at + sizeof(length)), length);
+        at += sizeof(length) + length;
+        return text;
+    } else {
+        W wire;
+        std::memcpy(&wire, at, sizeof(wire));
+        at += sizeof(wire);
+        return wire;
+    }
+}
+
+template<typename W>
+void append(std::string& out, const W value) noexcept {
+    if constexpr (std::is_same_v<W, std::string_view>) {
+        out += value;
+    } else if constexpr (std::is_same_v<W, bool>) {
+        out += value ? "true" : "false";
+    } else if constexpr (std::is_same_v<W, char>) {
+        out += value;
+    } else {
+        char buffer[32];
+        std::to_chars_result result;
+        if constexpr (std::is_same_v<W, const void*>) {
+            buffer[0] = '0';
+            buffer[1] = 'x';
+            result = std::to_chars(buffer + 2, std::end(buffer), reinterpret_cast<std::uintptr_t>(value), 16);
+        } else {
+            result = std::to_chars(buffer, std::end(buffer), value);
+        }
+        out.append(buffer, result.ptr);
+    }
+}
+
+constexpr std::size_t placeholder_count(const std::string_view format) noexcept {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i + 1 < format.size(); ++i) {
+        if (format[i] == '{' && format[i + 1] == '}') ++count;
+    }
+    return count;
+}
+
+template<WireType... Ws>
+struct Decoder {
+    static constexpr std::size_t arity = sizeof...(Ws);
+
+    static void format(std::string& out, std::string_view format, [[maybe_unused]] const std::byte* args) noexcept {
+        (append_next<Ws>(out, format, args), ...);
+        out += format;
+    }
+
+private:
+    template<typename W>
+    static void append_next(std::string& out, std::string_view& format, const std::byte*& args) noexcept {
+        const std::size_t at = format.find("{}");
+        out += format.substr(0, at);
+        format.remove_prefix(at + 2);
+        append(out, decode<W>(args));
+    }
+};
+
+/**
+ * @brief Unevaluated helper mapping call-site argument types to their \ref Decoder
+ */
+template<typename... Args>
+Decoder<wire_t<Args>...> decoder_of(const Args&...);
+
+inline std::int64_t now_ns() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace detail
+
+inline bool enabled(const LogLevel level) noexcept {
+    return level >= detail::g_min_level.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Writes one binary record into the calling thread's ring, or counts it as dropped
+ *
+ * @thread Any; never blocks
+ */
+template<typename... Args>
+void write_record(const LogSite& site, const Args&... args) noexcept {
+    detail::ThreadRing* ring = detail::t_ring != nullptr ? detail::t_ring : detail::attach_slow();
+    if (ring == nullptr) return;
+
+    const std::size_t size = sizeof(detail::RecordHeader) + (std::size_t{0} + ... + detail::encoded_size<detail::wire_t<Args>>(args));
+
+    const std::span<std::byte> slot = ring->writer.allocate(size);
+    if (slot.data() == nullptr) {
+        core::bump(ring->dropped);
+        return;
+    }
+
+    const detail::RecordHeader header{ &site, detail::now_ns() };
+    std::memcpy(slot.data(), &header, sizeof(header));
+
+    [[maybe_unused]] std::byte* at = slot.data() + sizeof(header);
+    (detail::encode<detail::wire_t<Args>>(at, args), ...);
+
+    ring->writer.commit();
+}
+
+/**
+ * @brief Starts the formatter thread writing to \p backend and enables records at \p config.level and above
+ *
+ * @throw std::runtime_error if logging is already running
+ */
+void start_logging(const LogConfig& config, std::unique_ptr<LogBackend> backend);
+
+/**
+ * @brief Disables records, drains every ring into the backend, flushes it and joins the formatter. Idempotent.
+ */
+void stop_logging() noexcept;
+
+/**
+ * @brief Allocates the calling thread's ring up front so its first log call does not allocate.
+ * Data-plane threads call it before entering their loop.
+ *
+ * @return false if the ring could not be allocated; the thread's records are then discarded
+ */
+bool attach_current_thread() noexcept;
+
+LogStats log_stats() noexcept;
+
+} // namespace lute::runtime::logging
+
+#if defined(RUNTIME_LOGGING_ENABLED)
+    #define RUNTIME_LOG(lvl, fmt, ...)                                                                                \
+        do {                                                                                                          \
+            using lute_log_decoder_ = decltype(::lute::runtime::logging::detail::decoder_of(__VA_ARGS__));            \
+            static_assert(::lute::runtime::logging::detail::placeholder_count(fmt) == lute_log_decoder_::arity,       \
+                          "Log format placeholders do not match the argument count");                                 \
+            if (::lute::runtime::logging::enabled(lvl)) {                                                             \
+                static constexpr ::lute::runtime::logging::LogSite lute_log_site_ {                                   \
+                    lvl, fmt, __FILE__, __LINE__, &lute_log_decoder_::format                                          \
+                };                                                                                                    \
+                ::lute::runtime::logging::write_record(lute_log_site_ __VA_OPT__(,) __VA_ARGS__);                     \
+            }                                                                                                         \
+        } while (false)
+#else
+    #define RUNTIME_LOG(...) ((void)(0))
+#endif
+
+#define RUNTIME_LOG_TRACE(...) RUNTIME_LOG(::lute::runtime::logging::LogLevel::Trace, __VA_ARGS__)
+#define RUNTIME_LOG_DEBUG(...) RUNTIME_LOG(::lute::runtime::logging::LogLevel::Debug, __VA_ARGS__)
+#define RUNTIME_LOG_INFO(...)  RUNTIME_LOG(::lute::runtime::logging::LogLevel::Info, __VA_ARGS__)
+#define RUNTIME_LOG_WARN(...)  RUNTIME_LOG(::lute::runtime::logging::LogLevel::Warn, __VA_ARGS__)
+#define RUNTIME_LOG_ERROR(...) RUNTIME_LOG(::lute::runtime::logging::LogLevel::Error, __VA_ARGS__)
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace lute::runtime::logging {
+
+enum class LogLevel : std::uint8_t {
+    Trace,
+    Debug,
+    Info,
+    Warn,
+    Error,
+    Off,
+};
+
+constexpr std::string_view level_name(const LogLevel level) noexcept {
+    switch (level) {
+        case LogLevel::Trace: return "TRACE";
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info:  return "INFO";
+        case LogLevel::Warn:  return "WARN";
+        case LogLevel::Error: return "ERROR";
+        case LogLevel::Off:   return "OFF";
+    }
+    return "?";
+}
+
+struct LogConfig {
+    LogLevel level = LogLevel::Info;
+    std::string path;                       // empty = stderr
+    std::size_t ring_bytes = 64 * 1024;     // per-thread record ring, power of two
+    std::uint32_t flush_interval_ms = 10;   // formatter sleep when every ring is empty
+};
+
+} // lute::runtime::logging
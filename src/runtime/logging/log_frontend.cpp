@@ -0,0 +1,211 @@
+#include <logging/log.h>
+#include <logging/backends/log_backend.h>
+
+#include <ctime>
+#include <mutex>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace lute::runtime::logging {
+
+using detail::ThreadRing;
+
+namespace {
+
+struct Frontend {
+    std::mutex mutex;       // guards rings and the backend; taken by the formatter and by thread attach
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    std::size_t ring_bytes = LogConfig{}.ring_bytes;
+    std::unique_ptr<LogBackend> backend;
+
+    std::thread formatter;
+    std::atomic<bool> running{false};
+    std::chrono::milliseconds flush_interval{10};
+
+    std::atomic<std::uint64_t> written{0};
+    std::atomic<std::uint64_t> retired_dropped{0};
+
+    std::string line;
+};
+
+// Never destroyed: threads may still log while static destructors run at exit
+Frontend& frontend() {
+    static Frontend* instance = new Frontend();
+    return *instance;
+}
+
+/**
+ * @brief Retires the ring when its thread exits; the formatter frees it once drained
+ */
+struct RingOwner {
+    std::shared_ptr<ThreadRing> ring;
+
+    ~RingOwner() {
+        if (ring) {
+            detail::t_ring = nullptr;
+            ring->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local RingOwner t_owner;
+
+void append_prefix(std::string& out, const detail::RecordHeader& header) {
+    const std::int64_t seconds = header.timestamp_ns / 1'000'000'000;
+    const auto micros = static_cast<int>((header.timestamp_ns % 1'000'000'000) / 1000);
+
+    const std::time_t time = static_cast<std::time_t>(seconds);
+    std::tm utc;
+    ::gmtime_r(&time, &utc);
+
+    char stamp[48];
+    const std::size_t n = std::strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%S", &utc);
+    out.append(stamp, n);
+    out += '.';
+    const std::string digits = std::to_string(micros);
+    out.append(6 - digits.size(), '0');
+    out += digits;
+    out += "Z ";
+
+    const std::string_view level = level_name(header.site->level);
+    out += level;
+    out.append(6 - level.size(), ' ');
+
+    std::string_view file = header.site->file;
+    if (const std::size_t slash = file.rfind('/'); slash != std::string_view::npos) file.remove_prefix(slash + 1);
+    out += file;
+    out += ':';
+    out += std::to_string(header.site->line);
+    out += ' ';
+}
+
+/**
+ * @return Number of records formatted
+ *
+ * @thread Formatter (or the stopping thread once the formatter has joined)
+ */
+std::size_t drain(Frontend& f) {
+    std::lock_guard lock(f.mutex);
+    std::size_t records = 0;
+
+    for (auto it = f.rings.begin(); it != f.rings.end();) {
+        ThreadRing& ring = **it;
+        const bool retired = ring.retired.load(std::memory_order_acquire);
+
+        // One batch per ring per pass, so a chatty thread cannot starve the others
+        const tm::channels::FrameBatch batch = ring.reader.fetch();
+        if (!batch.empty()) {
+            for (const tm::channels::Frame frame : batch) {
+                detail::RecordHeader header;
+                std::memcpy(&header, frame.payload.data(), sizeof(header));
+
+                f.line.clear();
+                append_prefix(f.line, header);
+                header.site->format_args(f.line, header.site->format, frame.payload.data() + sizeof(header));
+                f.line += '\n';
+                f.backend->write(f.line);
+            }
+
+            records += batch.size();
+            ring.reader.release(batch);
+        }
+
+        const std::uint64_t dropped = ring.dropped.load(std::memory_order_relaxed);
+        if (dropped != ring.reported_dropped) {
+            f.backend->write("log ring overflow: " + std::to_string(dropped - ring.reported_dropped) +
+                             " records dropped\n");
+            ring.reported_dropped = dropped;
+        }
+
+        if (retired && ring.reader.fetch().empty()) {
+            f.retired_dropped.fetch_add(dropped, std::memory_order_relaxed);
+            it = f.rings.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    f.written.fetch_add(records, std::memory_order_relaxed);
+    return records;
+}
+
+void run_formatter(Frontend& f) {
+    while (f.running.load(std::memory_order_acquire)) {
+        if (drain(f) == 0) {
+            {
+                std::lock_guard lock(f.mutex);
+                f.backend->flush();
+            }
+            std::this_thread::sleep_for(f.flush_interval);
+        }
+    }
+}
+
+} // namespace
+
+namespace detail {
+
+ThreadRing* attach_slow() noexcept {
+    try {
+        Frontend& f = frontend();
+        std::lock_guard lock(f.mutex);
+
+        t_owner.ring = std::make_shared<ThreadRing>(f.ring_bytes);
+        f.rings.push_back(t_owner.ring);
+        t_ring = t_owner.ring.get();
+        return t_ring;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+} // namespace detail
+
+bool attach_current_thread() noexcept {
+    return detail::t_ring != nullptr || detail::attach_slow() != nullptr;
+}
+
+void start_logging(const LogConfig& config, std::unique_ptr<LogBackend> backend) {
+    Frontend& f = frontend();
+    if (f.running.exchange(true)) {
+        throw std::runtime_error("Logging is already running");
+    }
+
+    {
+        std::lock_guard lock(f.mutex);
+        f.backend = std::move(backend);
+        f.ring_bytes = config.ring_bytes;
+        f.flush_interval = std::chrono::milliseconds(config.flush_interval_ms);
+    }
+
+    f.formatter = std::thread(run_formatter, std::ref(f));
+    detail::g_min_level.store(config.level, std::memory_order_relaxed);
+}
+
+void stop_logging() noexcept {
+    Frontend& f = frontend();
+    detail::g_min_level.store(LogLevel::Off, std::memory_order_relaxed);
+
+    if (!f.running.exchange(false)) return;
+    f.formatter.join();
+
+    while (drain(f) != 0) {}
+    std::lock_guard lock(f.mutex);
+    f.backend->flush();
+    f.backend.reset();
+}
+
+LogStats log_stats() noexcept {
+    Frontend& f = frontend();
+    std::lock_guard lock(f.mutex);
+
+    std::uint64_t dropped = f.retired_dropped.load(std::memory_order_relaxed);
+    for (const auto& ring : f.rings) {
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return LogStats{ f.written.load(std::memory_order_relaxed), dropped };
+}
+
+} // lute::runtime::logging
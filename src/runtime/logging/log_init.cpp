@@ -1,9 +1,18 @@
 #include <logging/log_init.h>
+#include <logging/log.h>
+#include <logging/backends/file_backend.h>
+
+#include <memory>
 
 namespace lute::runtime::logging {
 
-void init_logging(const AppConfig& config, RuntimeMode mode) {
-    
+void init_logging(const AppConfig& config, RuntimeMode) {
+    start_logging(config.logging, std::make_unique<FileBackend>(config.logging.path));
+    attach_current_thread();
+}
+
+void shutdown_logging() noexcept {
+    stop_logging();
 }
 
-} // lute::runtime::logging
\ No newline at end of file
+} // lute::runtime::logging
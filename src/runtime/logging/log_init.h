@@ -8,6 +8,14 @@ namespace lute::runtime::logging {
 using AppConfig = lute::runtime::config::AppConfig;
 using RuntimeMode = lute::runtime::bootstrap::RuntimeMode;
 
+/**
+ * @brief Starts the logging frontend with a file backend as configured in \c [logging]
+ */
 void init_logging(const AppConfig& config, RuntimeMode);
 
-} // lute::runtime::logging
\ No newline at end of file
+/**
+ * @brief Drains and flushes every pending record; call once the data plane has stopped
+ */
+void shutdown_logging() noexcept;
+
+} // lute::runtime::logging
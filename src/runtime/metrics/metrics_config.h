@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace lute::runtime::metrics {
+
+enum class MetricsFormat : std::uint8_t {
+    Text,
+    Json,       // one object per line (JSON Lines)
+};
+
+struct MetricsConfig {
+    std::uint32_t interval_ms = 0;      // 0 = no periodic snapshot
+    std::string path;                   // appended to; empty = stderr
+    MetricsFormat format = MetricsFormat::Json;
+};
+
+} // namespace lute::runtime::metrics
@@ -0,0 +1,224 @@
+#include <metrics/metrics_registry.h>
+
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+
+namespace lute::runtime::metrics {
+
+static std::uint64_t steady_now_ns() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void MetricsRegistry::add_channel(std::string name, const tm::metrics::ChannelMetrics& metrics) {
+    std::lock_guard lock(mutex_);
+    channels_.emplace_back(std::move(name), &metrics);
+}
+
+void MetricsRegistry::add_gate(std::string name, const tm::metrics::GateMetrics& metrics) {
+    std::lock_guard lock(mutex_);
+    gates_.emplace_back(std::move(name), &metrics);
+}
+
+void MetricsRegistry::add_edge(std::string name, const tm::metrics::FlowMetrics& metrics) {
+    std::lock_guard lock(mutex_);
+    edges_.emplace_back(std::move(name), &metrics);
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const {
+    std::lock_guard lock(mutex_);
+
+    MetricsSnapshot snapshot;
+    snapshot.time_ns = steady_now_ns();
+
+    for (const auto& [name, m] : channels_) {
+        snapshot.channels.push_back(ChannelSample {
+            .name = name,
+            .bytes_in = m->bytesIn.load(),
+            .bytes_out = m->bytesOut.load(),
+            .publishes = m->publishes.load(),
+            .releases = m->releases.load(),
+            .full_stalls = m->fullStalls.load(),
+            .empty_stalls = m->emptyStalls.load(),
+            .occupancy = m->occupancy.snapshot(),
+            .latency_ns = m->latencyNs.snapshot(),
+        });
+    }
+
+    for (const auto& [name, m] : gates_) {
+        snapshot.gates.push_back(GateSample {
+            .name = name,
+            .records_in = m->recordsIn.load(),
+            .records_out = m->recordsOut.load(),
+            .pushes = m->pushes.load(),
+            .commits = m->commits.load(),
+            .full_stalls = m->fullStalls.load(),
+            .empty_stalls = m->emptyStalls.load(),
+            .occupancy = m->occupancy.snapshot(),
+            .latency_ns = m->latencyNs.snapshot(),
+        });
+    }
+
+    for (const auto& [name, m] : edges_) {
+        snapshot.edges.push_back(FlowSample {
+            .name = name,
+            .records_sent = m->recordsSent.load(),
+            .stalls = m->stalls.load(),
+            .blocked = m->blocked.load(),
+            .spilled = m->spilledRecords.load(),
+            .shed = m->shedRecords.load(),
+            .credits_granted = m->creditsGranted.load(),
+            .stall_ns = m->stallNs.snapshot(),
+        });
+    }
+
+    return snapshot;
+}
+
+MetricsSnapshot MetricsSnapshot::since(const MetricsSnapshot& earlier) const {
+    MetricsSnapshot interval = *this;
+    interval.interval_ns = time_ns - earlier.time_ns;
+
+    for (std::size_t i = 0; i < std::min(interval.channels.size(), earlier.channels.size()); ++i) {
+        ChannelSample& now = interval.channels[i];
+        const ChannelSample& then = earlier.channels[i];
+        now.bytes_in -= then.bytes_in;
+        now.bytes_out -= then.bytes_out;
+        now.publishes -= then.publishes;
+        now.releases -= then.releases;
+        now.full_stalls -= then.full_stalls;
+        now.empty_stalls -= then.empty_stalls;
+        now.occupancy = now.occupancy - then.occupancy;
+        now.latency_ns = now.latency_ns - then.latency_ns;
+    }
+
+    for (std::size_t i = 0; i < std::min(interval.gates.size(), earlier.gates.size()); ++i) {
+        GateSample& now = interval.gates[i];
+        const GateSample& then = earlier.gates[i];
+        now.records_in -= then.records_in;
+        now.records_out -= then.records_out;
+        now.pushes -= then.pushes;
+        now.commits -= then.commits;
+        now.full_stalls -= then.full_stalls;
+        now.empty_stalls -= then.empty_stalls;
+        now.occupancy = now.occupancy - then.occupancy;
+        now.latency_ns = now.latency_ns - then.latency_ns;
+    }
+
+    for (std::size_t i = 0; i < std::min(interval.edges.size(), earlier.edges.size()); ++i) {
+        FlowSample& now = interval.edges[i];
+        const FlowSample& then = earlier.edges[i];
+        now.records_sent -= then.records_sent;
+        now.stalls -= then.stalls;
+        now.blocked -= then.blocked;
+        now.spilled -= then.spilled;
+        now.shed -= then.shed;
+        now.credits_granted -= then.credits_granted;
+        now.stall_ns = now.stall_ns - then.stall_ns;
+    }
+
+    return interval;
+}
+
+static void text_histogram(std::ostream& out, const char* label, const HistogramSnapshot& h) {
+    out << ' ' << label << "[n=" << h.count() << " p50=" << h.percentile(0.50) << " p99=" << h.percentile(0.99)
+        << " p999=" << h.percentile(0.999) << " max=" << h.max() << ']';
+}
+
+static void json_histogram(std::ostream& out, const char* key, const HistogramSnapshot& h) {
+    out << ",\"" << key << "\":{\"count\":" << h.count() << ",\"mean\":" << h.mean()
+        << ",\"p50\":" << h.percentile(0.50) << ",\"p99\":" << h.percentile(0.99)
+        << ",\"p999\":" << h.percentile(0.999) << ",\"max\":" << h.max() << '}';
+}
+
+static void json_string(std::ostream& out, const std::string& text) {
+    out << '"';
+    for (const char c : text) {
+        if (c == '"' || c == '\\') out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+
+std::string render_text(const MetricsSnapshot& snapshot) {
+    std::ostringstream out;
+    out << "metrics interval_ms=" << snapshot.interval_ns / 1'000'000 << '\n';
+
+    for (const ChannelSample& c : snapshot.channels) {
+        out << "  channel " << c.name << ": bytes_in=" << c.bytes_in << " bytes_out=" << c.bytes_out
+            << " publishes=" << c.publishes << " releases=" << c.releases
+            << " full_stalls=" << c.full_stalls << " empty_stalls=" << c.empty_stalls;
+        text_histogram(out, "latency_ns", c.latency_ns);
+        text_histogram(out, "occupancy_bytes", c.occupancy);
+        out << '\n';
+    }
+
+    for (const GateSample& g : snapshot.gates) {
+        out << "  gate " << g.name << ": records_in=" << g.records_in << " records_out=" << g.records_out
+            << " pushes=" << g.pushes << " commits=" << g.commits
+            << " full_stalls=" << g.full_stalls << " empty_stalls=" << g.empty_stalls;
+        text_histogram(out, "latency_ns", g.latency_ns);
+        text_histogram(out, "occupancy_records", g.occupancy);
+        out << '\n';
+    }
+
+    for (const FlowSample& e : snapshot.edges) {
+        out << "  edge " << e.name << ": records_sent=" << e.records_sent << " credits_granted=" << e.credits_granted
+            << " stalls=" << e.stalls << " stall_time_ns=" << e.stall_ns.sum()
+            << " blocked=" << e.blocked << " spilled=" << e.spilled << " shed=" << e.shed;
+        text_histogram(out, "stall_ns", e.stall_ns);
+        out << '\n';
+    }
+
+    return out.str();
+}
+
+std::string render_json(const MetricsSnapshot& snapshot) {
+    std::ostringstream out;
+    out << "{\"time_ns\":" << snapshot.time_ns << ",\"interval_ns\":" << snapshot.interval_ns << ",\"channels\":[";
+
+    for (std::size_t i = 0; i < snapshot.channels.size(); ++i) {
+        const ChannelSample& c = snapshot.channels[i];
+        out << (i == 0 ? "" : ",") << "{\"name\":";
+        json_string(out, c.name);
+        out << ",\"bytes_in\":" << c.bytes_in << ",\"bytes_out\":" << c.bytes_out
+            << ",\"publishes\":" << c.publishes << ",\"releases\":" << c.releases
+            << ",\"full_stalls\":" << c.full_stalls << ",\"empty_stalls\":" << c.empty_stalls;
+        json_histogram(out, "latency_ns", c.latency_ns);
+        json_histogram(out, "occupancy_bytes", c.occupancy);
+        out << '}';
+    }
+
+    out << "],\"gates\":[";
+
+    for (std::size_t i = 0; i < snapshot.gates.size(); ++i) {
+        const GateSample& g = snapshot.gates[i];
+        out << (i == 0 ? "" : ",") << "{\"name\":";
+        json_string(out, g.name);
+        out << ",\"records_in\":" << g.records_in << ",\"records_out\":" << g.records_out
+            << ",\"pushes\":" << g.pushes << ",\"commits\":" << g.commits
+            << ",\"full_stalls\":" << g.full_stalls << ",\"empty_stalls\":" << g.empty_stalls;
+        json_histogram(out, "latency_ns", g.latency_ns);
+        json_histogram(out, "occupancy_records", g.occupancy);
+        out << '}';
+    }
+
+    out << "],\"edges\":[";
+
+    for (std::size_t i = 0; i < snapshot.edges.size(); ++i) {
+        const FlowSample& e = snapshot.edges[i];
+        out << (i == 0 ? "" : ",") << "{\"name\":";
+        json_string(out, e.name);
+        out << ",\"records_sent\":" << e.records_sent << ",\"credits_granted\":" << e.credits_granted
+            << ",\"stalls\":" << e.stalls << ",\"stall_time_ns\":" << e.stall_ns.sum()
+            << ",\"blocked\":" << e.blocked << ",\"spilled\":" << e.spilled << ",\"shed\":" << e.shed;
+        json_histogram(out, "stall_ns", e.stall_ns);
+        out << '}';
+    }
+
+    out << "]}";
+    return out.str();
+}
+
+} // namespace lute::runtime::metrics
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <metrics/ChannelMetrics.h>
+#include <metrics/FlowMetrics.h>
+#include <metrics/GateMetrics.h>
+#include <metrics/Histogram.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lute::runtime::metrics {
+
+using lute::tm::metrics::HistogramSnapshot;
+
+struct ChannelSample {
+    std::string name;
+    std::uint64_t bytes_in;
+    std::uint64_t bytes_out;
+    std::uint64_t publishes;
+    std::uint64_t releases;
+    std::uint64_t full_stalls;
+    std::uint64_t empty_stalls;
+    HistogramSnapshot occupancy;
+    HistogramSnapshot latency_ns;
+};
+
+struct GateSample {
+    std::string name;
+    std::uint64_t records_in;
+    std::uint64_t records_out;
+    std::uint64_t pushes;
+    std::uint64_t commits;
+    std::uint64_t full_stalls;
+    std::uint64_t empty_stalls;
+    HistogramSnapshot occupancy;
+    HistogramSnapshot latency_ns;
+};
+
+struct FlowSample {
+    std::string name;
+    std::uint64_t records_sent;
+    std::uint64_t stalls;
+    std::uint64_t blocked;
+    std::uint64_t spilled;
+    std::uint64_t shed;
+    std::uint64_t credits_granted;
+    HistogramSnapshot stall_ns;
+};
+
+/**
+ * @struct MetricsSnapshot
+ * @brief Cumulative values of every registered channel, gate and credited edge at one point in time
+ */
+struct MetricsSnapshot {
+    std::uint64_t time_ns = 0;
+    std::uint64_t interval_ns = 0;      // 0 for a cumulative snapshot, else the span covered by \ref since
+    std::vector<ChannelSample> channels;
+    std::vector<GateSample> gates;
+    std::vector<FlowSample> edges;
+
+    /**
+     * @brief Per-interval view: counters and histograms minus those of \p earlier, matched by position
+     */
+    MetricsSnapshot since(const MetricsSnapshot& earlier) const;
+};
+
+/**
+ * @class MetricsRegistry
+ * @brief Control-plane index of the data-plane metrics to publish
+ *
+ * Registration happens while a job graph is deployed; the metrics objects must outlive the registry or
+ * be registered for the lifetime of the job. Snapshots read the counters without stopping the writers.
+ */
+class MetricsRegistry {
+public:
+    void add_channel(std::string name, const tm::metrics::ChannelMetrics& metrics);
+    void add_gate(std::string name, const tm::metrics::GateMetrics& metrics);
+    void add_edge(std::string name, const tm::metrics::FlowMetrics& metrics);
+
+    MetricsSnapshot snapshot() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<std::pair<std::string, const tm::metrics::ChannelMetrics*>> channels_;
+    std::vector<std::pair<std::string, const tm::metrics::GateMetrics*>> gates_;
+    std::vector<std::pair<std::string, const tm::metrics::FlowMetrics*>> edges_;
+};
+
+/**
+ * @brief One line per channel, gate and edge with counters and p50/p99/p999/max latency
+ */
+std::string render_text(const MetricsSnapshot& snapshot);
+
+/**
+ * @brief Single-line JSON object, suitable for JSON Lines files
+ */
+std::string render_json(const MetricsSnapshot& snapshot);
+
+} // namespace lute::runtime::metrics
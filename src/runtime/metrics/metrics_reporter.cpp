@@ -0,0 +1,77 @@
+#include <metrics/metrics_reporter.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace lute::runtime::metrics {
+
+MetricsReporter::MetricsReporter(const MetricsRegistry& registry, MetricsConfig config)
+    : registry_(registry),
+      config_(std::move(config)),
+      previous_(registry.snapshot())
+{}
+
+MetricsReporter::~MetricsReporter() {
+    stop();
+}
+
+void MetricsReporter::start() {
+    if (config_.interval_ms == 0 || thread_.joinable()) return;
+
+    stopping_ = false;
+    thread_ = std::thread([this]() { run(); });
+}
+
+void MetricsReporter::stop() noexcept {
+    if (!thread_.joinable()) return;
+
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+void MetricsReporter::publish() {
+    const MetricsSnapshot current = registry_.snapshot();
+    const MetricsSnapshot interval = current.since(previous_);
+    previous_ = current;
+
+    const std::string rendered = config_.format == MetricsFormat::Json ? render_json(interval) + '\n'
+                                                                      : render_text(interval);
+
+    if (config_.path.empty()) {
+        std::cerr << rendered << std::flush;
+        return;
+    }
+
+    std::ofstream out(config_.path, std::ios::app);
+    if (!out) {
+        throw std::runtime_error("Cannot open metrics file: " + config_.path);
+    }
+    out << rendered;
+}
+
+void MetricsReporter::run() {
+    std::unique_lock lock(mutex_);
+
+    for (;;) {
+        const bool stopping = wake_.wait_for(lock, std::chrono::milliseconds(config_.interval_ms),
+                                             [this]() { return stopping_; });
+
+        lock.unlock();
+        try {
+            publish();
+        } catch (const std::exception& e) {
+            std::cerr << "Metrics publication failed: " << e.what() << '\n';
+        }
+        lock.lock();
+
+        if (stopping) return;
+    }
+}
+
+} // namespace lute::runtime::metrics
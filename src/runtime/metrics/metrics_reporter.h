@@ -0,0 +1,55 @@
+#pragma once
+
+#include <metrics/metrics_config.h>
+#include <metrics/metrics_registry.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace lute::runtime::metrics {
+
+/**
+ * @class MetricsReporter
+ * @brief Control-plane thread that publishes a per-interval \ref MetricsSnapshot every
+ * \c interval_ms, rendered as text or JSON
+ */
+class MetricsReporter {
+public:
+    MetricsReporter(const MetricsRegistry& registry, MetricsConfig config);
+    ~MetricsReporter();
+
+    MetricsReporter(const MetricsReporter&) = delete;
+    MetricsReporter& operator=(const MetricsReporter&) = delete;
+
+    /**
+     * @brief Starts the periodic thread; a no-op when \c interval_ms is 0
+     */
+    void start();
+
+    /**
+     * @brief Stops the thread after publishing a final snapshot. Idempotent.
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief Publishes the interval since the previous snapshot right away
+     *
+     * @throw std::runtime_error if the output file cannot be opened
+     */
+    void publish();
+
+private:
+    void run();
+
+    const MetricsRegistry& registry_;
+    const MetricsConfig config_;
+    MetricsSnapshot previous_;
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
+
+} // namespace lute::runtime::metrics
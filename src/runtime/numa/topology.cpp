@@ -0,0 +1,124 @@
+#include <numa/topology.h>
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace lute::runtime::numa {
+
+static std::string read_line(const std::filesystem::path& file) {
+    std::ifstream in(file);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+static int parse_int(std::string_view text, const std::string_view context) {
+    int value = 0;
+    const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (ec != std::errc{} || end != text.data() + text.size()) {
+        throw std::runtime_error("Malformed " + std::string(context) + ": '" + std::string(text) + "'");
+    }
+    return value;
+}
+
+std::vector<int> parse_cpu_list(std::string_view list) {
+    std::vector<int> cpus;
+
+    while (!list.empty() && (list.back() == '\n' || list.back() == ' ')) {
+        list.remove_suffix(1);
+    }
+
+    while (!list.empty()) {
+        const std::size_t comma = list.find(',');
+        const std::string_view range = list.substr(0, comma);
+        list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+
+        const std::size_t dash = range.find('-');
+        const int first = parse_int(range.substr(0, dash), "cpu list");
+        const int last = dash == std::string_view::npos ? first : parse_int(range.substr(dash + 1), "cpu list");
+
+        if (last < first) {
+            throw std::runtime_error("Malformed cpu list range: '" + std::string(range) + "'");
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+
+    return cpus;
+}
+
+static std::vector<int> parse_distances(const std::string& line) {
+    std::vector<int> distances;
+    std::istringstream in(line);
+    std::string token;
+    while (in >> token) {
+        distances.push_back(parse_int(token, "node distance"));
+    }
+    return distances;
+}
+
+static std::uint64_t read_free_huge_pages(const std::filesystem::path& node_dir) {
+    const auto file = node_dir / "hugepages" / "hugepages-2048kB" / "free_hugepages";
+    if (!std::filesystem::exists(file)) return 0;
+
+    const std::string line = read_line(file);
+    return line.empty() ? 0 : static_cast<std::uint64_t>(parse_int(line, "free_hugepages"));
+}
+
+Topology detect_topology(const std::filesystem::path& node_root) {
+    Topology topology;
+
+    std::error_code ec;
+    if (std::filesystem::is_directory(node_root, ec)) {
+        for (const auto& entry : std::filesystem::directory_iterator(node_root)) {
+            const std::string name = entry.path().filename().string();
+            if (!entry.is_directory() || name.rfind("node", 0) != 0 || name.size() == 4) continue;
+            if (!std::all_of(name.begin() + 4, name.end(), [](char c) { return c >= '0' && c <= '9'; })) continue;
+
+            NumaNode node {
+                .id = parse_int(std::string_view(name).substr(4), "node id"),
+                .cpus = parse_cpu_list(read_line(entry.path() / "cpulist")),
+                .distances = parse_distances(read_line(entry.path() / "distance")),
+                .free_huge_pages = read_free_huge_pages(entry.path()),
+            };
+            topology.nodes.push_back(std::move(node));
+        }
+    }
+
+    if (topology.nodes.empty()) {
+        NumaNode node { .id = 0, .cpus = {}, .distances = {10}, .free_huge_pages = 0 };
+        const unsigned count = std::max(1U, std::thread::hardware_concurrency());
+        for (unsigned cpu = 0; cpu < count; ++cpu) {
+            node.cpus.push_back(static_cast<int>(cpu));
+        }
+        topology.nodes.push_back(std::move(node));
+    }
+
+    std::sort(topology.nodes.begin(), topology.nodes.end(),
+              [](const NumaNode& a, const NumaNode& b) { return a.id < b.id; });
+    return topology;
+}
+
+int Topology::node_of_cpu(const int cpu) const noexcept {
+    for (const NumaNode& node : nodes) {
+        if (std::find(node.cpus.begin(), node.cpus.end(), cpu) != node.cpus.end()) {
+            return node.id;
+        }
+    }
+    return -1;
+}
+
+const NumaNode* Topology::find_node(const int id) const noexcept {
+    for (const NumaNode& node : nodes) {
+        if (node.id == id) return &node;
+    }
+    return nullptr;
+}
+
+} // namespace lute::runtime::numa
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+namespace lute::runtime::numa {
+
+struct NumaNode {
+    int id;
+    std::vector<int> cpus;
+    std::vector<int> distances;         // SLIT distance to every node, indexed by position in Topology::nodes
+    std::uint64_t free_huge_pages;      // free 2 MiB pages reserved on this node
+};
+
+/**
+ * @struct Topology
+ * @brief NUMA layout of the machine as reported by sysfs
+ *
+ * Used by the control plane to derive placement hints for channels and gates (the node of the consumer
+ * thread's CPU) and to keep data-plane workers and their buffers on the same socket.
+ */
+struct Topology {
+    std::vector<NumaNode> nodes;
+
+    /**
+     * @return Node owning \p cpu, or -1 if the CPU is not listed
+     */
+    int node_of_cpu(int cpu) const noexcept;
+
+    const NumaNode* find_node(int id) const noexcept;
+
+    bool is_numa() const noexcept { return nodes.size() > 1; }
+};
+
+/**
+ * @brief Reads \c node<N>/cpulist, \c node<N>/distance and the per-node 2 MiB huge page pool
+ *
+ * On kernels without NUMA support the directory is missing; the machine is then reported as a single
+ * node 0 owning every CPU.
+ *
+ * @throw std::runtime_error if a sysfs file exists but cannot be parsed
+ */
+Topology detect_topology(const std::filesystem::path& node_root = "/sys/devices/system/node");
+
+/**
+ * @brief Parses the kernel cpulist format, e.g. "0-3,8,10-11"
+ *
+ * @throw std::runtime_error on malformed input
+ */
+std::vector<int> parse_cpu_list(std::string_view list);
+
+} // namespace lute::runtime::numa
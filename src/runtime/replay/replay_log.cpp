@@ -0,0 +1,188 @@
+#include <replay/replay_log.h>
+#include <logging/log.h>
+#include <util/helpers.h>
+#include <counter.h>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace lute::runtime::replay {
+
+using core::bump;
+using util::file_error;
+using util::write_all;
+
+static constexpr std::uint64_t REPLAY_MAGIC = 0x4c55544552504c31;       // "LUTERPL1"
+static constexpr std::uint32_t REPLAY_VERSION = 1;
+
+struct FileHeader {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t reserved;
+};
+
+struct ChunkHeader {
+    std::uint32_t stream;
+    std::uint32_t length;
+};
+
+/**
+ * @return Bytes read; less than \p size only at the end of the file
+ */
+static std::size_t read_up_to(const int fd, void* data, const std::size_t size, const std::string& path) {
+    auto* bytes = static_cast<std::byte*>(data);
+    std::size_t done = 0;
+    while (done != size) {
+        const ssize_t n = ::read(fd, bytes + done, size - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) throw file_error("read", path, errno);
+        if (n == 0) break;
+
+        done += static_cast<std::size_t>(n);
+    }
+    return done;
+}
+
+std::map<StreamId, std::vector<std::byte>> read_replay_log(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) throw file_error("open", path, errno);
+
+    std::map<StreamId, std::vector<std::byte>> streams;
+    try {
+        FileHeader header;
+        if (read_up_to(fd, &header, sizeof(header), path) != sizeof(header) || header.magic != REPLAY_MAGIC) {
+            throw std::runtime_error(path + " is not a lute replay log");
+        }
+        if (header.version != REPLAY_VERSION) throw std::runtime_error(path + ": unsupported replay log version");
+
+        while (true) {
+            ChunkHeader chunk;
+            if (read_up_to(fd, &chunk, sizeof(chunk), path) != sizeof(chunk)) break;
+
+            std::vector<std::byte>& stream = streams[chunk.stream];
+            const std::size_t offset = stream.size();
+            stream.resize(offset + chunk.length);
+            if (read_up_to(fd, stream.data() + offset, chunk.length, path) != chunk.length) {
+                stream.resize(offset);
+                break;
+            }
+        }
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+
+    ::close(fd);
+    return streams;
+}
+
+ReplayLogWriter::ReplayLogWriter(const std::string& path)
+    : path_(path),
+      fd_(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644))
+{
+    if (fd_ < 0) throw file_error("open", path_, errno);
+
+    const FileHeader header{ .magic = REPLAY_MAGIC, .version = REPLAY_VERSION, .reserved = 0 };
+    try {
+        write_all(fd_, &header, sizeof(header), path_);
+    } catch (...) {
+        ::close(fd_);
+        throw;
+    }
+}
+
+ReplayLogWriter::~ReplayLogWriter() {
+    stop();
+    ::close(fd_);
+}
+
+void ReplayLogWriter::start() {
+    if (thread_.joinable()) return;
+
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = false;
+    }
+    thread_ = std::thread([this]() { run(); });
+    ::pthread_setname_np(thread_.native_handle(), "lute-replay");
+}
+
+void ReplayLogWriter::stop() noexcept {
+    if (!thread_.joinable()) return;
+
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+
+    if (::fsync(fd_) != 0) RUNTIME_LOG_WARN("replay log: fsync {} failed: {}", path_.c_str(), std::strerror(errno));
+}
+
+void ReplayLogWriter::submit(const StreamId stream, std::vector<std::byte>&& chunk) {
+    if (chunk.empty()) return;
+    if (chunk.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::runtime_error("replay log: chunk of " + std::to_string(chunk.size()) + " bytes is too large");
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        queue_.push_back(Chunk{ stream, std::move(chunk) });
+    }
+    wake_.notify_one();
+}
+
+tm::replay::Recorder<>::Sink ReplayLogWriter::sink(const StreamId stream) {
+    return [this, stream](std::vector<std::byte>&& chunk) { submit(stream, std::move(chunk)); };
+}
+
+ReplayLogStats ReplayLogWriter::stats() const noexcept {
+    return ReplayLogStats {
+        .chunks = chunks_.load(std::memory_order_relaxed),
+        .bytes = bytes_.load(std::memory_order_relaxed),
+        .failed = failed_.load(std::memory_order_relaxed),
+    };
+}
+
+void ReplayLogWriter::run() noexcept {
+    logging::attach_current_thread();
+
+    while (true) {
+        Chunk chunk;
+        {
+            std::unique_lock lock(mutex_);
+            wake_.wait(lock, [&]() { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) return;        // stopping, and everything queued is written
+
+            chunk = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        write(chunk);
+    }
+}
+
+void ReplayLogWriter::write(const Chunk& chunk) noexcept {
+    const ChunkHeader header{ .stream = chunk.stream, .length = static_cast<std::uint32_t>(chunk.bytes.size()) };
+
+    try {
+        write_all(fd_, &header, sizeof(header), path_);
+        write_all(fd_, chunk.bytes.data(), chunk.bytes.size(), path_);
+        bump(chunks_);
+        bump(bytes_, sizeof(header) + chunk.bytes.size());
+    } catch (const std::exception& e) {
+        // One lost chunk desynchronises its stream for good; keep counting so it shows up in stats
+        if (failed_.load(std::memory_order_relaxed) == 0) RUNTIME_LOG_ERROR("replay log: {}", e.what());
+        bump(failed_);
+    }
+}
+
+} // namespace lute::runtime::replay
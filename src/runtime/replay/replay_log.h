@@ -0,0 +1,107 @@
+#pragma once
+
+#include <replay/Recorder.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lute::runtime::replay {
+
+/**
+ * Replay log file: a header, then chunks in the order they were written
+ *
+ *     header  magic "LUTERPL1", version
+ *     chunk   stream id (u32), length (u32), encoded events (see tm::replay::ReplayEncoder)
+ *
+ * A stream is one operator's \ref tm::replay::Recorder; its chunks concatenated are its event sequence.
+ * Chunks never split an event, so a log cut short by a crash loses at most its last chunk per stream.
+ * Host byte order, like checkpoint files.
+ */
+using StreamId = std::uint32_t;
+
+/**
+ * @brief Every stream of the log at \p path, its chunks concatenated
+ *
+ * A trailing partial chunk (the writer died mid-write) is dropped.
+ *
+ * @throw std::runtime_error if the file is missing or not a replay log this build reads
+ */
+std::map<StreamId, std::vector<std::byte>> read_replay_log(const std::string& path);
+
+struct ReplayLogStats {
+    std::uint64_t chunks;
+    std::uint64_t bytes;
+    std::uint64_t failed;           // chunks that could not be written; the log is unusable past the first
+};
+
+/**
+ * @class ReplayLogWriter
+ * @brief Control-plane thread appending recorder chunks to the replay log of a Sim run
+ *
+ * Recorders hand over a chunk every few tens of kilobytes through \ref sink, which costs the operator one
+ * short queue lock; the file I/O happens on the \c lute-replay thread.
+ */
+class ReplayLogWriter {
+public:
+    /**
+     * @brief Creates (truncates) \p path and writes the header
+     *
+     * @throw std::runtime_error if the file cannot be created
+     */
+    explicit ReplayLogWriter(const std::string& path);
+    ~ReplayLogWriter();
+
+    ReplayLogWriter(const ReplayLogWriter&) = delete;
+    ReplayLogWriter& operator=(const ReplayLogWriter&) = delete;
+
+    void start();
+
+    /**
+     * @brief Writes what is still queued, syncs the file and stops the thread. Idempotent.
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief Queues \p chunk of stream \p stream. Safe from any thread.
+     */
+    void submit(StreamId stream, std::vector<std::byte>&& chunk);
+
+    /**
+     * @brief Sink for the \ref tm::replay::Recorder of stream \p stream
+     */
+    tm::replay::Recorder<>::Sink sink(StreamId stream);
+
+    ReplayLogStats stats() const noexcept;
+
+private:
+    struct Chunk {
+        StreamId stream;
+        std::vector<std::byte> bytes;
+    };
+
+    void run() noexcept;
+    void write(const Chunk& chunk) noexcept;
+
+    const std::string path_;
+    int fd_;
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<Chunk> queue_;
+    bool stopping_ = false;
+
+    std::atomic<std::uint64_t> chunks_{0};
+    std::atomic<std::uint64_t> bytes_{0};
+    std::atomic<std::uint64_t> failed_{0};
+};
+
+} // namespace lute::runtime::replay
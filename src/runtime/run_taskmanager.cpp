@@ -1,19 +1,113 @@
 #include <run.h>
 #include <runtime_context.h>
 #include <config/config.h>
+#include <exec/cpu_affinity.h>
+#include <exec/worker_pool.h>
+#include <lifecycle/shutdown_manager.h>
+#include <logging/log.h>
+#include <metrics/metrics_registry.h>
+#include <metrics/metrics_reporter.h>
+#include <replay/replay_log.h>
+#include <replay/Replayer.h>
+#include <tracing/trace_dump.h>
+#include <trace.h>
 #include <assertion.h>
 
+#include <chrono>
+#include <memory>
+#include <thread>
+
 namespace lute::runtime {
 
+static exec::WorkerPoolOptions worker_pool_options(const config::AppConfig& config) {
+    return exec::WorkerPoolOptions {
+        .worker_threads = static_cast<std::size_t>(config.execution.worker_threads),
+        .worker_cpus = config.execution.worker_cpus,
+        .backoff = exec::BackoffPolicy {
+            .spin_iterations = config.backoff.spin_iterations,
+            .pause_iterations = config.backoff.pause_iterations,
+            .park_timeout = std::chrono::microseconds(config.backoff.park_timeout_us),
+        },
+    };
+}
+
+/**
+ * @brief Sim replay: runs every recorded stream to its end with no wall-clock waits and reports it
+ *
+ * Deployed job graphs hand each stream to the operator it was recorded from instead of only counting it.
+ */
+static int replay_sim_log(const config::SimConfig& sim) {
+    const auto streams = replay::read_replay_log(sim.log_path);
+    RUNTIME_LOG_INFO("replaying {} streams from {}", streams.size(), sim.log_path);
+
+    const auto started = std::chrono::steady_clock::now();
+    for (const auto& [stream, events] : streams) {
+        tm::replay::Replayer replayer(events);
+        replayer.poll([](std::size_t, std::uint64_t, std::span<const std::byte>) { return true; },
+                      [](std::size_t, std::uint64_t) {},
+                      [](std::size_t, std::uint64_t) {});
+        RUNTIME_LOG_INFO("stream {}: {} records, {} ms recorded", stream, replayer.records(),
+                         replayer.recordedNanos() / 1'000'000);
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+    RUNTIME_LOG_INFO("replay finished in {} ms", elapsed.count());
+    return 0;
+}
+
 int run_taskmanager(
     lute::runtime::RuntimeContext& ctx, 
     const lute::runtime::config::AppConfig& config
 ) {
-    CORE_ASSERT(1 == 1, "Yep, looks true");
+    CORE_ASSERT(config.execution.worker_threads > 0, "load_config validates worker_threads");
+
+    const bool sim = ctx.mode == bootstrap::RuntimeMode::Sim;
+    if (sim && config.sim.action == config::SimAction::Replay) return replay_sim_log(config.sim);
+
+    // Pin the control plane first: threads it spawns from here on (except workers) inherit the mask
+    exec::pin_current_thread(config.execution.control_cpus);
+
+    exec::WorkerPool workers(worker_pool_options(config));
+    metrics::MetricsRegistry registry;
+
+    // Sim recording: operator tasks will sink their Recorder streams into this writer. Nothing builds
+    // recorders yet (that comes with job graph deployment), so for now the log holds only its header.
+    std::unique_ptr<replay::ReplayLogWriter> replay_log;
+    if (sim) {
+        replay_log = std::make_unique<replay::ReplayLogWriter>(config.sim.log_path);
+        replay_log->start();
+        RUNTIME_LOG_WARN("sim mode: no operators are recorded yet; {} will only hold the log header", config.sim.log_path);
+    }
+
+    // Deployed job graphs assign their operator tasks to workers and register their channel and gate
+    // metrics here, before the pool starts
+
+    core::trace::set_ring_events(config.tracing.ring_events);
+
+    metrics::MetricsReporter reporter(registry, config.metrics);
+
+    workers.start();
+    reporter.start();
+    RUNTIME_LOG_INFO("task manager running with {} data-plane workers", workers.size());
+
+    while (!lifecycle::ShutdownManager::shutdown_requested()) {
+        if (tracing::take_trace_dump_request()) {
+            tracing::dump_trace(config.tracing.path);
+            RUNTIME_LOG_INFO("trace written to {}", config.tracing.path);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    workers.stop();
+    reporter.stop();
+    if (replay_log) replay_log->stop();
+    RUNTIME_LOG_INFO("task manager stopped");
+
+#if defined(CORE_TRACING_ENABLED)
+    tracing::dump_trace(config.tracing.path);
+#endif
 
-    ctx;
-    config;
     return 0;
 }
 
-} // lute::runtime
\ No newline at end of file
+} // lute::runtime
@@ -0,0 +1,105 @@
+#include <tracing/trace_dump.h>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+namespace lute::runtime::tracing {
+
+using core::trace::ThreadTrace;
+
+static std::atomic<bool> dump_requested{false};
+
+static void write_json_string(std::ostream& out, const std::string_view text) {
+    out << '"';
+    for (const char c : text) {
+        if (c == '"' || c == '\\') out << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20) out << ' ';
+        else out << c;
+    }
+    out << '"';
+}
+
+/**
+ * @brief TSC rate measured against steady_clock since the first ring was attached
+ */
+static double measure_ticks_per_us(const core::trace::Registry& registry) {
+    constexpr auto MIN_WINDOW = std::chrono::milliseconds(10);
+
+    if (std::chrono::steady_clock::now() - registry.base_time < MIN_WINDOW) {
+        std::this_thread::sleep_for(MIN_WINDOW);
+    }
+
+    const std::uint64_t ticks = core::trace::ticks();
+    const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - registry.base_time);
+    return static_cast<double>(ticks - registry.base_ticks) / elapsed.count();
+}
+
+void write_chrome_trace(std::ostream& out, const std::vector<ThreadTrace>& traces,
+                        const double ticks_per_us, const std::uint64_t base_ticks) {
+    const long pid = static_cast<long>(::getpid());
+    bool first = true;
+
+    const auto separator = [&]() {
+        out << (first ? "\n    " : ",\n    ");
+        first = false;
+    };
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    for (const ThreadTrace& trace : traces) {
+        separator();
+        out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << pid << ",\"tid\":" << trace.tid
+            << ",\"args\":{\"name\":";
+        write_json_string(out, trace.name.empty() ? "thread-" + std::to_string(trace.tid) : trace.name);
+        out << "}}";
+
+        for (const core::trace::TraceEvent& event : trace.events) {
+            const double ts = static_cast<double>(event.begin - base_ticks) / ticks_per_us;
+            const double dur = static_cast<double>(event.end - event.begin) / ticks_per_us;
+
+            separator();
+            out << "{\"ph\":\"X\",\"name\":";
+            write_json_string(out, event.site->name);
+            out << ",\"cat\":";
+            write_json_string(out, event.site->category);
+            out << ",\"pid\":" << pid << ",\"tid\":" << trace.tid << ",\"ts\":" << ts << ",\"dur\":" << dur << '}';
+        }
+    }
+
+    out << "\n]}\n";
+}
+
+void dump_trace(const std::string& path) {
+    const std::vector<ThreadTrace> traces = core::trace::snapshot();
+
+    const core::trace::Registry& registry = core::trace::registry();
+    const double ticks_per_us = traces.empty() ? 1.0 : measure_ticks_per_us(registry);
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open trace file: " + path);
+    }
+
+    out.precision(3);
+    out << std::fixed;
+    write_chrome_trace(out, traces, ticks_per_us, registry.base_ticks);
+
+    if (!out.flush()) {
+        throw std::runtime_error("Failed to write trace file: " + path);
+    }
+}
+
+void request_trace_dump() noexcept {
+    dump_requested.store(true, std::memory_order_relaxed);
+}
+
+bool take_trace_dump_request() noexcept {
+    return dump_requested.exchange(false, std::memory_order_relaxed);
+}
+
+} // lute::runtime::tracing
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <trace.h>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace lute::runtime::tracing {
+
+/**
+ * @brief Writes \p traces as Chrome trace-event JSON (complete "X" events plus thread names), which
+ * chrome://tracing and ui.perfetto.dev both open
+ *
+ * @param ticks_per_us Conversion of \ref core::trace::ticks to microseconds
+ * @param base_ticks Tick value mapped to timestamp 0
+ */
+void write_chrome_trace(std::ostream& out, const std::vector<core::trace::ThreadTrace>& traces,
+                        double ticks_per_us, std::uint64_t base_ticks);
+
+/**
+ * @brief Snapshots every thread's trace ring and writes it to \p path
+ *
+ * @throw std::runtime_error if \p path cannot be written
+ */
+void dump_trace(const std::string& path);
+
+/**
+ * @brief Asks the control plane for a dump at its next tick. Async-signal-safe (SIGUSR2).
+ */
+void request_trace_dump() noexcept;
+
+/**
+ * @return true once per \ref request_trace_dump
+ */
+bool take_trace_dump_request() noexcept;
+
+} // lute::runtime::tracing
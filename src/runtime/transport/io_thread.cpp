@@ -0,0 +1,465 @@
+#include <transport/io_thread.h>
+#include <exec/cpu_affinity.h>
+#include <logging/log.h>
+#include <counter.h>
+#include <futex.h>
+#include <trace.h>
+
+#include <endian.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace lute::runtime::transport {
+
+static constexpr std::uint32_t HELLO_MAGIC = 0x4c555445;       // "LUTE"
+static constexpr std::uint16_t WIRE_VERSION = 1;
+
+// Empty passes spent re-checking the rings before blocking in epoll_wait; a sender that keeps up finds the
+// thread awake and needs no eventfd write
+static constexpr std::uint32_t IDLE_POLLS = 256;
+static constexpr int MAX_EVENTS = 64;
+
+// Counters have a single writer, the I/O thread
+using core::bump;
+
+static int gather(const tm::channels::ReadableRegion& region, iovec (&iov)[2]) noexcept {
+    iov[0] = { const_cast<std::byte*>(region.first.data()), region.first.size() };
+    iov[1] = { const_cast<std::byte*>(region.second.data()), region.second.size() };
+    return region.second.empty() ? 1 : 2;
+}
+
+static int scatter(const tm::channels::WritableRegion& region, iovec (&iov)[2]) noexcept {
+    iov[0] = { region.first.data(), region.first.size() };
+    iov[1] = { region.second.data(), region.second.size() };
+    return region.second.empty() ? 1 : 2;
+}
+
+static bool would_block(const int error) noexcept {
+    return error == EAGAIN || error == EWOULDBLOCK;
+}
+
+std::array<std::byte, HELLO_BYTES> encode_hello(const EdgeId edge) noexcept {
+    const std::uint32_t magic = htobe32(HELLO_MAGIC);
+    const std::uint16_t version = htobe16(WIRE_VERSION);
+    const std::uint16_t reserved = 0;
+    const std::uint64_t id = htobe64(edge);
+
+    std::array<std::byte, HELLO_BYTES> hello{};
+    std::memcpy(hello.data(), &magic, 4);
+    std::memcpy(hello.data() + 4, &version, 2);
+    std::memcpy(hello.data() + 6, &reserved, 2);
+    std::memcpy(hello.data() + 8, &id, 8);
+    return hello;
+}
+
+std::optional<EdgeId> decode_hello(const std::array<std::byte, HELLO_BYTES>& hello) noexcept {
+    std::uint32_t magic;
+    std::uint16_t version;
+    std::uint64_t id;
+    std::memcpy(&magic, hello.data(), 4);
+    std::memcpy(&version, hello.data() + 4, 2);
+    std::memcpy(&id, hello.data() + 8, 8);
+
+    if (be32toh(magic) != HELLO_MAGIC || be16toh(version) != WIRE_VERSION) return std::nullopt;
+    return be64toh(id);
+}
+
+Connection::Connection(const int fd, const Role role, const std::size_t ring_bytes)
+    : fd(fd),
+      role(role),
+      ring(ring_bytes == 0 ? nullptr : std::make_unique<tm::channels::InMemoryChannel>(ring_bytes))
+{}
+
+Connection::~Connection() {
+    ::close(fd);
+}
+
+IoThread::IoThread(const std::size_t index, const int cpu, const std::size_t max_write_bytes, InboundHandler on_inbound)
+    : index_(index),
+      cpu_(cpu),
+      max_write_bytes_(max_write_bytes),
+      on_inbound_(std::move(on_inbound))
+{
+    epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0) throw std::runtime_error("epoll_create1 failed: " + std::string(std::strerror(errno)));
+
+    event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (event_fd_ < 0) {
+        const int error = errno;
+        ::close(epoll_fd_);
+        throw std::runtime_error("eventfd failed: " + std::string(std::strerror(error)));
+    }
+
+    // The eventfd is the only registration whose data.ptr is null
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.ptr = nullptr;
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, event_fd_, &event);
+}
+
+IoThread::~IoThread() {
+    stop();
+    connections_.clear();
+    adopted_.clear();
+    ::close(event_fd_);
+    ::close(epoll_fd_);
+}
+
+void IoThread::start() {
+    if (running_.exchange(true)) return;
+
+    thread_ = std::thread([this]() { run(); });
+    ::pthread_setname_np(thread_.native_handle(), ("lute-io-" + std::to_string(index_)).c_str());
+
+    if (cpu_ >= 0) {
+        try {
+            exec::pin_thread(thread_.native_handle(), { cpu_ });
+        } catch (...) {
+            stop();
+            throw;
+        }
+    }
+}
+
+void IoThread::stop() noexcept {
+    running_.store(false);
+
+    const std::uint64_t one = 1;
+    [[maybe_unused]] const ssize_t n = ::write(event_fd_, &one, sizeof(one));
+
+    if (thread_.joinable()) thread_.join();
+}
+
+void IoThread::adopt(std::shared_ptr<Connection> connection) {
+    connection->owner = this;
+    {
+        std::lock_guard lock(adopt_mutex_);
+        adopted_.push_back(std::move(connection));
+    }
+    adopt_pending_.store(true, std::memory_order_relaxed);
+    kick();
+}
+
+void IoThread::kick() noexcept {
+    // Pairs with the fence in wait(): either the thread sees the caller's change when it re-checks, or the
+    // caller sees it sleeping and writes the eventfd
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!sleeping_.load(std::memory_order_relaxed)) return;
+
+    const std::uint64_t one = 1;
+    [[maybe_unused]] const ssize_t n = ::write(event_fd_, &one, sizeof(one));
+}
+
+TransportStats IoThread::stats() const noexcept {
+    return TransportStats {
+        .bytes_sent = bytes_sent_.load(std::memory_order_relaxed),
+        .bytes_received = bytes_received_.load(std::memory_order_relaxed),
+        .writes = writes_.load(std::memory_order_relaxed),
+        .reads = reads_.load(std::memory_order_relaxed),
+        .wakeups = wakeups_.load(std::memory_order_relaxed),
+    };
+}
+
+void IoThread::run() noexcept {
+    logging::attach_current_thread();
+#if defined(CORE_TRACING_ENABLED)
+    core::trace::attach_current_thread();
+#endif
+
+    std::vector<std::shared_ptr<Connection>> handoffs;
+    std::uint32_t idle = 0;
+
+    while (running_.load(std::memory_order_relaxed)) {
+        if (adopt_pending_.load(std::memory_order_relaxed)) take_adopted();
+
+        bool progress = false;
+        for (const std::shared_ptr<Connection>& connection : connections_) {
+            progress |= service(*connection);
+            if (connection->handed_off) handoffs.push_back(connection);
+        }
+
+        std::erase_if(connections_, [](const auto& connection) { return connection->retired; });
+
+        // Hand over only once this thread no longer touches them
+        for (std::shared_ptr<Connection>& connection : handoffs) on_inbound_(std::move(connection));
+        handoffs.clear();
+
+        if (progress) {
+            idle = 0;
+            continue;
+        }
+        if (++idle < IDLE_POLLS) {
+            core::cpu_relax();
+            continue;
+        }
+
+        idle = 0;
+        wait();
+    }
+}
+
+void IoThread::take_adopted() {
+    std::vector<std::shared_ptr<Connection>> adopted;
+    {
+        std::lock_guard lock(adopt_mutex_);
+        adopt_pending_.store(false, std::memory_order_relaxed);
+        adopted.swap(adopted_);
+    }
+
+    for (std::shared_ptr<Connection>& connection : adopted) {
+        epoll_event event{};
+        event.events = connection->role == Connection::Role::Listener
+            ? EPOLLIN | EPOLLET
+            : EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+        event.data.ptr = connection.get();
+
+        if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, connection->fd, &event) != 0) {
+            RUNTIME_LOG_WARN("edge {}: epoll registration failed: {}", connection->edge, std::strerror(errno));
+            connection->broken.store(true, std::memory_order_relaxed);
+            connection->finished.store(true, std::memory_order_release);
+            continue;
+        }
+
+        // Assume readiness until a syscall says otherwise; edge-triggered epoll only reports changes
+        connection->readable = true;
+        connection->writable = true;
+        connection->retired = false;
+        connection->handed_off = false;
+        connections_.push_back(std::move(connection));
+    }
+}
+
+bool IoThread::has_work() const noexcept {
+    if (adopt_pending_.load(std::memory_order_relaxed)) return true;
+
+    for (const std::shared_ptr<Connection>& connection : connections_) {
+        const Connection& c = *connection;
+        switch (c.role) {
+            case Connection::Role::Outbound:
+                if (c.writable && (!c.ring->peek(1).empty() || c.closing.load(std::memory_order_relaxed))) return true;
+                break;
+            case Connection::Role::Inbound:
+                if (c.closing.load(std::memory_order_relaxed)) return true;
+                if (c.readable && c.stalled.load(std::memory_order_relaxed) && !c.ring->reserve(1).empty()) return true;
+                break;
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
+void IoThread::wait() {
+    sleeping_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (has_work() || !running_.load(std::memory_order_relaxed)) {
+        sleeping_.store(false, std::memory_order_relaxed);
+        return;
+    }
+
+    epoll_event events[MAX_EVENTS];
+    const int ready = ::epoll_wait(epoll_fd_, events, MAX_EVENTS, -1);
+    sleeping_.store(false, std::memory_order_relaxed);
+
+    for (int i = 0; i < ready; ++i) {
+        const std::uint32_t flags = events[i].events;
+
+        if (events[i].data.ptr == nullptr) {
+            std::uint64_t count;
+            [[maybe_unused]] const ssize_t n = ::read(event_fd_, &count, sizeof(count));
+            bump(wakeups_);
+            continue;
+        }
+
+        // Errors and hang-ups surface as a failed or empty read or write on the next pass
+        Connection& connection = *static_cast<Connection*>(events[i].data.ptr);
+        if (flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) connection.readable = true;
+        if (flags & (EPOLLOUT | EPOLLHUP | EPOLLERR)) connection.writable = true;
+    }
+}
+
+bool IoThread::service(Connection& connection) {
+    switch (connection.role) {
+        case Connection::Role::Listener:  return accept_all(connection);
+        case Connection::Role::Handshake: return read_hello(connection);
+        case Connection::Role::Outbound:  return flush(connection);
+        case Connection::Role::Inbound:   return fill(connection);
+    }
+    return false;
+}
+
+bool IoThread::accept_all(Connection& listener) {
+    bool progress = false;
+
+    while (listener.readable) {
+        const int fd = ::accept4(listener.fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (!would_block(errno)) RUNTIME_LOG_WARN("accept failed: {}", std::strerror(errno));
+            listener.readable = false;
+            break;
+        }
+
+        adopt(std::make_shared<Connection>(fd, Connection::Role::Handshake, 0));
+        progress = true;
+    }
+    return progress;
+}
+
+bool IoThread::read_hello(Connection& connection) {
+    while (connection.readable && connection.hello_received < HELLO_BYTES) {
+        const ssize_t n = ::read(connection.fd, connection.hello.data() + connection.hello_received,
+                                 HELLO_BYTES - connection.hello_received);
+        if (n > 0) {
+            connection.hello_received += static_cast<std::size_t>(n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && would_block(errno)) {
+            connection.readable = false;
+            return false;
+        }
+
+        retire(connection, true);       // peer hung up mid-hello
+        return true;
+    }
+
+    if (connection.hello_received < HELLO_BYTES) return false;
+
+    const std::optional<EdgeId> edge = decode_hello(connection.hello);
+    if (!edge) {
+        RUNTIME_LOG_WARN("dropping connection with an unknown hello");
+        retire(connection, true);
+        return true;
+    }
+
+    // The transport sizes the ring and re-adopts the connection on an I/O thread of its choosing; bytes that
+    // followed the hello wait in the socket and are reported again by the new registration
+    connection.edge = *edge;
+    connection.role = Connection::Role::Inbound;
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, connection.fd, nullptr);
+    connection.retired = true;
+    connection.handed_off = true;
+    return true;
+}
+
+bool IoThread::flush(Connection& connection) {
+    CORE_TRACE_SCOPE("transport", "IoThread::flush");
+
+    tm::channels::InMemoryChannel& ring = *connection.ring;
+    bool progress = false;
+
+    while (connection.writable) {
+        tm::channels::ReadableRegion region = ring.peek(max_write_bytes_);
+
+        if (region.empty()) {
+            if (!connection.closing.load(std::memory_order_acquire)) break;
+
+            // Sends that happened before close() are visible now
+            region = ring.peek(max_write_bytes_);
+            if (region.empty()) {
+                ::shutdown(connection.fd, SHUT_WR);
+                retire(connection, false);
+                return true;
+            }
+        }
+
+        iovec iov[2];
+        msghdr message{};
+        message.msg_iov = iov;
+        message.msg_iovlen = static_cast<std::size_t>(gather(region, iov));
+
+        // sendmsg rather than writev only for MSG_NOSIGNAL: a peer that went away is an error, not SIGPIPE
+        const ssize_t n = ::sendmsg(connection.fd, &message, MSG_NOSIGNAL);
+        if (n > 0) {
+            ring.release(static_cast<std::size_t>(n));
+            bump(bytes_sent_, static_cast<std::uint64_t>(n));
+            bump(writes_);
+            progress = true;
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && would_block(errno)) {
+            connection.writable = false;
+            break;
+        }
+
+        RUNTIME_LOG_WARN("edge {}: send failed: {}", connection.edge, std::strerror(errno));
+        retire(connection, true);
+        return true;
+    }
+    return progress;
+}
+
+bool IoThread::fill(Connection& connection) {
+    CORE_TRACE_SCOPE("transport", "IoThread::fill");
+
+    if (connection.closing.load(std::memory_order_relaxed)) {
+        retire(connection, false);
+        return true;
+    }
+
+    tm::channels::InMemoryChannel& ring = *connection.ring;
+    bool progress = false;
+
+    while (connection.readable) {
+        tm::channels::WritableRegion region = ring.reserve(ring.capacity());
+
+        if (region.empty()) {
+            // Announce the stall, then re-check: either the edge sees the flag after its next receive and
+            // kicks this thread, or the space it freed is visible here
+            connection.stalled.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            region = ring.reserve(ring.capacity());
+            if (region.empty()) break;
+        }
+        if (connection.stalled.load(std::memory_order_relaxed)) {
+            connection.stalled.store(false, std::memory_order_relaxed);
+        }
+
+        iovec iov[2];
+        const ssize_t n = ::readv(connection.fd, iov, scatter(region, iov));
+        if (n > 0) {
+            ring.publish(static_cast<std::size_t>(n));
+            bump(bytes_received_, static_cast<std::uint64_t>(n));
+            bump(reads_);
+            progress = true;
+            continue;
+        }
+        if (n == 0) {
+            retire(connection, false);      // orderly end of stream
+            return true;
+        }
+        if (errno == EINTR) continue;
+        if (would_block(errno)) {
+            connection.readable = false;
+            break;
+        }
+
+        RUNTIME_LOG_WARN("edge {}: receive failed: {}", connection.edge, std::strerror(errno));
+        retire(connection, true);
+        return true;
+    }
+    return progress;
+}
+
+void IoThread::retire(Connection& connection, const bool broken) noexcept {
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, connection.fd, nullptr);
+    connection.retired = true;
+    connection.broken.store(broken, std::memory_order_relaxed);
+    connection.finished.store(true, std::memory_order_release);
+}
+
+} // namespace lute::runtime::transport
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <transport/transport.h>
+#include <channels/InMemoryChannel.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace lute::runtime::transport {
+
+class IoThread;
+
+/**
+ * @brief First bytes on every connection: magic, wire version and the edge the stream belongs to
+ */
+constexpr std::size_t HELLO_BYTES = 16;
+
+std::array<std::byte, HELLO_BYTES> encode_hello(EdgeId edge) noexcept;
+
+/**
+ * @return The edge named by \p hello, or nothing if it is not a hello this build speaks
+ */
+std::optional<EdgeId> decode_hello(const std::array<std::byte, HELLO_BYTES>& hello) noexcept;
+
+/**
+ * @struct Connection
+ * @brief One socket and the ring that stages its bytes between an edge and an I/O thread
+ *
+ * For an outbound edge the edge produces into \c ring and the I/O thread consumes it with gathered writes;
+ * for an inbound edge the I/O thread produces with scattered reads and the edge consumes. The flags below
+ * the ring are the only state both sides touch.
+ */
+struct Connection {
+    enum class Role : std::uint8_t {
+        Listener,
+        Handshake,      // accepted, hello not complete yet
+        Outbound,
+        Inbound,
+    };
+
+    Connection(int fd, Role role, std::size_t ring_bytes);
+    ~Connection();
+
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+
+    const int fd;
+    Role role;
+    EdgeId edge = 0;
+    IoThread* owner = nullptr;
+    std::unique_ptr<tm::channels::InMemoryChannel> ring;       // absent on listeners
+
+    // I/O thread only. Readiness is edge-triggered, so each flag stays set until a syscall says EAGAIN.
+    bool readable = true;
+    bool writable = true;
+    bool retired = false;           // leaves this thread's list after the current pass
+    bool handed_off = false;        // hello complete, goes to the inbound handler
+    std::size_t hello_received = 0;
+    std::array<std::byte, HELLO_BYTES> hello{};
+
+    alignas(64) std::atomic<bool> closing{false};     // outbound: send what is queued, then shut down;
+                                                       // inbound: the edge is gone, drop the connection
+    std::atomic<bool> stalled{false};                  // inbound: ring full, waiting for the edge to read
+    std::atomic<bool> finished{false};                 // no more bytes will move on this connection
+    std::atomic<bool> broken{false};
+};
+
+/**
+ * @class IoThread
+ * @brief epoll loop that moves bytes between connection rings and their sockets
+ *
+ * Each pass drains every connection until its ring or its socket runs dry: one \c sendmsg gathers everything
+ * queued in an outbound ring (both halves of a wrapped region, up to \c max_write_bytes), one \c readv
+ * scatters into all free space of an inbound ring. Inbound reads stop while the ring is full, so a slow
+ * consumer closes the TCP window instead of growing a buffer.
+ *
+ * With nothing to do the thread announces itself as sleeping, re-checks, and blocks in \c epoll_wait; edges
+ * ring its eventfd only when they see that announcement, so a busy stream costs no wakeup syscalls.
+ *
+ * @thread Own thread; \ref adopt and \ref kick from any thread
+ */
+class IoThread {
+public:
+    /**
+     * @brief Receives connections whose hello has arrived; called on the I/O thread that accepted them
+     */
+    using InboundHandler = std::function<void(std::shared_ptr<Connection>)>;
+
+    /**
+     * @param cpu CPU to pin to, or -1 to leave the thread unpinned
+     * @throw std::runtime_error if the epoll instance or eventfd cannot be created
+     */
+    IoThread(std::size_t index, int cpu, std::size_t max_write_bytes, InboundHandler on_inbound);
+    ~IoThread();
+
+    IoThread(const IoThread&) = delete;
+    IoThread& operator=(const IoThread&) = delete;
+
+    /**
+     * @throw std::runtime_error if pinning fails
+     */
+    void start();
+
+    /**
+     * @brief Stops and joins the thread; connections it still serves are dropped. Idempotent.
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief Hands \p connection to this thread, which registers it with epoll on its next pass
+     */
+    void adopt(std::shared_ptr<Connection> connection);
+
+    /**
+     * @brief Wakes the thread if it is blocked in epoll_wait; callers publish their change first
+     */
+    void kick() noexcept;
+
+    TransportStats stats() const noexcept;
+
+private:
+    void run() noexcept;
+    void take_adopted();
+    bool has_work() const noexcept;
+    void wait();
+
+    bool service(Connection& connection);
+    bool accept_all(Connection& listener);
+    bool read_hello(Connection& connection);
+    bool flush(Connection& connection);
+    bool fill(Connection& connection);
+    void retire(Connection& connection, bool broken) noexcept;
+
+    const std::size_t index_;
+    const int cpu_;
+    const std::size_t max_write_bytes_;
+    const InboundHandler on_inbound_;
+
+    int epoll_fd_ = -1;
+    int event_fd_ = -1;
+
+    std::vector<std::shared_ptr<Connection>> connections_;
+
+    std::mutex adopt_mutex_;
+    std::vector<std::shared_ptr<Connection>> adopted_;
+    std::atomic<bool> adopt_pending_{false};
+
+    alignas(64) std::atomic<bool> sleeping_{false};
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+
+    // Single writer (the I/O thread)
+    alignas(64) std::atomic<std::uint64_t> bytes_sent_{0};
+    std::atomic<std::uint64_t> bytes_received_{0};
+    std::atomic<std::uint64_t> writes_{0};
+    std::atomic<std::uint64_t> reads_{0};
+    std::atomic<std::uint64_t> wakeups_{0};
+};
+
+} // namespace lute::runtime::transport
@@ -0,0 +1,276 @@
+#include <transport/tcp_transport.h>
+#include <trace.h>
+
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace lute::runtime::transport {
+
+namespace {
+
+class TcpOutboundEdge final : public OutboundEdge {
+public:
+    explicit TcpOutboundEdge(std::shared_ptr<Connection> connection)
+        : connection_(std::move(connection)),
+          ring_(*connection_->ring)
+    {}
+
+    ~TcpOutboundEdge() override { close(); }
+
+    std::size_t send(const void* buffer, const std::size_t size) override {
+        CORE_TRACE_SCOPE("transport", "TcpOutboundEdge::send");
+
+        if (closed_) return 0;
+
+        const std::size_t sent = ring_.send(buffer, size);
+        if (sent != 0) connection_->owner->kick();
+        return sent;
+    }
+
+    void close() noexcept override {
+        if (closed_) return;
+        closed_ = true;
+
+        connection_->closing.store(true, std::memory_order_release);
+        connection_->owner->kick();
+    }
+
+    bool drained() const noexcept override {
+        return connection_->finished.load(std::memory_order_acquire)
+            || ring_.reserve(ring_.capacity()).size() == ring_.capacity();
+    }
+
+    bool failed() const noexcept override {
+        return connection_->finished.load(std::memory_order_acquire)
+            && connection_->broken.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::shared_ptr<Connection> connection_;
+    tm::channels::InMemoryChannel& ring_;
+    bool closed_ = false;
+};
+
+class TcpInboundEdge final : public InboundEdge {
+public:
+    explicit TcpInboundEdge(std::shared_ptr<Connection> connection)
+        : connection_(std::move(connection)),
+          ring_(*connection_->ring)
+    {}
+
+    // The I/O thread drops the connection instead of reading into a ring nobody drains
+    ~TcpInboundEdge() override {
+        connection_->closing.store(true, std::memory_order_release);
+        connection_->owner->kick();
+    }
+
+    std::size_t receive(void* buffer, const std::size_t capacity) override {
+        CORE_TRACE_SCOPE("transport", "TcpInboundEdge::receive");
+
+        const std::size_t received = ring_.receive(buffer, capacity);
+        if (received != 0) {
+            // Pairs with the fence in IoThread::fill: a stalled reader either sees the space freed here, or
+            // this sees its stall
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (connection_->stalled.load(std::memory_order_relaxed)) connection_->owner->kick();
+        }
+        return received;
+    }
+
+    bool closed() const noexcept override {
+        return connection_->finished.load(std::memory_order_acquire) && ring_.peek(1).empty();
+    }
+
+private:
+    std::shared_ptr<Connection> connection_;
+    tm::channels::InMemoryChannel& ring_;
+};
+
+} // namespace
+
+static std::string where(const std::string& host, const std::uint16_t port) {
+    return host + ":" + std::to_string(port);
+}
+
+static addrinfo* resolve(const std::string& host, const std::uint16_t port, const bool passive) {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = passive ? AI_PASSIVE : 0;
+
+    addrinfo* result = nullptr;
+    const int rc = ::getaddrinfo(host.empty() ? nullptr : host.c_str(), std::to_string(port).c_str(), &hints, &result);
+    if (rc != 0) {
+        throw std::runtime_error("resolving " + where(host, port) + " failed: " + std::string(::gai_strerror(rc)));
+    }
+    return result;
+}
+
+static void send_all(const int fd, const std::byte* data, std::size_t size) {
+    while (size != 0) {
+        const ssize_t n = ::send(fd, data, size, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) throw std::runtime_error("sending hello failed: " + std::string(std::strerror(errno)));
+
+        data += n;
+        size -= static_cast<std::size_t>(n);
+    }
+}
+
+TcpTransport::TcpTransport(TransportOptions options)
+    : options_(std::move(options))
+{
+    if (options_.io_threads == 0) {
+        throw std::runtime_error("Transport needs at least one I/O thread");
+    }
+    if (options_.ring_bytes < 64 || (options_.ring_bytes & (options_.ring_bytes - 1)) != 0) {
+        throw std::runtime_error("Transport ring_bytes must be a power of two of at least 64 bytes");
+    }
+    if (options_.max_write_bytes == 0) {
+        throw std::runtime_error("Transport max_write_bytes must be positive");
+    }
+
+    const auto on_inbound = [this](std::shared_ptr<Connection> connection) { this->on_inbound(std::move(connection)); };
+
+    threads_.reserve(options_.io_threads);
+    for (std::size_t i = 0; i < options_.io_threads; ++i) {
+        const int cpu = options_.io_cpus.empty() ? -1 : options_.io_cpus[i % options_.io_cpus.size()];
+        threads_.push_back(std::make_unique<IoThread>(i, cpu, options_.max_write_bytes, on_inbound));
+    }
+
+    // A failed start leaves the started threads to the destructors, which stop them
+    for (auto& thread : threads_) thread->start();
+}
+
+TcpTransport::~TcpTransport() {
+    for (auto& thread : threads_) thread->stop();
+}
+
+std::uint16_t TcpTransport::listen(const std::string& host, const std::uint16_t port) {
+    addrinfo* const addresses = resolve(host, port, true);
+
+    int fd = -1;
+    int error = 0;
+    for (const addrinfo* address = addresses; address != nullptr; address = address->ai_next) {
+        fd = ::socket(address->ai_family, address->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, address->ai_protocol);
+        if (fd < 0) {
+            error = errno;
+            continue;
+        }
+
+        const int on = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+        if (::bind(fd, address->ai_addr, address->ai_addrlen) == 0 && ::listen(fd, SOMAXCONN) == 0) break;
+
+        error = errno;
+        ::close(fd);
+        fd = -1;
+    }
+    ::freeaddrinfo(addresses);
+
+    if (fd < 0) throw std::runtime_error("listening on " + where(host, port) + " failed: " + std::string(std::strerror(error)));
+
+    sockaddr_storage bound{};
+    socklen_t length = sizeof(bound);
+    ::getsockname(fd, reinterpret_cast<sockaddr*>(&bound), &length);
+    const std::uint16_t bound_port = ntohs(bound.ss_family == AF_INET6
+        ? reinterpret_cast<const sockaddr_in6*>(&bound)->sin6_port
+        : reinterpret_cast<const sockaddr_in*>(&bound)->sin_port);
+
+    // Accepting and reading hellos is rare work; the first I/O thread does it for every listener
+    threads_.front()->adopt(std::make_shared<Connection>(fd, Connection::Role::Listener, 0));
+    return bound_port;
+}
+
+std::unique_ptr<OutboundEdge> TcpTransport::connect(const std::string& host, const std::uint16_t port, const EdgeId edge) {
+    addrinfo* const addresses = resolve(host, port, false);
+
+    int fd = -1;
+    int error = 0;
+    for (const addrinfo* address = addresses; address != nullptr; address = address->ai_next) {
+        fd = ::socket(address->ai_family, address->ai_socktype | SOCK_CLOEXEC, address->ai_protocol);
+        if (fd < 0) {
+            error = errno;
+            continue;
+        }
+        if (::connect(fd, address->ai_addr, address->ai_addrlen) == 0) break;
+
+        error = errno;
+        ::close(fd);
+        fd = -1;
+    }
+    ::freeaddrinfo(addresses);
+
+    if (fd < 0) throw std::runtime_error("connecting to " + where(host, port) + " failed: " + std::string(std::strerror(error)));
+
+    // The Connection owns the descriptor from here on, and closes it if the hello fails
+    auto connection = std::make_shared<Connection>(fd, Connection::Role::Outbound, options_.ring_bytes);
+    connection->edge = edge;
+
+    const int on = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+    const auto hello = encode_hello(edge);
+    send_all(fd, hello.data(), hello.size());
+
+    if (::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK) != 0) {
+        throw std::runtime_error("fcntl failed: " + std::string(std::strerror(errno)));
+    }
+
+    next_thread().adopt(connection);
+    return std::make_unique<TcpOutboundEdge>(std::move(connection));
+}
+
+std::unique_ptr<InboundEdge> TcpTransport::accept(const EdgeId edge, const std::chrono::milliseconds timeout) {
+    std::unique_lock lock(inbound_mutex_);
+
+    const bool arrived = inbound_ready_.wait_for(lock, timeout, [&]() { return inbound_.contains(edge); });
+    if (!arrived) return nullptr;
+
+    const auto it = inbound_.find(edge);
+    auto connection = std::move(it->second);
+    inbound_.erase(it);
+
+    return std::make_unique<TcpInboundEdge>(std::move(connection));
+}
+
+TransportStats TcpTransport::stats() const noexcept {
+    TransportStats total{};
+    for (const auto& thread : threads_) {
+        const TransportStats stats = thread->stats();
+        total.bytes_sent += stats.bytes_sent;
+        total.bytes_received += stats.bytes_received;
+        total.writes += stats.writes;
+        total.reads += stats.reads;
+        total.wakeups += stats.wakeups;
+    }
+    return total;
+}
+
+IoThread& TcpTransport::next_thread() noexcept {
+    const std::size_t ticket = next_thread_.fetch_add(1, std::memory_order_relaxed);
+    return *threads_[ticket % threads_.size()];
+}
+
+void TcpTransport::on_inbound(std::shared_ptr<Connection> connection) {
+    connection->ring = std::make_unique<tm::channels::InMemoryChannel>(options_.ring_bytes);
+    next_thread().adopt(connection);
+
+    {
+        std::lock_guard lock(inbound_mutex_);
+        inbound_.emplace(connection->edge, std::move(connection));
+    }
+    inbound_ready_.notify_all();
+}
+
+} // namespace lute::runtime::transport
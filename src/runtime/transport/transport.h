@@ -0,0 +1,122 @@
+#pragma once
+
+#include <channels/IChannel.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace lute::runtime::transport {
+
+/**
+ * @brief Identifies one remote edge of the job graph; both ends of the edge must agree on it
+ */
+using EdgeId = std::uint64_t;
+
+/**
+ * @brief I/O threads and staging of a transport; the \c [transport] config section
+ */
+struct TransportOptions {
+    std::size_t io_threads = 1;
+    std::vector<int> io_cpus;                   // I/O thread i is pinned to io_cpus[i % size]; keep off worker_cpus
+    std::size_t ring_bytes = 1 << 20;           // per-edge staging ring, power of two
+    std::size_t max_write_bytes = 256 * 1024;   // upper bound of one writev
+};
+
+/**
+ * @struct TransportStats
+ * @brief Totals over all edges of a transport; \c bytes_sent / \c writes is the achieved batching
+ */
+struct TransportStats {
+    std::uint64_t bytes_sent;
+    std::uint64_t bytes_received;
+    std::uint64_t writes;
+    std::uint64_t reads;
+    std::uint64_t wakeups;
+};
+
+/**
+ * @class OutboundEdge
+ * @brief Sending end of a remote edge
+ *
+ * \c send follows the \ref tm::channels::IChannel contract: it copies what fits and never blocks, so a
+ * short count is backpressure from the network. Bytes are delivered in order; message boundaries are not
+ * kept, frame the stream (e.g. with \ref tm::channels::FramedWriter over a local ring) if they matter.
+ *
+ * @thread One data-plane thread
+ */
+class OutboundEdge : public tm::channels::IChannel {
+public:
+    std::size_t receive(void*, std::size_t) final { return 0; }
+
+    /**
+     * @brief Ends the stream once everything already sent is on the wire; later sends return 0
+     */
+    virtual void close() noexcept = 0;
+
+    /**
+     * @return true once every byte sent has been handed to the network, or the connection failed
+     */
+    virtual bool drained() const noexcept = 0;
+
+    /**
+     * @return true if the connection broke; bytes still queued are lost
+     */
+    virtual bool failed() const noexcept = 0;
+};
+
+/**
+ * @class InboundEdge
+ * @brief Receiving end of a remote edge; \c receive returns 0 when nothing has arrived yet
+ *
+ * @thread One data-plane thread
+ */
+class InboundEdge : public tm::channels::IChannel {
+public:
+    std::size_t send(const void*, std::size_t) final { return 0; }
+
+    /**
+     * @return true once the peer has closed (or the connection failed) and every byte has been received
+     */
+    virtual bool closed() const noexcept = 0;
+};
+
+/**
+ * @class Transport
+ * @brief Carries remote edges between task managers behind the \ref tm::channels::IChannel contract
+ *
+ * Operators see an edge as a channel and never touch a socket: the backend stages bytes in per-edge rings
+ * and moves them on its own I/O threads, which are kept off the data-plane cores.
+ *
+ * @thread Setup (\ref listen, \ref connect, \ref accept) from the control plane; edges from their owners
+ */
+class Transport {
+public:
+    virtual ~Transport() = default;
+
+    /**
+     * @brief Starts accepting edges on \p host : \p port; port 0 picks a free one
+     *
+     * @return The bound port
+     */
+    virtual std::uint16_t listen(const std::string& host, std::uint16_t port) = 0;
+
+    /**
+     * @brief Opens the sending end of \p edge towards a peer that is listening on \p host : \p port
+     */
+    virtual std::unique_ptr<OutboundEdge> connect(const std::string& host, std::uint16_t port, EdgeId edge) = 0;
+
+    /**
+     * @brief Waits up to \p timeout for a peer to connect \p edge
+     *
+     * @return The receiving end, or nullptr on timeout
+     */
+    virtual std::unique_ptr<InboundEdge> accept(EdgeId edge, std::chrono::milliseconds timeout) = 0;
+
+    virtual TransportStats stats() const noexcept = 0;
+};
+
+} // namespace lute::runtime::transport
@@ -0,0 +1,26 @@
+#include <util/helpers.h>
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace lute::runtime::util {
+
+std::runtime_error file_error(const std::string& what, const std::string& path, const int error) {
+    return std::runtime_error(what + " " + path + " failed: " + std::string(std::strerror(error)));
+}
+
+void write_all(const int fd, const void* data, std::size_t size, const std::string& path) {
+    const auto* bytes = static_cast<const std::byte*>(data);
+    while (size != 0) {
+        const ssize_t n = ::write(fd, bytes, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) throw file_error("write", path, errno);
+
+        bytes += n;
+        size -= static_cast<std::size_t>(n);
+    }
+}
+
+} // namespace lute::runtime::util
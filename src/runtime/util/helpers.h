@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace lute::runtime::util {
+
+/**
+ * @brief "<what> <path> failed: <strerror(error)>"
+ */
+std::runtime_error file_error(const std::string& what, const std::string& path, int error);
+
+/**
+ * @brief Writes all \p size bytes to \p fd, retrying short writes and EINTR
+ *
+ * @throw std::runtime_error (\ref file_error naming \p path) if a write fails
+ */
+void write_all(int fd, const void* data, std::size_t size, const std::string& path);
+
+} // namespace lute::runtime::util
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <trace.h>
+#include <channels/Channel.h>
+#include <channels/RingRegion.h>
+#include <memory/PlacedBuffer.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <cassert>
+
+namespace lute::tm::channels {
+
+/**
+ * @class CachedInMemoryChannel
+ * @brief SPSC byte ring where each side keeps a private copy of the other side's index
+ *
+ * Same contract as \ref InMemoryChannel. The producer only re-reads \c read_index_ when its cached copy
+ * says the ring is too full for the request, and the consumer only re-reads \c write_index_ when its cached
+ * copy holds fewer bytes than requested, so in steady state neither side touches the other's cache line.
+ * Consumers that peek "everything" (the default argument) always refresh; ask for what you need instead.
+ *
+ * Layout: read-only configuration, producer line (write index + cached read index) and consumer line
+ * (read index + cached write index) each sit on their own cache line.
+ */
+class CachedInMemoryChannel : public Channel<CachedInMemoryChannel> {
+public:
+    /**
+     * @param capacity_power_of_two Ring size in bytes
+     * @param placement Where the ring lives, typically the consumer's NUMA node; see \ref memory::PlacedBuffer
+     */
+    explicit CachedInMemoryChannel(std::size_t capacity_power_of_two, memory::MemoryPlacement placement = {})
+        : capacity_(capacity_power_of_two),
+          mask_(capacity_power_of_two - 1),
+          buffer_(capacity_power_of_two, placement),
+          write_index_(0),
+          cached_read_index_(0),
+          read_index_(0),
+          cached_write_index_(0)
+    {
+        assert((capacity_power_of_two & (capacity_power_of_two - 1)) == 0);
+    }
+
+    std::size_t send(const void* data, std::size_t size) {
+        CORE_TRACE_SCOPE("channel", "CachedInMemoryChannel::send");
+
+        const WritableRegion region = reserve(size);
+        const std::size_t to_write = region.size();
+
+        if (to_write == 0) return 0;
+
+        copy_into(region, data, to_write);
+
+        publish(to_write);
+        return to_write;
+    }
+
+    std::size_t receive(void* data, std::size_t size) {
+        CORE_TRACE_SCOPE("channel", "CachedInMemoryChannel::receive");
+
+        const ReadableRegion region = peek(size);
+        const std::size_t to_read = region.size();
+
+        if (to_read == 0) return 0;
+
+        copy_from(region, data, to_read);
+
+        release(to_read);
+        return to_read;
+    }
+
+    /**
+     * @copydoc InMemoryChannel::reserve
+     */
+    WritableRegion reserve(std::size_t size) noexcept {
+        const std::size_t w = write_index_.load(std::memory_order_relaxed);
+
+        std::size_t available = capacity_ - (w - cached_read_index_);
+        if (available < size) {
+            cached_read_index_ = read_index_.load(std::memory_order_acquire);
+            available = capacity_ - (w - cached_read_index_);
+        }
+
+        const std::size_t to_write = (size < available) ? size : available;
+        return split_region(buffer_.get(), capacity_, w & mask_, to_write);
+    }
+
+    /**
+     * @copydoc InMemoryChannel::publish
+     */
+    void publish(std::size_t size) noexcept {
+        const std::size_t w = write_index_.load(std::memory_order_relaxed);
+        assert(size <= capacity_ - (w - cached_read_index_));
+
+        write_index_.store(w + size, std::memory_order_release);
+    }
+
+    /**
+     * @copydoc InMemoryChannel::peek
+     */
+    ReadableRegion peek(std::size_t size = std::numeric_limits<std::size_t>::max()) noexcept {
+        const std::size_t r = read_index_.load(std::memory_order_relaxed);
+
+        std::size_t available = cached_write_index_ - r;
+        if (available < size) {
+            cached_write_index_ = write_index_.load(std::memory_order_acquire);
+            available = cached_write_index_ - r;
+        }
+
+        const std::size_t to_read = (size < available) ? size : available;
+        return split_region<const std::byte>(buffer_.get(), capacity_, r & mask_, to_read);
+    }
+
+    /**
+     * @copydoc InMemoryChannel::release
+     */
+    void release(std::size_t size) noexcept {
+        const std::size_t r = read_index_.load(std::memory_order_relaxed);
+        assert(size <= cached_write_index_ - r);
+
+        read_index_.store(r + size, std::memory_order_release);
+    }
+
+    std::size_t capacity() const noexcept { return capacity_; }
+
+private:
+    const std::size_t capacity_;
+    const std::size_t mask_;
+
+    memory::PlacedBuffer buffer_;
+
+    alignas(64) std::atomic<std::size_t> write_index_;
+    std::size_t cached_read_index_;
+
+    alignas(64) std::atomic<std::size_t> read_index_;
+    std::size_t cached_write_index_;
+};
+
+} // namespace lute::tm::channels
@@ -1,8 +1,9 @@
 #pragma once
 
-#include <channels/IChannel.h>
+#include <channels/ChannelConcept.h>
 
 #include <cstddef>
+#include <type_traits>
 
 namespace lute::tm::channels {
 
@@ -11,22 +12,35 @@ namespace lute::tm::channels {
  * @brief CRTP base class for channel implementations
  * 
  * This class uses the Curiously Recurring Template Pattern (CRTP) to provide
- * static polymorphism while maintaining interface compatibility with IChannel.
+ * static polymorphism. Calls through \c Channel<Impl>& resolve at compile time; there is no vtable.
+ * Runtime polymorphism is opt-in through \ref ChannelAdapter, which exposes any channel as an \ref IChannel.
  */
 template<typename ChannelImpl>
-class Channel: public IChannel {
+class Channel {
 public:
     Channel() = default;
 
-    std::size_t receive(void* const buffer, const std::size_t maxCapacity) override {
-        return static_cast<ChannelImpl*>(this)->receive(buffer, maxCapacity);
+    std::size_t receive(void* const buffer, const std::size_t maxCapacity) {
+        return impl().receive(buffer, maxCapacity);
     }
 
-    std::size_t send(void* const buffer, const std::size_t size) override {
-        return static_cast<ChannelImpl*>(this)->send(buffer, size);
+    std::size_t send(const void* const buffer, const std::size_t size) {
+        return impl().send(buffer, size);
     }
-    
+
+protected:
+    ~Channel() {
+        // ByteChannel alone always holds through the forwarders above; an implementation that inherits them
+        // instead of declaring its own would recurse forever
+        static_assert(!std::is_same_v<decltype(&ChannelImpl::send), decltype(&Channel::send)>,
+                      "Channel implementations must declare send()");
+        static_assert(!std::is_same_v<decltype(&ChannelImpl::receive), decltype(&Channel::receive)>,
+                      "Channel implementations must declare receive()");
+        static_assert(ByteChannel<ChannelImpl>, "Channel implementations must satisfy ByteChannel");
+    }
+
 private:
+    ChannelImpl& impl() noexcept { return static_cast<ChannelImpl&>(*this); }
 };
 
-} // lute::tm::channels
\ No newline at end of file
+} // lute::tm::channels
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <channels/ChannelConcept.h>
+#include <channels/IChannel.h>
+
+#include <cstddef>
+
+namespace lute::tm::channels {
+
+/**
+ * @class ChannelAdapter
+ * @brief Exposes a concrete channel through \ref IChannel for the L3 (type-erased) operator tier
+ *
+ * The adapter is \c final, so the only indirect call is the one through \ref IChannel; forwarding into
+ * the wrapped channel is direct. It does not own the channel.
+ */
+template<ByteChannel ChannelImpl>
+class ChannelAdapter final : public IChannel {
+public:
+    explicit ChannelAdapter(ChannelImpl& channel) noexcept
+        : channel_(channel)
+    {}
+
+    std::size_t receive(void* const buffer, const std::size_t capacity) override {
+        return channel_.receive(buffer, capacity);
+    }
+
+    std::size_t send(const void* const buffer, const std::size_t size) override {
+        return channel_.send(buffer, size);
+    }
+
+    ChannelImpl& channel() noexcept { return channel_; }
+
+private:
+    ChannelImpl& channel_;
+};
+
+} // lute::tm::channels
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <channels/RingRegion.h>
+
+#include <concepts>
+#include <cstddef>
+
+namespace lute::tm::channels {
+
+/**
+ * @concept ByteChannel
+ * @brief Static-dispatch channel contract for the L4 operator tier
+ *
+ * L4 operators are templated on the concrete channel type and constrained by this concept, so every
+ * send/receive is a direct (usually inlined) call.
+ */
+template<typename C>
+concept ByteChannel = requires(C& channel, const void* in, void* out, std::size_t size) {
+    { channel.send(in, size) } -> std::same_as<std::size_t>;
+    { channel.receive(out, size) } -> std::same_as<std::size_t>;
+};
+
+/**
+ * @concept ZeroCopyChannel
+ * @brief \ref ByteChannel that also exposes in-place reserve/publish and peek/release
+ */
+template<typename C>
+concept ZeroCopyChannel = ByteChannel<C> && requires(C& channel, std::size_t size) {
+    { channel.reserve(size) } -> std::same_as<WritableRegion>;
+    { channel.publish(size) };
+    { channel.peek(size) } -> std::same_as<ReadableRegion>;
+    { channel.release(size) };
+    { channel.capacity() } -> std::convertible_to<std::size_t>;
+};
+
+} // lute::tm::channels
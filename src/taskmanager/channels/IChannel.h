@@ -4,11 +4,18 @@
 
 namespace lute::tm::channels {
 
+/**
+ * @class IChannel
+ * @brief Type-erased channel interface for the L3 operator tier
+ *
+ * Concrete channels do not derive from it; wrap them in a \ref ChannelAdapter when a runtime-polymorphic
+ * boundary is needed. L4 operators take the concrete channel type directly (see \ref ByteChannel).
+ */
 class IChannel {
 public:
     virtual ~IChannel() = default;
     virtual std::size_t receive(void* buffer, std::size_t capacity) = 0;
-    virtual std::size_t send(void* buffer, std::size_t size) = 0;
+    virtual std::size_t send(const void* buffer, std::size_t size) = 0;
 };
 
-} // lute::tm::channels
\ No newline at end of file
+} // lute::tm::channels
@@ -1,22 +1,29 @@
 #pragma once
 
+#include <trace.h>
 #include <channels/Channel.h>
+#include <channels/RingRegion.h>
+#include <memory/PlacedBuffer.h>
 
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <memory>
+#include <limits>
 #include <cassert>
 
 namespace lute::tm::channels {
 
 class InMemoryChannel : public Channel<InMemoryChannel> {
 public:
-    explicit InMemoryChannel(std::size_t capacity_power_of_two)
+    /**
+     * @param capacity_power_of_two Ring size in bytes
+     * @param placement Where the ring lives, typically the consumer's NUMA node; see \ref memory::PlacedBuffer
+     */
+    explicit InMemoryChannel(std::size_t capacity_power_of_two, memory::MemoryPlacement placement = {})
         : capacity_(capacity_power_of_two),
           mask_(capacity_power_of_two - 1),
-          buffer_(std::make_unique<std::byte[]>(capacity_power_of_two)),
+          buffer_(capacity_power_of_two, placement),
           write_index_(0),
           read_index_(0)
     {
@@ -24,52 +31,99 @@ public:
     }
 
     std::size_t send(const void* data, std::size_t size) {
+        CORE_TRACE_SCOPE("channel", "InMemoryChannel::send");
+
+        const WritableRegion region = reserve(size);
+        const std::size_t to_write = region.size();
+
+        if (to_write == 0) return 0;
+
+        copy_into(region, data, to_write);
+
+        publish(to_write);
+        return to_write;
+    }
+
+    std::size_t receive(void* data, std::size_t size) {
+        CORE_TRACE_SCOPE("channel", "InMemoryChannel::receive");
+
+        const ReadableRegion region = peek(size);
+        const std::size_t to_read = region.size();
+
+        if (to_read == 0) return 0;
+
+        copy_from(region, data, to_read);
+
+        release(to_read);
+        return to_read;
+    }
+
+    /**
+     * @brief Returns up to \p size bytes of free ring space for the producer to write into in place
+     *
+     * The region is not visible to the consumer until \ref publish is called. Calling reserve again
+     * before publishing returns a region starting at the same position.
+     *
+     * @return Possibly wrapped region; shorter than \p size (or empty) when the ring is (nearly) full
+     *
+     * @thread Producer
+     */
+    WritableRegion reserve(std::size_t size) noexcept {
         const std::size_t w = write_index_.load(std::memory_order_relaxed);
         const std::size_t r = read_index_.load(std::memory_order_acquire);
 
         const std::size_t available = capacity_ - (w - r);
         const std::size_t to_write = (size < available) ? size : available;
 
-        if (to_write == 0) return 0;
-
-        const std::size_t write_pos = w & mask_;
-        const std::size_t first_chunk = std::min(to_write, capacity_ - write_pos);
+        return split_region(buffer_.get(), capacity_, w & mask_, to_write);
+    }
 
-        std::memcpy(buffer_.get() + write_pos, data, first_chunk);
-        std::memcpy(buffer_.get(), 
-                    static_cast<const std::byte*>(data) + first_chunk,
-                    to_write - first_chunk);
+    /**
+     * @brief Makes the first \p size bytes of the last reservation visible to the consumer
+     *
+     * @thread Producer
+     */
+    void publish(std::size_t size) noexcept {
+        const std::size_t w = write_index_.load(std::memory_order_relaxed);
+        assert(size <= capacity_ - (w - read_index_.load(std::memory_order_relaxed)));
 
-        write_index_.store(w + to_write, std::memory_order_release);
-        return to_write;
+        write_index_.store(w + size, std::memory_order_release);
     }
 
-    std::size_t receive(void* data, std::size_t size) {
+    /**
+     * @brief Returns up to \p size readable bytes in place, without consuming them
+     *
+     * @thread Consumer
+     */
+    ReadableRegion peek(std::size_t size = std::numeric_limits<std::size_t>::max()) const noexcept {
         const std::size_t r = read_index_.load(std::memory_order_relaxed);
         const std::size_t w = write_index_.load(std::memory_order_acquire);
 
         const std::size_t available = w - r;
         const std::size_t to_read = (size < available) ? size : available;
 
-        if (to_read == 0) return 0;
-
-        const std::size_t read_pos = r & mask_;
-        const std::size_t first_chunk = std::min(to_read, capacity_ - read_pos);
+        return split_region<const std::byte>(buffer_.get(), capacity_, r & mask_, to_read);
+    }
 
-        std::memcpy(data, buffer_.get() + read_pos, first_chunk);
-        std::memcpy(static_cast<std::byte*>(data) + first_chunk,
-                    buffer_.get(),
-                    to_read - first_chunk);
+    /**
+     * @brief Hands the first \p size peeked bytes back to the producer
+     *
+     * @thread Consumer
+     */
+    void release(std::size_t size) noexcept {
+        const std::size_t r = read_index_.load(std::memory_order_relaxed);
+        assert(size <= write_index_.load(std::memory_order_relaxed) - r);
 
-        read_index_.store(r + to_read, std::memory_order_release);
-        return to_read;
+        read_index_.store(r + size, std::memory_order_release);
     }
 
+    std::size_t capacity() const noexcept { return capacity_; }
+
 private:
     const std::size_t capacity_;
     const std::size_t mask_;
 
-    std::unique_ptr<std::byte[]> buffer_;
+    memory::PlacedBuffer buffer_;
 
     alignas(64) std::atomic<std::size_t> write_index_;
     alignas(64) std::atomic<std::size_t> read_index_;
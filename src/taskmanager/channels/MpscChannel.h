@@ -0,0 +1,204 @@
+#pragma once
+
+#include <trace.h>
+#include <channels/Channel.h>
+#include <memory/PlacedBuffer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <cassert>
+
+namespace lute::tm::channels {
+
+/**
+ * @class MpscChannel
+ * @brief Bounded lock-free multi-producer single-consumer channel for input fan-in
+ *
+ * The ring is made of fixed-size slots, each carrying one message of at most \c slot_payload bytes.
+ * Every slot has a sequence number (Vyukov bounded queue):
+ *
+ * - \c sequence == pos             slot is free for the producer claiming position \c pos
+ * - \c sequence == pos + 1         slot holds a fully published message for the consumer
+ * - \c sequence == pos + slots     slot was consumed and is free for the next lap
+ *
+ * Producers claim a position with a single CAS on \c tail_, write the payload, then publish it with a
+ * release store of the slot sequence. The consumer only reads a slot once its sequence says it is published,
+ * so partially written messages are never observed even though producers finish out of order.
+ *
+ * \c send is all-or-nothing per message; \c receive drains published messages as a byte stream in
+ * claim order. \c peek / \c release give zero-copy access to one message at a time.
+ */
+class MpscChannel : public Channel<MpscChannel> {
+public:
+    /**
+     * @param slot_count_power_of_two Number of message slots
+     * @param slot_payload Maximum message size in bytes
+     * @param placement Where the slots live, typically the consumer's NUMA node; see \ref memory::PlacedBuffer
+     */
+    MpscChannel(std::size_t slot_count_power_of_two, std::size_t slot_payload, memory::MemoryPlacement placement = {})
+        : slots_(slot_count_power_of_two),
+          mask_(slot_count_power_of_two - 1),
+          slot_payload_(slot_payload),
+          stride_(round_to_cache_line(sizeof(SlotHeader) + slot_payload)),
+          buffer_(stride_ * slot_count_power_of_two, placement),
+          storage_(buffer_.get()),
+          tail_(0),
+          head_(0),
+          head_offset_(0)
+    {
+        assert((slot_count_power_of_two & (slot_count_power_of_two - 1)) == 0);
+
+        for (std::size_t i = 0; i < slots_; ++i) {
+            new (storage_ + i * stride_) SlotHeader{ {i}, 0 };
+        }
+    }
+
+    MpscChannel(const MpscChannel&) = delete;
+    MpscChannel& operator=(const MpscChannel&) = delete;
+
+    ~MpscChannel() {
+        for (std::size_t i = 0; i < slots_; ++i) {
+            header_at(i)->~SlotHeader();
+        }
+    }
+
+    /**
+     * @brief Publishes \p data as one message
+     *
+     * @return \p size on success; 0 if the channel is full or \p size exceeds the slot payload
+     *
+     * @thread Any producer
+     */
+    std::size_t send(const void* data, std::size_t size) {
+        CORE_TRACE_SCOPE("channel", "MpscChannel::send");
+
+        if (size == 0 || size > slot_payload_) return 0;
+
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        SlotHeader* slot;
+
+        for (;;) {
+            slot = header_at(pos & mask_);
+            const std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return 0;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::memcpy(payload_of(slot), data, size);
+        slot->size = static_cast<std::uint32_t>(size);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return size;
+    }
+
+    /**
+     * @brief Copies up to \p size bytes of published messages, in claim order. A message that does not fit
+     * is split; the remainder is returned by the next call.
+     *
+     * @thread Consumer
+     */
+    std::size_t receive(void* data, std::size_t size) {
+        CORE_TRACE_SCOPE("channel", "MpscChannel::receive");
+
+        auto* out = static_cast<std::byte*>(data);
+        std::size_t copied = 0;
+
+        while (copied < size) {
+            SlotHeader* slot = header_at(head_ & mask_);
+            if (slot->sequence.load(std::memory_order_acquire) != head_ + 1) break;
+
+            const std::size_t n = std::min<std::size_t>(slot->size - head_offset_, size - copied);
+            std::memcpy(out + copied, payload_of(slot) + head_offset_, n);
+
+            copied += n;
+            head_offset_ += n;
+
+            if (head_offset_ == slot->size) {
+                free_slot(slot);
+            }
+        }
+
+        return copied;
+    }
+
+    /**
+     * @brief Returns the unread part of the next published message in place, or an empty span
+     *
+     * @thread Consumer
+     */
+    std::span<const std::byte> peek() const noexcept {
+        const SlotHeader* slot = header_at(head_ & mask_);
+        if (slot->sequence.load(std::memory_order_acquire) != head_ + 1) return {};
+
+        return { payload_of(slot) + head_offset_, slot->size - head_offset_ };
+    }
+
+    /**
+     * @brief Hands the message returned by \ref peek back to the producers
+     *
+     * @thread Consumer
+     */
+    void release() noexcept {
+        SlotHeader* slot = header_at(head_ & mask_);
+        assert(slot->sequence.load(std::memory_order_relaxed) == head_ + 1);
+
+        free_slot(slot);
+    }
+
+    std::size_t slot_count() const noexcept { return slots_; }
+    std::size_t slot_payload() const noexcept { return slot_payload_; }
+
+private:
+    struct SlotHeader {
+        std::atomic<std::size_t> sequence;
+        std::uint32_t size;
+    };
+
+    static constexpr std::size_t round_to_cache_line(const std::size_t bytes) noexcept {
+        return (bytes + 63) & ~std::size_t{63};
+    }
+
+    SlotHeader* header_at(const std::size_t index) const noexcept {
+        return std::launder(reinterpret_cast<SlotHeader*>(storage_ + index * stride_));
+    }
+
+    static std::byte* payload_of(SlotHeader* slot) noexcept {
+        return reinterpret_cast<std::byte*>(slot) + sizeof(SlotHeader);
+    }
+
+    static const std::byte* payload_of(const SlotHeader* slot) noexcept {
+        return reinterpret_cast<const std::byte*>(slot) + sizeof(SlotHeader);
+    }
+
+    void free_slot(SlotHeader* slot) noexcept {
+        slot->sequence.store(head_ + slots_, std::memory_order_release);
+        ++head_;
+        head_offset_ = 0;
+    }
+
+    const std::size_t slots_;
+    const std::size_t mask_;
+    const std::size_t slot_payload_;
+    const std::size_t stride_;
+
+    memory::PlacedBuffer buffer_;
+    std::byte* const storage_;
+
+    alignas(64) std::atomic<std::size_t> tail_;
+
+    alignas(64) std::size_t head_;
+    std::size_t head_offset_;
+};
+
+} // namespace lute::tm::channels
@@ -0,0 +1,328 @@
+#pragma once
+
+#include <channels/RingRegion.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <cassert>
+
+namespace lute::tm::channels {
+
+/**
+ * Record framing over a byte channel with reserve/publish and peek/release (\ref InMemoryChannel,
+ * \ref CachedInMemoryChannel).
+ *
+ * Every frame is an 8-byte \ref FrameHeader followed by the payload padded to 8 bytes, so payloads are
+ * 8-byte aligned in the ring and the write index always stays a multiple of 8. Frames never straddle the
+ * end of the ring: when a frame does not fit before the end, the writer fills the tail with a
+ * \c FrameKind::Padding frame and continues at the start. A reader therefore always sees each frame,
+ * and each batch of frames, as one contiguous range.
+ *
+ * The channel must be used exclusively through \ref FramedWriter / \ref FramedReader, and its capacity
+ * must be a multiple of \ref FRAME_ALIGNMENT.
+ */
+
+enum class FrameKind : std::uint32_t {
+    Record = 0,
+    Padding = 1,
+    Watermark = 2,      // control frame: 8-byte event-time watermark, see watermarks/Watermark.h
+    Barrier = 3,        // control frame: 8-byte checkpoint id, see checkpoint/Barrier.h
+};
+
+struct FrameHeader {
+    std::uint32_t length;
+    FrameKind kind;
+};
+
+inline constexpr std::size_t FRAME_ALIGNMENT = 8;
+
+static_assert(sizeof(FrameHeader) == FRAME_ALIGNMENT);
+
+constexpr std::size_t frame_size(const std::size_t payload) noexcept {
+    return sizeof(FrameHeader) + ((payload + FRAME_ALIGNMENT - 1) & ~(FRAME_ALIGNMENT - 1));
+}
+
+/**
+ * @struct BatchPolicy
+ * @brief When a \ref FramedWriter publishes its pending frames
+ *
+ * Whichever budget is hit first triggers the publish. A record count of 1 degenerates to strict
+ * single-event push.
+ */
+struct BatchPolicy {
+    std::size_t maxRecords = 64;
+    std::size_t maxBytes = 16 * 1024;
+    std::chrono::nanoseconds maxDelay = std::chrono::microseconds(50);
+};
+
+/**
+ * @class FramedWriter
+ * @brief Producer side: serializes frames straight into the ring and publishes them in batches with a
+ * single index store
+ *
+ * @thread Producer
+ */
+template<typename ChannelType>
+class FramedWriter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit FramedWriter(ChannelType& channel, const BatchPolicy policy = {}) noexcept
+        : channel_(channel),
+          policy_(policy)
+    {
+        assert(channel.capacity() % FRAME_ALIGNMENT == 0);
+    }
+
+    FramedWriter(const FramedWriter&) = delete;
+    FramedWriter& operator=(const FramedWriter&) = delete;
+
+    /**
+     * @brief Reserves an in-ring payload slot of \p size bytes for the next frame
+     *
+     * Write the payload, then call \ref commit. Nothing becomes visible before the batch is published.
+     *
+     * @return Writable payload span, or an empty span if the ring has no room even after publishing
+     * the pending batch (backpressure)
+     */
+    std::span<std::byte> allocate(const std::size_t size, const FrameKind kind = FrameKind::Record) noexcept {
+        const std::size_t frame = frame_size(size);
+
+        std::byte* slot = place(frame);
+        if (slot == nullptr) {
+            flush();
+            region_ = channel_.reserve(channel_.capacity());
+            slot = place(frame);
+            if (slot == nullptr) return {};
+        }
+
+        write_header(slot, static_cast<std::uint32_t>(size), kind);
+        cursor_ += frame;
+        return { slot + sizeof(FrameHeader), size };
+    }
+
+    /**
+     * @brief Completes the frame returned by the last \ref allocate and publishes the batch if its
+     * record or byte budget is exhausted
+     */
+    void commit() noexcept {
+        if (pendingRecords_++ == 0 && policy_.maxDelay.count() != 0) {
+            batchStart_ = Clock::now();
+        }
+
+        if (pendingRecords_ >= policy_.maxRecords || cursor_ >= policy_.maxBytes) {
+            flush();
+        }
+    }
+
+    /**
+     * @brief Copies \p payload into a new frame; convenience over \ref allocate + \ref commit
+     *
+     * @return false if the ring is full
+     */
+    bool append(std::span<const std::byte> payload, const FrameKind kind = FrameKind::Record) noexcept {
+        std::span<std::byte> slot = allocate(payload.size(), kind);
+        if (slot.data() == nullptr) return false;
+
+        std::memcpy(slot.data(), payload.data(), payload.size());
+        commit();
+        return true;
+    }
+
+    /**
+     * @brief Publishes the pending batch if it has been open longer than the policy's delay budget.
+     * Call it from the producer loop when there is no new input, so a trickle of records is not held back.
+     */
+    void poll(const Clock::time_point now = Clock::now()) noexcept {
+        if (pendingRecords_ != 0 && now - batchStart_ >= policy_.maxDelay) {
+            flush();
+        }
+    }
+
+    /**
+     * @brief Makes every pending frame visible to the reader with one index store
+     */
+    void flush() noexcept {
+        if (cursor_ == 0) return;
+
+        channel_.publish(cursor_);
+        region_ = {};
+        cursor_ = 0;
+        pendingRecords_ = 0;
+    }
+
+    std::size_t pendingRecords() const noexcept { return pendingRecords_; }
+    std::size_t pendingBytes() const noexcept { return cursor_; }
+
+private:
+    /**
+     * @brief Finds room for \p frame contiguous bytes after \c cursor_ in the current reservation,
+     * writing a padding frame over the ring tail if the frame has to wrap
+     */
+    std::byte* place(const std::size_t frame) noexcept {
+        const std::size_t head = region_.first.size();
+
+        if (cursor_ < head) {
+            const std::size_t room = head - cursor_;
+            if (frame <= room) return region_.first.data() + cursor_;
+
+            // Only the part of the reservation past the ring end can hold it; keep the padding
+            // unwritten unless the frame really fits there
+            if (frame > region_.second.size()) return nullptr;
+
+            write_header(region_.first.data() + cursor_,
+                         static_cast<std::uint32_t>(room - sizeof(FrameHeader)), FrameKind::Padding);
+            cursor_ += room;
+            return region_.second.data();
+        }
+
+        const std::size_t offset = cursor_ - head;
+        if (frame > region_.second.size() - offset) return nullptr;
+        return region_.second.data() + offset;
+    }
+
+    static void write_header(std::byte* const at, const std::uint32_t length, const FrameKind kind) noexcept {
+        const FrameHeader header{length, kind};
+        std::memcpy(at, &header, sizeof(header));
+    }
+
+    ChannelType& channel_;
+    const BatchPolicy policy_;
+
+    WritableRegion region_{};
+    std::size_t cursor_ = 0;
+    std::size_t pendingRecords_ = 0;
+    Clock::time_point batchStart_{};
+};
+
+/**
+ * @struct Frame
+ * @brief One frame inside a \ref FrameBatch, pointing into the ring
+ */
+struct Frame {
+    FrameKind kind;
+    std::span<const std::byte> payload;
+};
+
+/**
+ * @class FrameBatch
+ * @brief Contiguous, in-place view over consecutive frames fetched by a \ref FramedReader
+ */
+class FrameBatch {
+public:
+    class Iterator {
+    public:
+        Iterator(const std::byte* at) noexcept : at_(at) {}
+
+        Frame operator*() const noexcept {
+            FrameHeader header;
+            std::memcpy(&header, at_, sizeof(header));
+            return { header.kind, { at_ + sizeof(FrameHeader), header.length } };
+        }
+
+        Iterator& operator++() noexcept {
+            FrameHeader header;
+            std::memcpy(&header, at_, sizeof(header));
+            at_ += frame_size(header.length);
+            return *this;
+        }
+
+        bool operator==(const Iterator&) const noexcept = default;
+
+        const std::byte* position() const noexcept { return at_; }
+
+    private:
+        const std::byte* at_;
+    };
+
+    FrameBatch() noexcept = default;
+    FrameBatch(std::span<const std::byte> bytes, const std::size_t frameCount) noexcept
+        : bytes_(bytes),
+          frameCount_(frameCount)
+    {}
+
+    Iterator begin() const noexcept { return { bytes_.data() }; }
+    Iterator end() const noexcept { return { bytes_.data() + bytes_.size() }; }
+
+    std::size_t size() const noexcept { return frameCount_; }
+    bool empty() const noexcept { return frameCount_ == 0; }
+
+    /**
+     * @brief The first \p frameCount frames, ending at \p end; release it to hand back only what was processed
+     */
+    FrameBatch prefix(const Iterator end, const std::size_t frameCount) const noexcept {
+        return { bytes_.first(static_cast<std::size_t>(end.position() - bytes_.data())), frameCount };
+    }
+
+    /**
+     * @brief Raw framed bytes covered by the batch
+     */
+    std::span<const std::byte> bytes() const noexcept { return bytes_; }
+
+private:
+    std::span<const std::byte> bytes_{};
+    std::size_t frameCount_ = 0;
+};
+
+/**
+ * @class FramedReader
+ * @brief Consumer side: hands out batches of frames in place and releases them with one index store
+ *
+ * @thread Consumer
+ */
+template<typename ChannelType>
+class FramedReader {
+public:
+    explicit FramedReader(ChannelType& channel) noexcept
+        : channel_(channel)
+    {}
+
+    /**
+     * @brief Returns up to \p maxFrames published frames as one contiguous batch. Padding frames are
+     * consumed transparently and never appear in a batch. Fetching again without \ref release returns
+     * the same frames.
+     */
+    FrameBatch fetch(const std::size_t maxFrames = SIZE_MAX) noexcept {
+        ReadableRegion region = channel_.peek();
+
+        if (!region.empty() && header_at(region.first.data()).kind == FrameKind::Padding) {
+            channel_.release(region.first.size());
+            region = channel_.peek();
+        }
+
+        const std::span<const std::byte> bytes = region.first;
+        std::size_t offset = 0;
+        std::size_t frames = 0;
+
+        while (frames < maxFrames && offset < bytes.size()) {
+            const FrameHeader header = header_at(bytes.data() + offset);
+            if (header.kind == FrameKind::Padding) break;
+
+            offset += frame_size(header.length);
+            ++frames;
+        }
+
+        return { bytes.first(offset), frames };
+    }
+
+    /**
+     * @brief Hands the frames of \p batch back to the writer
+     */
+    void release(const FrameBatch& batch) noexcept {
+        channel_.release(batch.bytes().size());
+    }
+
+private:
+    static FrameHeader header_at(const std::byte* const at) noexcept {
+        FrameHeader header;
+        std::memcpy(&header, at, sizeof(header));
+        return header;
+    }
+
+    ChannelType& channel_;
+};
+
+} // namespace lute::tm::channels
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <span>
+
+namespace lute::tm::channels {
+
+/**
+ * @struct RingRegion
+ * @brief View over a range of ring-buffer bytes that may wrap around the end of the ring
+ *
+ * A reservation or a peek can cross the physical end of the ring, so the range is exposed as two
+ * spans: \c first runs from the current position to (at most) the end of the ring, \c second continues
+ * from the start of the ring. \c second is empty whenever the range does not wrap.
+ *
+ * @tparam Byte \c std::byte for producer-side (writable) regions, \c const std::byte for consumer-side
+ */
+template<typename Byte>
+struct RingRegion {
+    std::span<Byte> first;
+    std::span<Byte> second;
+
+    std::size_t size() const noexcept { return first.size() + second.size(); }
+    bool empty() const noexcept { return first.empty(); }
+};
+
+using WritableRegion = RingRegion<std::byte>;
+using ReadableRegion = RingRegion<const std::byte>;
+
+/**
+ * @brief Splits \p size bytes starting at ring position \p pos into at most two contiguous spans
+ *
+ * @param base Start of the ring storage
+ * @param capacity Ring size in bytes
+ * @param pos Physical (already masked) start position inside the ring
+ * @param size Number of bytes in the region, must not exceed \p capacity
+ */
+template<typename Byte>
+inline RingRegion<Byte> split_region(Byte* const base, const std::size_t capacity,
+                                     const std::size_t pos, const std::size_t size) noexcept {
+    const std::size_t first_chunk = std::min(size, capacity - pos);
+    return RingRegion<Byte> {
+        .first = std::span<Byte>(base + pos, first_chunk),
+        .second = std::span<Byte>(base, size - first_chunk),
+    };
+}
+
+/**
+ * @brief Copies the first \p size bytes of \p data into \p region, honouring the wrap split
+ */
+inline void copy_into(const WritableRegion& region, const void* const data, const std::size_t size) noexcept {
+    const std::size_t first_chunk = std::min(size, region.first.size());
+
+    std::memcpy(region.first.data(), data, first_chunk);
+    std::memcpy(region.second.data(),
+                static_cast<const std::byte*>(data) + first_chunk,
+                size - first_chunk);
+}
+
+/**
+ * @brief Copies the first \p size bytes of \p region out into \p data, honouring the wrap split
+ */
+inline void copy_from(const ReadableRegion& region, void* const data, const std::size_t size) noexcept {
+    const std::size_t first_chunk = std::min(size, region.first.size());
+
+    std::memcpy(data, region.first.data(), first_chunk);
+    std::memcpy(static_cast<std::byte*>(data) + first_chunk,
+                region.second.data(),
+                size - first_chunk);
+}
+
+} // namespace lute::tm::channels
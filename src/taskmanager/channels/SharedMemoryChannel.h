@@ -0,0 +1,323 @@
+#pragma once
+
+#include <trace.h>
+#include <channels/Channel.h>
+#include <channels/RingRegion.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <cassert>
+
+namespace lute::tm::channels {
+
+/**
+ * @struct SharedRingHeader
+ * @brief First page of a \ref SharedMemoryChannel mapping; the layout both processes agree on
+ *
+ * Bump \ref VERSION whenever anything in the mapping changes shape. Attaching to a mapping with another
+ * magic, version or header size fails instead of misreading the indices.
+ */
+struct SharedRingHeader {
+    static constexpr std::uint64_t MAGIC = 0x4c55544553484d31;     // "LUTESHM1"
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::uint32_t READY = 1;
+
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t headerBytes;
+    std::uint64_t capacity;
+    std::atomic<std::uint32_t> state;       // READY once the creator has initialised everything above
+
+    alignas(64) std::atomic<std::uint64_t> writeIndex;
+    alignas(64) std::atomic<std::uint64_t> readIndex;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<std::uint32_t>::is_always_lock_free,
+              "Indices are shared between processes and must not need a lock");
+
+/**
+ * @class SharedMemoryChannel
+ * @brief SPSC byte ring whose data and indices live in a shared mapping, for a producer in another process
+ *
+ * Same contract and cached-index scheme as \ref CachedInMemoryChannel: the ring and both indices sit in the
+ * mapping, while each side's cached copy of the other side's index is private to its process. One process
+ * creates the mapping (\ref create_memfd, or \ref create under a \c /dev/shm name), the other attaches
+ * (\ref attach to an inherited or passed descriptor, or \ref open by name). Each side then uses only its
+ * half of the API, exactly as with the in-process channels, and nothing on the data path makes a syscall.
+ *
+ * The mapping is one \ref SharedRingHeader page followed by the ring. Creation and attachment throw
+ * \c std::system_error when the kernel refuses, and \c std::runtime_error for a mapping this build cannot read.
+ */
+class SharedMemoryChannel : public Channel<SharedMemoryChannel> {
+public:
+    static constexpr std::size_t HEADER_BYTES = 4096;
+
+    /**
+     * @brief New ring in an anonymous memfd; hand \ref fd to the peer process (fork, or \c SCM_RIGHTS)
+     */
+    static SharedMemoryChannel create_memfd(const std::size_t capacity_power_of_two, const char* const label = "lute-channel") {
+        const int fd = ::memfd_create(label, MFD_CLOEXEC);
+        if (fd < 0) throw std::system_error(errno, std::generic_category(), "memfd_create");
+
+        return initialise(fd, capacity_power_of_two);
+    }
+
+    /**
+     * @brief New ring under \p name in \c /dev/shm (e.g. "/lute-ingest"); fails if the name exists
+     */
+    static SharedMemoryChannel create(const std::string& name, const std::size_t capacity_power_of_two) {
+        const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+        if (fd < 0) throw std::system_error(errno, std::generic_category(), "shm_open " + name);
+
+        try {
+            return initialise(fd, capacity_power_of_two);
+        } catch (...) {
+            ::shm_unlink(name.c_str());
+            throw;
+        }
+    }
+
+    /**
+     * @brief Attaches to the ring created under \p name
+     */
+    static SharedMemoryChannel open(const std::string& name) {
+        const int fd = ::shm_open(name.c_str(), O_RDWR | O_CLOEXEC, 0);
+        if (fd < 0) throw std::system_error(errno, std::generic_category(), "shm_open " + name);
+
+        return attach_owned(fd);
+    }
+
+    /**
+     * @brief Attaches to the ring behind \p fd; the descriptor is duplicated, the caller keeps its own
+     */
+    static SharedMemoryChannel attach(const int fd) {
+        const int own = ::fcntl(fd, F_DUPFD_CLOEXEC, 0);
+        if (own < 0) throw std::system_error(errno, std::generic_category(), "dup");
+
+        return attach_owned(own);
+    }
+
+    /**
+     * @brief Removes \p name from \c /dev/shm; mappings stay valid until both sides are gone
+     */
+    static void unlink(const std::string& name) noexcept { ::shm_unlink(name.c_str()); }
+
+    SharedMemoryChannel(SharedMemoryChannel&& other) noexcept
+        : fd_(std::exchange(other.fd_, -1)),
+          base_(std::exchange(other.base_, nullptr)),
+          mapped_(std::exchange(other.mapped_, 0)),
+          header_(std::exchange(other.header_, nullptr)),
+          ring_(std::exchange(other.ring_, nullptr)),
+          capacity_(other.capacity_),
+          mask_(other.mask_),
+          cached_read_index_(other.cached_read_index_),
+          cached_write_index_(other.cached_write_index_)
+    {}
+
+    SharedMemoryChannel& operator=(SharedMemoryChannel&&) = delete;
+    SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+    SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+
+    ~SharedMemoryChannel() {
+        if (base_ != nullptr) ::munmap(base_, mapped_);
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    std::size_t send(const void* data, std::size_t size) {
+        CORE_TRACE_SCOPE("channel", "SharedMemoryChannel::send");
+
+        const WritableRegion region = reserve(size);
+        const std::size_t to_write = region.size();
+
+        if (to_write == 0) return 0;
+
+        copy_into(region, data, to_write);
+
+        publish(to_write);
+        return to_write;
+    }
+
+    std::size_t receive(void* data, std::size_t size) {
+        CORE_TRACE_SCOPE("channel", "SharedMemoryChannel::receive");
+
+        const ReadableRegion region = peek(size);
+        const std::size_t to_read = region.size();
+
+        if (to_read == 0) return 0;
+
+        copy_from(region, data, to_read);
+
+        release(to_read);
+        return to_read;
+    }
+
+    /**
+     * @copydoc InMemoryChannel::reserve
+     */
+    WritableRegion reserve(std::size_t size) noexcept {
+        const std::uint64_t w = header_->writeIndex.load(std::memory_order_relaxed);
+
+        std::size_t available = capacity_ - static_cast<std::size_t>(w - cached_read_index_);
+        if (available < size) {
+            cached_read_index_ = header_->readIndex.load(std::memory_order_acquire);
+            available = capacity_ - static_cast<std::size_t>(w - cached_read_index_);
+        }
+
+        const std::size_t to_write = (size < available) ? size : available;
+        return split_region(ring_, capacity_, static_cast<std::size_t>(w) & mask_, to_write);
+    }
+
+    /**
+     * @copydoc InMemoryChannel::publish
+     */
+    void publish(std::size_t size) noexcept {
+        const std::uint64_t w = header_->writeIndex.load(std::memory_order_relaxed);
+        assert(size <= capacity_ - (w - cached_read_index_));
+
+        header_->writeIndex.store(w + size, std::memory_order_release);
+    }
+
+    /**
+     * @copydoc InMemoryChannel::peek
+     */
+    ReadableRegion peek(std::size_t size = std::numeric_limits<std::size_t>::max()) noexcept {
+        const std::uint64_t r = header_->readIndex.load(std::memory_order_relaxed);
+
+        std::size_t available = static_cast<std::size_t>(cached_write_index_ - r);
+        if (available < size) {
+            cached_write_index_ = header_->writeIndex.load(std::memory_order_acquire);
+            available = static_cast<std::size_t>(cached_write_index_ - r);
+        }
+
+        const std::size_t to_read = (size < available) ? size : available;
+        return split_region<const std::byte>(ring_, capacity_, static_cast<std::size_t>(r) & mask_, to_read);
+    }
+
+    /**
+     * @copydoc InMemoryChannel::release
+     */
+    void release(std::size_t size) noexcept {
+        const std::uint64_t r = header_->readIndex.load(std::memory_order_relaxed);
+        assert(size <= cached_write_index_ - r);
+
+        header_->readIndex.store(r + size, std::memory_order_release);
+    }
+
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief Descriptor of the mapping, for passing to the peer process
+     */
+    int fd() const noexcept { return fd_; }
+
+private:
+    SharedMemoryChannel(const int fd, std::byte* const base, const std::size_t mapped) noexcept
+        : fd_(fd),
+          base_(base),
+          mapped_(mapped),
+          header_(reinterpret_cast<SharedRingHeader*>(base)),
+          ring_(base + HEADER_BYTES),
+          capacity_(mapped - HEADER_BYTES),
+          mask_(capacity_ - 1),
+          cached_read_index_(header_->readIndex.load(std::memory_order_acquire)),
+          cached_write_index_(header_->writeIndex.load(std::memory_order_acquire))
+    {}
+
+    static std::byte* map(const int fd, const std::size_t bytes) {
+        void* addr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "mmap");
+        }
+        return static_cast<std::byte*>(addr);
+    }
+
+    static SharedMemoryChannel initialise(const int fd, const std::size_t capacity) {
+        assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+
+        const std::size_t bytes = HEADER_BYTES + capacity;
+        if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "ftruncate");
+        }
+
+        std::byte* const base = map(fd, bytes);
+        auto* header = new (base) SharedRingHeader{
+            SharedRingHeader::MAGIC, SharedRingHeader::VERSION, HEADER_BYTES, capacity, {0}, {0}, {0}
+        };
+        header->state.store(SharedRingHeader::READY, std::memory_order_release);
+
+        return SharedMemoryChannel(fd, base, bytes);
+    }
+
+    static SharedMemoryChannel attach_owned(const int fd) {
+        struct stat info{};
+        if (::fstat(fd, &info) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "fstat");
+        }
+
+        const auto bytes = static_cast<std::size_t>(info.st_size);
+        if (bytes <= HEADER_BYTES) {
+            ::close(fd);
+            throw std::runtime_error("shared channel: mapping too small for a ring");
+        }
+
+        std::byte* const base = map(fd, bytes);
+        const auto* header = reinterpret_cast<const SharedRingHeader*>(base);
+
+        const char* problem = nullptr;
+        if (header->state.load(std::memory_order_acquire) != SharedRingHeader::READY) {
+            problem = "shared channel: ring not initialised";
+        } else if (header->magic != SharedRingHeader::MAGIC) {
+            problem = "shared channel: not a lute ring";
+        } else if (header->version != SharedRingHeader::VERSION || header->headerBytes != HEADER_BYTES) {
+            problem = "shared channel: ring layout version mismatch";
+        } else if (header->capacity != bytes - HEADER_BYTES) {
+            problem = "shared channel: ring size does not match the mapping";
+        } else if (!std::has_single_bit(header->capacity)) {
+            problem = "shared channel: ring size is not a power of two";
+        }
+
+        if (problem != nullptr) {
+            ::munmap(base, bytes);
+            ::close(fd);
+            throw std::runtime_error(problem);
+        }
+
+        return SharedMemoryChannel(fd, base, bytes);
+    }
+
+    int fd_;
+    std::byte* base_;
+    std::size_t mapped_;
+
+    SharedRingHeader* header_;
+    std::byte* ring_;
+    std::size_t capacity_;
+    std::size_t mask_;
+
+    // Process-local, one per side
+    alignas(64) std::uint64_t cached_read_index_;
+    alignas(64) std::uint64_t cached_write_index_;
+};
+
+} // namespace lute::tm::channels
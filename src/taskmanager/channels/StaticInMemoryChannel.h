@@ -0,0 +1,126 @@
+#pragma once
+
+#include <trace.h>
+#include <channels/Channel.h>
+#include <channels/RingRegion.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <cassert>
+
+namespace lute::tm::channels {
+
+/**
+ * @class StaticInMemoryChannel
+ * @brief \ref InMemoryChannel with the capacity fixed at compile time and the ring stored inline
+ *
+ * Capacity and mask are constants folded into the instructions, and the storage lives inside the object,
+ * so the hot path has no dependent loads of \c capacity_ / \c mask_ / \c buffer_ and the channel can be
+ * placed in a preallocated operator arena without any heap allocation.
+ *
+ * @tparam Capacity Ring size in bytes, power of two
+ * @tparam Alignment Alignment of the ring storage, power of two and at least a cache line
+ */
+template<std::size_t Capacity, std::size_t Alignment = 64>
+class StaticInMemoryChannel : public Channel<StaticInMemoryChannel<Capacity, Alignment>> {
+    static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert((Alignment & (Alignment - 1)) == 0 && Alignment >= 64, "Alignment must be a power of two >= 64");
+
+public:
+    StaticInMemoryChannel() noexcept
+        : write_index_(0),
+          read_index_(0)
+    {}
+
+    StaticInMemoryChannel(const StaticInMemoryChannel&) = delete;
+    StaticInMemoryChannel& operator=(const StaticInMemoryChannel&) = delete;
+
+    std::size_t send(const void* data, std::size_t size) {
+        CORE_TRACE_SCOPE("channel", "StaticInMemoryChannel::send");
+
+        const WritableRegion region = reserve(size);
+        const std::size_t to_write = region.size();
+
+        if (to_write == 0) return 0;
+
+        copy_into(region, data, to_write);
+
+        publish(to_write);
+        return to_write;
+    }
+
+    std::size_t receive(void* data, std::size_t size) {
+        CORE_TRACE_SCOPE("channel", "StaticInMemoryChannel::receive");
+
+        const ReadableRegion region = peek(size);
+        const std::size_t to_read = region.size();
+
+        if (to_read == 0) return 0;
+
+        copy_from(region, data, to_read);
+
+        release(to_read);
+        return to_read;
+    }
+
+    /**
+     * @copydoc InMemoryChannel::reserve
+     */
+    WritableRegion reserve(std::size_t size) noexcept {
+        const std::size_t w = write_index_.load(std::memory_order_relaxed);
+        const std::size_t r = read_index_.load(std::memory_order_acquire);
+
+        const std::size_t available = Capacity - (w - r);
+        const std::size_t to_write = (size < available) ? size : available;
+
+        return split_region(buffer_, Capacity, w & MASK, to_write);
+    }
+
+    /**
+     * @copydoc InMemoryChannel::publish
+     */
+    void publish(std::size_t size) noexcept {
+        const std::size_t w = write_index_.load(std::memory_order_relaxed);
+        assert(size <= Capacity - (w - read_index_.load(std::memory_order_relaxed)));
+
+        write_index_.store(w + size, std::memory_order_release);
+    }
+
+    /**
+     * @copydoc InMemoryChannel::peek
+     */
+    ReadableRegion peek(std::size_t size = std::numeric_limits<std::size_t>::max()) const noexcept {
+        const std::size_t r = read_index_.load(std::memory_order_relaxed);
+        const std::size_t w = write_index_.load(std::memory_order_acquire);
+
+        const std::size_t available = w - r;
+        const std::size_t to_read = (size < available) ? size : available;
+
+        return split_region<const std::byte>(buffer_, Capacity, r & MASK, to_read);
+    }
+
+    /**
+     * @copydoc InMemoryChannel::release
+     */
+    void release(std::size_t size) noexcept {
+        const std::size_t r = read_index_.load(std::memory_order_relaxed);
+        assert(size <= write_index_.load(std::memory_order_relaxed) - r);
+
+        read_index_.store(r + size, std::memory_order_release);
+    }
+
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+
+    alignas(64) std::atomic<std::size_t> write_index_;
+    alignas(64) std::atomic<std::size_t> read_index_;
+
+    alignas(Alignment) std::byte buffer_[Capacity];
+};
+
+} // namespace lute::tm::channels
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <counter.h>
+#include <futex.h>
+#include <channels/Channel.h>
+#include <channels/ChannelConcept.h>
+#include <channels/RingRegion.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace lute::tm::channels {
+
+/**
+ * @struct WaitPolicy
+ * @brief How long a \ref WaitableChannel waiter polls before it parks
+ */
+struct WaitPolicy {
+    std::uint32_t spinIterations = 1000;    // pause-hinted polls before parking; 0 parks at once
+};
+
+/**
+ * @struct WaitStats
+ * @brief Parks and futex wakes of one \ref WaitableChannel; a wake is a syscall, so on a busy edge both stay 0
+ */
+struct WaitStats {
+    std::uint64_t consumerParks;
+    std::uint64_t producerParks;
+    std::uint64_t wakes;
+};
+
+/**
+ * @class WaitableChannel
+ * @brief Adds blocking waits to any SPSC zero-copy channel; itself a zero-copy channel
+ *
+ * The non-blocking operations keep their contract, so a spinning caller can use the wrapper exactly like
+ * the bare channel. \ref wait_readable / \ref wait_writable (and \ref receive_wait / \ref send_wait on top)
+ * poll for up to \ref WaitPolicy::spinIterations rounds, then park on a futex word of their side.
+ *
+ * A waiter announces itself by setting its word before the final check of the ring, and the other side checks
+ * that word after each \ref publish / \ref release, with a full fence between the index store and the check on
+ * both sides (Dekker). Either the waiter sees the new index, or the other side sees the announcement and wakes
+ * it, so a wake-up is never lost and a syscall is only issued when a thread is really parked. The fence is the
+ * whole fast-path cost; a \ref FramedWriter pays it once per batch.
+ *
+ * Use it for edges whose consumer (or producer) owns a thread and may idle, e.g. sources, sinks and low-rate
+ * streams; operators on the worker pool park through the pool's doorbell instead. It does not own the channel.
+ *
+ * @thread One producer, one consumer; \ref close from any thread
+ */
+template<ZeroCopyChannel ChannelImpl>
+class WaitableChannel : public Channel<WaitableChannel<ChannelImpl>> {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::chrono::nanoseconds FOREVER = std::chrono::nanoseconds::max();
+
+    explicit WaitableChannel(ChannelImpl& channel, const WaitPolicy policy = {}) noexcept
+        : channel_(channel),
+          policy_(policy)
+    {}
+
+    WaitableChannel(const WaitableChannel&) = delete;
+    WaitableChannel& operator=(const WaitableChannel&) = delete;
+
+    std::size_t send(const void* data, std::size_t size) {
+        const WritableRegion region = reserve(size);
+        const std::size_t to_write = region.size();
+
+        if (to_write == 0) return 0;
+
+        copy_into(region, data, to_write);
+
+        publish(to_write);
+        return to_write;
+    }
+
+    std::size_t receive(void* data, std::size_t size) {
+        const ReadableRegion region = peek(size);
+        const std::size_t to_read = region.size();
+
+        if (to_read == 0) return 0;
+
+        copy_from(region, data, to_read);
+
+        release(to_read);
+        return to_read;
+    }
+
+    WritableRegion reserve(std::size_t size) noexcept { return channel_.reserve(size); }
+
+    /**
+     * @brief Publishes like the wrapped channel, then wakes the consumer if it is parked
+     *
+     * @thread Producer
+     */
+    void publish(std::size_t size) noexcept {
+        channel_.publish(size);
+        if (wake(consumerSleeping_)) core::bump(producer_.wakes);
+    }
+
+    ReadableRegion peek(std::size_t size = std::numeric_limits<std::size_t>::max()) noexcept {
+        return channel_.peek(size);
+    }
+
+    /**
+     * @brief Releases like the wrapped channel, then wakes the producer if it is parked
+     *
+     * @thread Consumer
+     */
+    void release(std::size_t size) noexcept {
+        channel_.release(size);
+        if (wake(producerSleeping_)) core::bump(consumer_.wakes);
+    }
+
+    std::size_t capacity() const noexcept { return channel_.capacity(); }
+
+    /**
+     * @brief Waits until at least \p size bytes (capped at the capacity) are readable, the timeout expires or
+     * the channel is closed
+     *
+     * @return \ref peek of \p size; shorter than asked for on timeout or close
+     *
+     * @thread Consumer
+     */
+    ReadableRegion wait_readable(const std::size_t size, const std::chrono::nanoseconds timeout = FOREVER) noexcept {
+        const std::size_t wanted = std::min(size, capacity());
+        await(consumerSleeping_, consumer_.parks, timeout, [&]() { return channel_.peek(wanted).size() >= wanted; });
+        return peek(size);
+    }
+
+    /**
+     * @brief Waits until \p size bytes (capped at the capacity) can be reserved, the timeout expires or the
+     * channel is closed
+     *
+     * @return \ref reserve of \p size; shorter than asked for on timeout or close
+     *
+     * @thread Producer
+     */
+    WritableRegion wait_writable(const std::size_t size, const std::chrono::nanoseconds timeout = FOREVER) noexcept {
+        const std::size_t wanted = std::min(size, capacity());
+        await(producerSleeping_, producer_.parks, timeout, [&]() { return channel_.reserve(wanted).size() >= wanted; });
+        return reserve(size);
+    }
+
+    /**
+     * @brief \ref send that first waits for room for the whole message
+     *
+     * @return Bytes sent; less than \p size only on timeout, close, or a message larger than the ring
+     */
+    std::size_t send_wait(const void* data, const std::size_t size, const std::chrono::nanoseconds timeout = FOREVER) {
+        wait_writable(size, timeout);
+        return send(data, size);
+    }
+
+    /**
+     * @brief \ref receive that first waits for at least one byte
+     *
+     * @return Bytes received; 0 only on timeout or close
+     */
+    std::size_t receive_wait(void* data, const std::size_t size, const std::chrono::nanoseconds timeout = FOREVER) {
+        wait_readable(1, timeout);
+        return receive(data, size);
+    }
+
+    /**
+     * @brief Wakes both sides and makes every later wait return without parking. Data already in the ring
+     * stays readable.
+     *
+     * @thread Any
+     */
+    void close() noexcept {
+        closed_.store(true, std::memory_order_release);
+        wake(consumerSleeping_);
+        wake(producerSleeping_);
+    }
+
+    bool closed() const noexcept { return closed_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Approximate while both sides run; exact once they are quiescent
+     */
+    WaitStats stats() const noexcept {
+        return {
+            consumer_.parks.load(std::memory_order_relaxed),
+            producer_.parks.load(std::memory_order_relaxed),
+            consumer_.wakes.load(std::memory_order_relaxed) + producer_.wakes.load(std::memory_order_relaxed),
+        };
+    }
+
+    ChannelImpl& channel() noexcept { return channel_; }
+
+private:
+    /**
+     * @brief Counters written by one side only
+     */
+    struct SideStats {
+        std::atomic<std::uint64_t> parks{0};
+        std::atomic<std::uint64_t> wakes{0};
+    };
+
+    /**
+     * @brief Wakes the thread parked on \p sleeping, if any
+     *
+     * @return true if a wake syscall was issued
+     */
+    static bool wake(std::atomic<std::uint32_t>& sleeping) noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping.load(std::memory_order_relaxed) == 0) return false;
+        if (sleeping.exchange(0, std::memory_order_relaxed) == 0) return false;
+
+        core::futex_wake(sleeping, 1);
+        return true;
+    }
+
+    template<typename Ready>
+    void await(std::atomic<std::uint32_t>& sleeping, std::atomic<std::uint64_t>& parks,
+               const std::chrono::nanoseconds timeout, Ready ready) noexcept {
+        for (std::uint32_t i = 0; i < policy_.spinIterations; ++i) {
+            if (ready()) return;
+            core::cpu_relax();
+        }
+
+        const bool bounded = timeout != FOREVER;
+        const Clock::time_point deadline = bounded ? Clock::now() + timeout : Clock::time_point::max();
+
+        for (;;) {
+            if (ready() || closed_.load(std::memory_order_relaxed)) return;
+
+            std::chrono::nanoseconds remaining = FOREVER;
+            if (bounded) {
+                remaining = deadline - Clock::now();
+                if (remaining.count() <= 0) return;
+            }
+
+            sleeping.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (ready() || closed_.load(std::memory_order_relaxed)) {
+                sleeping.store(0, std::memory_order_relaxed);
+                return;
+            }
+
+            core::bump(parks);
+            if (bounded) {
+                core::futex_wait(sleeping, 1, remaining);
+            } else {
+                core::futex_wait(sleeping, 1);
+            }
+            sleeping.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ChannelImpl& channel_;
+    const WaitPolicy policy_;
+
+    alignas(64) std::atomic<bool> closed_{false};
+
+    // ---- Producer ----
+    alignas(64) std::atomic<std::uint32_t> producerSleeping_{0};
+    SideStats producer_;
+
+    // ---- Consumer ----
+    alignas(64) std::atomic<std::uint32_t> consumerSleeping_{0};
+    SideStats consumer_;
+};
+
+} // namespace lute::tm::channels
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <channels/RecordFraming.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace lute::tm::checkpoint {
+
+/**
+ * Checkpoints are numbered from 1 in the order the control plane requests them
+ */
+using CheckpointId = std::uint64_t;
+
+inline constexpr CheckpointId NO_CHECKPOINT = 0;
+
+/**
+ * @brief Barriers travel in-band as \ref channels::FrameKind::Barrier frames with an 8-byte payload
+ *
+ * @return false if the ring is full
+ */
+template<typename ChannelType>
+bool append_barrier(channels::FramedWriter<ChannelType>& writer, const CheckpointId checkpoint) noexcept {
+    return writer.append(std::as_bytes(std::span(&checkpoint, 1)), channels::FrameKind::Barrier);
+}
+
+/**
+ * @return The checkpoint announced by \p frame, or nothing if it is not a barrier frame
+ */
+inline std::optional<CheckpointId> barrier_of(const channels::Frame& frame) noexcept {
+    if (frame.kind != channels::FrameKind::Barrier || frame.payload.size() != sizeof(CheckpointId)) return std::nullopt;
+
+    CheckpointId checkpoint;
+    std::memcpy(&checkpoint, frame.payload.data(), sizeof(checkpoint));
+    return checkpoint;
+}
+
+/**
+ * @class BarrierTrigger
+ * @brief Hands checkpoint requests from the control plane to a source, which injects the barriers
+ *
+ * The source polls \ref take between batches and appends a barrier to each of its outputs. Requests that
+ * pile up before the source looks are coalesced into the newest; the skipped checkpoints never align and
+ * are superseded downstream.
+ *
+ * @thread \ref request from the control plane, \ref take from the source's thread
+ */
+class BarrierTrigger {
+public:
+    /**
+     * @return The id of the requested checkpoint
+     */
+    CheckpointId request() noexcept {
+        return requested_.fetch_add(1, std::memory_order_release) + 1;
+    }
+
+    /**
+     * @return A checkpoint to inject now, if one was requested since the last call
+     */
+    std::optional<CheckpointId> take() noexcept {
+        const CheckpointId requested = requested_.load(std::memory_order_acquire);
+        if (requested == injected_) return std::nullopt;
+
+        injected_ = requested;
+        return requested;
+    }
+
+    CheckpointId injected() const noexcept { return injected_; }
+
+private:
+    alignas(64) std::atomic<CheckpointId> requested_{NO_CHECKPOINT};
+    alignas(64) CheckpointId injected_ = NO_CHECKPOINT;
+};
+
+/**
+ * @class BarrierAligner
+ * @brief Barrier alignment at a fan-in: which inputs are held back until every input has delivered the barrier
+ *
+ * An input that delivered the pending checkpoint's barrier is \ref blocked: the operator stops reading it, so
+ * records behind the barrier wait in the channel or gate and are not part of the snapshot. Once the last input
+ * delivers it, the operator's state reflects exactly the records before the barrier on every input; that is
+ * the moment to snapshot and forward the barrier. In-flight records never need saving, and the data plane
+ * stalls only for the blocked inputs while the alignment lasts.
+ *
+ * A barrier for a newer checkpoint supersedes an alignment in progress (its inputs are released and the older
+ * checkpoint is \ref aborted); barriers older than the pending one are ignored. Finished inputs are
+ * \ref close "closed" and no longer take part.
+ *
+ * @thread Operator Thread
+ */
+class BarrierAligner {
+public:
+    explicit BarrierAligner(const std::size_t inputs)
+        : blocked_(inputs, false),
+          closed_(inputs, false),
+          open_(inputs)
+    {
+        assert(inputs != 0);
+    }
+
+    /**
+     * @brief \p input delivered the barrier of \p checkpoint
+     *
+     * @return true if this completed the alignment of \p checkpoint
+     */
+    bool arrive(const std::size_t input, const CheckpointId checkpoint) noexcept {
+        assert(input < blocked_.size() && !closed_[input]);
+
+        if (checkpoint <= completed_ || checkpoint < pending_) return false;
+
+        if (checkpoint > pending_) {
+            if (pending_ != NO_CHECKPOINT) ++aborted_;
+            release();
+            pending_ = checkpoint;
+        }
+
+        if (!blocked_[input]) {
+            blocked_[input] = true;
+            ++arrived_;
+        }
+        return complete_if_aligned();
+    }
+
+    /**
+     * @brief \p input has finished; it no longer holds an alignment back
+     *
+     * @return true if this completed the pending alignment
+     */
+    bool close(const std::size_t input) noexcept {
+        if (closed_[input]) return false;
+
+        closed_[input] = true;
+        --open_;
+        if (blocked_[input]) {
+            blocked_[input] = false;
+            --arrived_;
+        }
+        return pending_ != NO_CHECKPOINT && complete_if_aligned();
+    }
+
+    bool blocked(const std::size_t input) const noexcept { return blocked_[input]; }
+
+    /**
+     * @brief Checkpoint being aligned, or \ref NO_CHECKPOINT
+     */
+    CheckpointId pending() const noexcept { return pending_; }
+
+    /**
+     * @brief Newest checkpoint that aligned
+     */
+    CheckpointId completed() const noexcept { return completed_; }
+
+    std::uint64_t aborted() const noexcept { return aborted_; }
+    std::size_t inputs() const noexcept { return blocked_.size(); }
+
+private:
+    bool complete_if_aligned() noexcept {
+        if (arrived_ < open_) return false;
+
+        completed_ = pending_;
+        pending_ = NO_CHECKPOINT;
+        release();
+        return true;
+    }
+
+    void release() noexcept {
+        std::fill(blocked_.begin(), blocked_.end(), false);
+        arrived_ = 0;
+    }
+
+    std::vector<bool> blocked_;
+    std::vector<bool> closed_;
+    std::size_t open_;
+    std::size_t arrived_ = 0;
+
+    CheckpointId pending_ = NO_CHECKPOINT;
+    CheckpointId completed_ = NO_CHECKPOINT;
+    std::uint64_t aborted_ = 0;
+};
+
+} // namespace lute::tm::checkpoint
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <checkpoint/StateSnapshot.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace lute::tm::checkpoint {
+
+/**
+ * @class PagedState
+ * @brief Fixed-size array of operator state that snapshots in O(changed pages) and copies on write
+ *
+ * The array is split into pages held by \c shared_ptr. \ref snapshot does not copy any state: it hands out
+ * references to the pages, so the barrier costs one pointer per page while a background writer persists
+ * them. A page still referenced by an unfinished snapshot is copied the first time the operator writes to
+ * it again (\ref mutate); pages the writer has released are written in place.
+ *
+ * Pages written since the last snapshot are tracked, so snapshots are incremental: each one carries only
+ * those pages and names the previous checkpoint as its base. Pass \c full to start a new chain, which
+ * bounds how many snapshots a restore has to read.
+ *
+ * @tparam T Trivially copyable element (counters, aggregates, small structs)
+ *
+ * @thread Operator Thread; snapshot pages may then be read from any thread
+ */
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+class PagedState {
+public:
+    static constexpr std::size_t DEFAULT_PAGE_BYTES = 4096;
+
+    /**
+     * @param elements Number of elements, value-initialised
+     * @param pageBytes Target page size; rounded down so a page holds a power of two of elements
+     */
+    explicit PagedState(const std::size_t elements, const std::size_t pageBytes = DEFAULT_PAGE_BYTES)
+        : elements_(elements),
+          pageElements_(std::bit_floor(std::max<std::size_t>(1, pageBytes / sizeof(T)))),
+          pageShift_(static_cast<unsigned>(std::countr_zero(pageElements_))),
+          pages_((elements + pageElements_ - 1) / pageElements_),
+          dirty_(pages_.size(), false)
+    {
+        for (auto& page : pages_) page = std::make_shared<T[]>(pageElements_);
+    }
+
+    const T& operator[](const std::size_t i) const noexcept {
+        assert(i < elements_);
+        return pages_[i >> pageShift_].get()[i & (pageElements_ - 1)];
+    }
+
+    /**
+     * @brief Writable reference to element \p i; valid until the next \ref snapshot
+     *
+     * Allocates a private copy of the page if a snapshot still shares it.
+     */
+    T& mutate(const std::size_t i) {
+        assert(i < elements_);
+        const std::size_t page = i >> pageShift_;
+
+        std::shared_ptr<T[]>& current = pages_[page];
+        if (current.use_count() > 1) {
+            auto copy = std::make_shared_for_overwrite<T[]>(pageElements_);
+            std::memcpy(copy.get(), current.get(), pageElements_ * sizeof(T));
+            current = std::move(copy);
+            ++copies_;
+        } else if (!dirty_[page]) {
+            // Nobody else can take a new reference, so a count of 1 means the writer is done with the page. The
+            // count is read relaxed; the fence pairs with the writer's release decrement so its reads of the
+            // page happen before the writes below. Once dirty, the page has not been shared since.
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+
+        if (!dirty_[page]) {
+            dirty_[page] = true;
+            changed_.push_back(page);
+        }
+        return current.get()[i & (pageElements_ - 1)];
+    }
+
+    /**
+     * @brief Captures the state as of checkpoint \p checkpoint without copying it
+     *
+     * @param full Capture every page instead of those changed since the previous snapshot. The first
+     *        snapshot is always full.
+     */
+    StateSnapshot snapshot(const CheckpointId checkpoint, const bool full = false) {
+        StateSnapshot snapshot {
+            .checkpoint = checkpoint,
+            .base = full ? NO_CHECKPOINT : last_,
+            .elementBytes = static_cast<std::uint32_t>(sizeof(T)),
+            .pageElements = pageElements_,
+            .elements = elements_,
+            .pages = {},
+        };
+
+        if (snapshot.base == NO_CHECKPOINT) {
+            snapshot.pages.reserve(pages_.size());
+            for (std::size_t page = 0; page < pages_.size(); ++page) snapshot.pages.push_back(share(page));
+        } else {
+            std::sort(changed_.begin(), changed_.end());
+            snapshot.pages.reserve(changed_.size());
+            for (const std::size_t page : changed_) snapshot.pages.push_back(share(page));
+        }
+
+        for (const std::size_t page : changed_) dirty_[page] = false;
+        changed_.clear();
+        last_ = checkpoint;
+        return snapshot;
+    }
+
+    /**
+     * @brief Applies \p snapshot; restore a chain oldest first, starting with its full snapshot
+     *
+     * @throw std::runtime_error if the snapshot was taken of differently shaped state
+     */
+    void restore(const StateSnapshot& snapshot) {
+        if (snapshot.elementBytes != sizeof(T) || snapshot.pageElements != pageElements_ || snapshot.elements != elements_) {
+            throw std::runtime_error("paged state: snapshot shape does not match");
+        }
+
+        for (const SnapshotPage& page : snapshot.pages) {
+            if (page.index >= pages_.size() || page.size != page_bytes(page.index)) {
+                throw std::runtime_error("paged state: snapshot page out of range");
+            }
+
+            auto copy = std::make_shared<T[]>(pageElements_);
+            std::memcpy(copy.get(), page.bytes.get(), page.size);
+            pages_[page.index] = std::move(copy);
+        }
+
+        std::fill(dirty_.begin(), dirty_.end(), false);
+        changed_.clear();
+        last_ = snapshot.checkpoint;
+    }
+
+    std::size_t size() const noexcept { return elements_; }
+    std::size_t pageElements() const noexcept { return pageElements_; }
+    std::size_t pages() const noexcept { return pages_.size(); }
+
+    /**
+     * @brief Pages changed since the last snapshot; the next incremental snapshot carries this many
+     */
+    std::size_t changedPages() const noexcept { return changed_.size(); }
+
+    /**
+     * @brief Pages copied because a snapshot still held them
+     */
+    std::uint64_t copies() const noexcept { return copies_; }
+
+    CheckpointId lastSnapshot() const noexcept { return last_; }
+
+private:
+    std::size_t page_bytes(const std::size_t page) const noexcept {
+        return std::min(pageElements_, elements_ - page * pageElements_) * sizeof(T);
+    }
+
+    SnapshotPage share(const std::size_t page) const {
+        const std::shared_ptr<T[]>& owner = pages_[page];
+        return SnapshotPage {
+            .index = page,
+            .bytes = std::shared_ptr<const std::byte>(owner, reinterpret_cast<const std::byte*>(owner.get())),
+            .size = page_bytes(page),
+        };
+    }
+
+    const std::size_t elements_;
+    const std::size_t pageElements_;
+    const unsigned pageShift_;
+
+    std::vector<std::shared_ptr<T[]>> pages_;
+    std::vector<bool> dirty_;
+    std::vector<std::size_t> changed_;
+
+    CheckpointId last_ = NO_CHECKPOINT;
+    std::uint64_t copies_ = 0;
+};
+
+} // namespace lute::tm::checkpoint
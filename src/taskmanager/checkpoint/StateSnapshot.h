@@ -0,0 +1,40 @@
+#pragma once
+
+#include <checkpoint/Barrier.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace lute::tm::checkpoint {
+
+/**
+ * @struct SnapshotPage
+ * @brief One page of operator state as of a checkpoint; shares ownership of the page with the state
+ */
+struct SnapshotPage {
+    std::uint64_t index;
+    std::shared_ptr<const std::byte> bytes;
+    std::size_t size;
+};
+
+/**
+ * @struct StateSnapshot
+ * @brief Pages of one operator's state captured at a barrier, for a writer to persist
+ *
+ * A full snapshot (\c base == \ref NO_CHECKPOINT) holds every page. An incremental one holds only the pages
+ * written since checkpoint \c base; restoring it means restoring \c base first.
+ */
+struct StateSnapshot {
+    CheckpointId checkpoint = NO_CHECKPOINT;
+    CheckpointId base = NO_CHECKPOINT;
+    std::uint32_t elementBytes = 0;
+    std::uint64_t pageElements = 0;
+    std::uint64_t elements = 0;
+    std::vector<SnapshotPage> pages;
+
+    bool incremental() const noexcept { return base != NO_CHECKPOINT; }
+};
+
+} // namespace lute::tm::checkpoint
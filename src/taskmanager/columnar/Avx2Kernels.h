@@ -0,0 +1,265 @@
+#pragma once
+
+#include <columnar/KernelTypes.h>
+#include <columnar/ScalarKernels.h>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+// Compiled for AVX2 whatever the build's -march; only called once the CPU has reported AVX2
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,bmi,popcnt"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,bmi,popcnt")
+// GCC 12 flags the deliberately undefined vector inside its own gather intrinsics once they are inlined
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace lute::tm::columnar::avx2 {
+
+namespace detail {
+
+/**
+ * Lane offsets of the set bits of a 4-bit compare mask, packed to the front: left-packing a selection
+ * without AVX-512's compress store
+ */
+inline constexpr std::array<std::array<std::uint32_t, 4>, 16> PACK = []() {
+    std::array<std::array<std::uint32_t, 4>, 16> table{};
+    for (std::uint32_t mask = 0; mask < 16; ++mask) {
+        std::uint32_t lane = 0;
+        for (std::uint32_t bit = 0; bit < 4; ++bit) {
+            if (mask & (1u << bit)) table[mask][lane++] = bit;
+        }
+    }
+    return table;
+}();
+
+inline __m256i load(const std::int64_t* const at) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at)); }
+inline __m256d load(const double* const at) noexcept { return _mm256_loadu_pd(at); }
+
+inline __m256i broadcast(const std::int64_t value) noexcept { return _mm256_set1_epi64x(value); }
+inline __m256d broadcast(const double value) noexcept { return _mm256_set1_pd(value); }
+
+inline __m256i gather(const std::int64_t* const column, const __m128i indices) noexcept {
+    return _mm256_i32gather_epi64(reinterpret_cast<const long long*>(column), indices, 8);
+}
+
+inline __m256d gather(const double* const column, const __m128i indices) noexcept {
+    return _mm256_i32gather_pd(column, indices, 8);
+}
+
+/**
+ * 4-bit mask of the lanes where <tt>value Op operand</tt>. AVX2 only has 64-bit \c == and signed \c >,
+ * so the rest are swapped or negated.
+ */
+template<Compare Op>
+unsigned compare(const __m256i value, const __m256i operand) noexcept {
+    const auto bits = [](const __m256i m) { return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(m))); };
+
+    if constexpr (Op == Compare::Less) return bits(_mm256_cmpgt_epi64(operand, value));
+    else if constexpr (Op == Compare::LessEqual) return bits(_mm256_cmpgt_epi64(value, operand)) ^ 0xfu;
+    else if constexpr (Op == Compare::Greater) return bits(_mm256_cmpgt_epi64(value, operand));
+    else if constexpr (Op == Compare::GreaterEqual) return bits(_mm256_cmpgt_epi64(operand, value)) ^ 0xfu;
+    else if constexpr (Op == Compare::Equal) return bits(_mm256_cmpeq_epi64(value, operand));
+    else return bits(_mm256_cmpeq_epi64(value, operand)) ^ 0xfu;
+}
+
+template<Compare Op>
+unsigned compare(const __m256d value, const __m256d operand) noexcept {
+    if constexpr (Op == Compare::Less) return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(value, operand, _CMP_LT_OQ)));
+    else if constexpr (Op == Compare::LessEqual) return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(value, operand, _CMP_LE_OQ)));
+    else if constexpr (Op == Compare::Greater) return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(value, operand, _CMP_GT_OQ)));
+    else if constexpr (Op == Compare::GreaterEqual) return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(value, operand, _CMP_GE_OQ)));
+    else if constexpr (Op == Compare::Equal) return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(value, operand, _CMP_EQ_OQ)));
+    else return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(value, operand, _CMP_NEQ_UQ)));
+}
+
+/**
+ * Stores the lanes of \p indices selected by \p mask at \p out, packed; always writes 4 entries
+ */
+inline std::size_t pack(const __m128i indices, const unsigned mask, std::uint32_t* const out) noexcept {
+    const __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(PACK[mask].data()));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_castps_si128(_mm_permutevar_ps(_mm_castsi128_ps(indices), lanes)));
+    return static_cast<std::size_t>(std::popcount(mask));
+}
+
+inline __m256i min(const __m256i a, const __m256i b) noexcept { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+inline __m256i max(const __m256i a, const __m256i b) noexcept { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+inline __m256i add(const __m256i a, const __m256i b) noexcept { return _mm256_add_epi64(a, b); }
+inline __m256d min(const __m256d a, const __m256d b) noexcept { return _mm256_min_pd(a, b); }
+inline __m256d max(const __m256d a, const __m256d b) noexcept { return _mm256_max_pd(a, b); }
+inline __m256d add(const __m256d a, const __m256d b) noexcept { return _mm256_add_pd(a, b); }
+
+template<KernelType T>
+struct vector_of { using type = __m256d; };
+
+template<>
+struct vector_of<std::int64_t> { using type = __m256i; };
+
+template<KernelType T>
+struct Accumulator {
+    using V = typename vector_of<T>::type;
+
+    V sum = broadcast(T{0});
+    V min = broadcast(Aggregate<T>::EMPTY_MIN);
+    V max = broadcast(Aggregate<T>::EMPTY_MAX);
+
+    void add(const V values) noexcept {
+        sum = detail::add(sum, values);
+        min = detail::min(min, values);
+        max = detail::max(max, values);
+    }
+
+    Aggregate<T> reduce() const noexcept {
+        alignas(32) std::array<T, 4> sums, mins, maxs;
+        store(sums.data(), sum);
+        store(mins.data(), min);
+        store(maxs.data(), max);
+
+        Aggregate<T> result;
+        for (std::size_t lane = 0; lane < 4; ++lane) {
+            result.sum = scalar::add(result.sum, sums[lane]);
+            result.min = std::min(result.min, mins[lane]);
+            result.max = std::max(result.max, maxs[lane]);
+        }
+        return result;
+    }
+
+private:
+    static void store(std::int64_t* const at, const __m256i v) noexcept { _mm256_store_si256(reinterpret_cast<__m256i*>(at), v); }
+    static void store(double* const at, const __m256d v) noexcept { _mm256_store_pd(at, v); }
+};
+
+/**
+ * Low 64 bits of the lane-wise product; AVX2 only multiplies 32 × 32 bits
+ */
+inline __m256i multiply(const __m256i a, const __m256i b) noexcept {
+    const __m256i low = _mm256_mul_epu32(a, b);
+    const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                           _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+}
+
+} // namespace detail
+
+template<KernelType T>
+std::size_t filter(const T* const column, const std::size_t count, const Compare op, const T operand,
+                   std::uint32_t* const selection) noexcept {
+    return lute::tm::columnar::detail::with_compare(op, [&]<Compare Op>(std::integral_constant<Compare, Op>) {
+        const auto operands = detail::broadcast(operand);
+        const __m128i step = _mm_set1_epi32(4);
+        __m128i indices = _mm_setr_epi32(0, 1, 2, 3);
+
+        std::size_t selected = 0;
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const unsigned mask = detail::compare<Op>(detail::load(column + i), operands);
+            selected += detail::pack(indices, mask, selection + selected);
+            indices = _mm_add_epi32(indices, step);
+        }
+
+        for (; i < count; ++i) {
+            selection[selected] = static_cast<std::uint32_t>(i);
+            selected += scalar::compare<Op>(column[i], operand);
+        }
+        return selected;
+    });
+}
+
+template<KernelType T>
+std::size_t filter_selected(const T* const column, const std::uint32_t* const input, const std::size_t count,
+                            const Compare op, const T operand, std::uint32_t* const output) noexcept {
+    return lute::tm::columnar::detail::with_compare(op, [&]<Compare Op>(std::integral_constant<Compare, Op>) {
+        const auto operands = detail::broadcast(operand);
+
+        std::size_t selected = 0;
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+            const unsigned mask = detail::compare<Op>(detail::gather(column, indices), operands);
+            selected += detail::pack(indices, mask, output + selected);
+        }
+
+        for (; i < count; ++i) {
+            const std::uint32_t index = input[i];
+            output[selected] = index;
+            selected += scalar::compare<Op>(column[index], operand);
+        }
+        return selected;
+    });
+}
+
+template<KernelType T>
+Aggregate<T> aggregate(const T* const column, const std::size_t count) noexcept {
+    detail::Accumulator<T> accumulator;
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) accumulator.add(detail::load(column + i));
+
+    Aggregate<T> result = accumulator.reduce();
+    scalar::merge(result, scalar::aggregate(column + i, count - i));
+    result.count = count;
+    return result;
+}
+
+template<KernelType T>
+Aggregate<T> aggregate_selected(const T* const column, const std::uint32_t* const selection, const std::size_t count) noexcept {
+    detail::Accumulator<T> accumulator;
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        accumulator.add(detail::gather(column, _mm_loadu_si128(reinterpret_cast<const __m128i*>(selection + i))));
+    }
+
+    Aggregate<T> result = accumulator.reduce();
+    scalar::merge(result, scalar::aggregate_selected(column, selection + i, count - i));
+    result.count = count;
+    return result;
+}
+
+/**
+ * Not in the dispatch table: without a 64-bit multiply it is slower than the scalar loop (see Kernels.h)
+ */
+inline void hash_partition(const std::uint64_t* const keys, const std::size_t count, const std::uint32_t partitionCount,
+                           std::uint32_t* const partitions) noexcept {
+    const __m256i first = _mm256_set1_epi64x(static_cast<long long>(0x9e3779b97f4a7c15));
+    const __m256i second = _mm256_set1_epi64x(static_cast<long long>(0xd6e8feb86659fd93));
+    const __m256i range = _mm256_set1_epi64x(partitionCount);
+    const __m256i highHalves = _mm256_setr_epi32(1, 3, 5, 7, 0, 2, 4, 6);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+        h = detail::multiply(h, first);
+        h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 32));
+        h = detail::multiply(h, second);
+        h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 32));
+
+        // (low 32 bits × partitions) >> 32 lands in each lane's high half; gather those to the front
+        const __m256i ids = _mm256_permutevar8x32_epi32(_mm256_mul_epu32(h, range), highHalves);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(partitions + i), _mm256_castsi256_si128(ids));
+    }
+
+    scalar::hash_partition(keys + i, count - i, partitionCount, partitions + i);
+}
+
+template<KernelType T>
+inline constexpr ColumnKernels<T> COLUMN_KERNELS{ &filter<T>, &filter_selected<T>, &aggregate<T>, &aggregate_selected<T> };
+
+} // namespace lute::tm::columnar::avx2
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+
+#endif // __x86_64__
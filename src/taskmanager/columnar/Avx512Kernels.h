@@ -0,0 +1,224 @@
+#pragma once
+
+#include <columnar/KernelTypes.h>
+#include <columnar/ScalarKernels.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+// Compiled for AVX-512 whatever the build's -march; only called once the CPU has reported F, VL and DQ
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f,avx512vl,avx512dq"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512vl,avx512dq")
+// GCC 12 flags the deliberately undefined vectors inside its own AVX-512 intrinsics once they are inlined
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace lute::tm::columnar::avx512 {
+
+namespace detail {
+
+/**
+ * Mask of the first \p count lanes; tails are handled with masked loads instead of a scalar loop
+ */
+inline __mmask8 head(const std::size_t count) noexcept {
+    return static_cast<__mmask8>((1u << count) - 1);
+}
+
+inline __m512i load(const __mmask8 lanes, const std::int64_t* const at) noexcept { return _mm512_maskz_loadu_epi64(lanes, at); }
+inline __m512d load(const __mmask8 lanes, const double* const at) noexcept { return _mm512_maskz_loadu_pd(lanes, at); }
+
+inline __m512i broadcast(const std::int64_t value) noexcept { return _mm512_set1_epi64(value); }
+inline __m512d broadcast(const double value) noexcept { return _mm512_set1_pd(value); }
+
+/**
+ * Lanes past the end of a selection have index 0 (see \ref indices) and read the column's first value;
+ * callers mask them out
+ */
+// Without optimisation GCC expands the gathers to macros that pass the lane mask as a plain char
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+inline __m512i gather(const std::int64_t* const column, const __m256i indices) noexcept {
+    return _mm512_i32gather_epi64(indices, column, 8);
+}
+
+inline __m512d gather(const double* const column, const __m256i indices) noexcept {
+    return _mm512_i32gather_pd(indices, column, 8);
+}
+#pragma GCC diagnostic pop
+
+inline __m256i indices(const __mmask8 lanes, const std::uint32_t* const selection) noexcept {
+    return _mm256_maskz_loadu_epi32(lanes, selection);
+}
+
+template<Compare Op>
+__mmask8 compare(const __mmask8 lanes, const __m512i value, const __m512i operand) noexcept {
+    if constexpr (Op == Compare::Less) return _mm512_mask_cmp_epi64_mask(lanes, value, operand, _MM_CMPINT_LT);
+    else if constexpr (Op == Compare::LessEqual) return _mm512_mask_cmp_epi64_mask(lanes, value, operand, _MM_CMPINT_LE);
+    else if constexpr (Op == Compare::Greater) return _mm512_mask_cmp_epi64_mask(lanes, value, operand, _MM_CMPINT_NLE);
+    else if constexpr (Op == Compare::GreaterEqual) return _mm512_mask_cmp_epi64_mask(lanes, value, operand, _MM_CMPINT_NLT);
+    else if constexpr (Op == Compare::Equal) return _mm512_mask_cmp_epi64_mask(lanes, value, operand, _MM_CMPINT_EQ);
+    else return _mm512_mask_cmp_epi64_mask(lanes, value, operand, _MM_CMPINT_NE);
+}
+
+template<Compare Op>
+__mmask8 compare(const __mmask8 lanes, const __m512d value, const __m512d operand) noexcept {
+    if constexpr (Op == Compare::Less) return _mm512_mask_cmp_pd_mask(lanes, value, operand, _CMP_LT_OQ);
+    else if constexpr (Op == Compare::LessEqual) return _mm512_mask_cmp_pd_mask(lanes, value, operand, _CMP_LE_OQ);
+    else if constexpr (Op == Compare::Greater) return _mm512_mask_cmp_pd_mask(lanes, value, operand, _CMP_GT_OQ);
+    else if constexpr (Op == Compare::GreaterEqual) return _mm512_mask_cmp_pd_mask(lanes, value, operand, _CMP_GE_OQ);
+    else if constexpr (Op == Compare::Equal) return _mm512_mask_cmp_pd_mask(lanes, value, operand, _CMP_EQ_OQ);
+    else return _mm512_mask_cmp_pd_mask(lanes, value, operand, _CMP_NEQ_UQ);
+}
+
+/**
+ * Writes the selected lanes of \p indices to \p out, packed, and nothing else
+ */
+inline std::size_t compress(const __m256i indices, const __mmask8 mask, std::uint32_t* const out) noexcept {
+    _mm256_mask_compressstoreu_epi32(out, mask, indices);
+    return static_cast<std::size_t>(__builtin_popcount(mask));
+}
+
+template<KernelType T>
+struct Accumulator;
+
+template<>
+struct Accumulator<std::int64_t> {
+    __m512i sum = _mm512_setzero_si512();
+    __m512i min = _mm512_set1_epi64(Aggregate<std::int64_t>::EMPTY_MIN);
+    __m512i max = _mm512_set1_epi64(Aggregate<std::int64_t>::EMPTY_MAX);
+
+    /**
+     * Only lanes in \p lanes are accumulated
+     */
+    void add(const __mmask8 lanes, const __m512i values) noexcept {
+        sum = _mm512_mask_add_epi64(sum, lanes, sum, values);
+        min = _mm512_mask_min_epi64(min, lanes, min, values);
+        max = _mm512_mask_max_epi64(max, lanes, max, values);
+    }
+
+    Aggregate<std::int64_t> reduce() const noexcept {
+        return { _mm512_reduce_add_epi64(sum), _mm512_reduce_min_epi64(min), _mm512_reduce_max_epi64(max), 0 };
+    }
+};
+
+template<>
+struct Accumulator<double> {
+    __m512d sum = _mm512_setzero_pd();
+    __m512d min = _mm512_set1_pd(Aggregate<double>::EMPTY_MIN);
+    __m512d max = _mm512_set1_pd(Aggregate<double>::EMPTY_MAX);
+
+    void add(const __mmask8 lanes, const __m512d values) noexcept {
+        sum = _mm512_mask_add_pd(sum, lanes, sum, values);
+        min = _mm512_mask_min_pd(min, lanes, min, values);
+        max = _mm512_mask_max_pd(max, lanes, max, values);
+    }
+
+    Aggregate<double> reduce() const noexcept {
+        return { _mm512_reduce_add_pd(sum), _mm512_reduce_min_pd(min), _mm512_reduce_max_pd(max), 0 };
+    }
+};
+
+} // namespace detail
+
+template<KernelType T>
+std::size_t filter(const T* const column, const std::size_t count, const Compare op, const T operand,
+                   std::uint32_t* const selection) noexcept {
+    return lute::tm::columnar::detail::with_compare(op, [&]<Compare Op>(std::integral_constant<Compare, Op>) {
+        const auto operands = detail::broadcast(operand);
+        const __m256i step = _mm256_set1_epi32(8);
+        __m256i indices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+        std::size_t selected = 0;
+        for (std::size_t i = 0; i < count; i += 8) {
+            const __mmask8 lanes = count - i >= 8 ? __mmask8{0xff} : detail::head(count - i);
+            const __mmask8 mask = detail::compare<Op>(lanes, detail::load(lanes, column + i), operands);
+            selected += detail::compress(indices, mask, selection + selected);
+            indices = _mm256_add_epi32(indices, step);
+        }
+        return selected;
+    });
+}
+
+template<KernelType T>
+std::size_t filter_selected(const T* const column, const std::uint32_t* const input, const std::size_t count,
+                            const Compare op, const T operand, std::uint32_t* const output) noexcept {
+    return lute::tm::columnar::detail::with_compare(op, [&]<Compare Op>(std::integral_constant<Compare, Op>) {
+        const auto operands = detail::broadcast(operand);
+
+        std::size_t selected = 0;
+        for (std::size_t i = 0; i < count; i += 8) {
+            const __mmask8 lanes = count - i >= 8 ? __mmask8{0xff} : detail::head(count - i);
+            const __m256i indices = detail::indices(lanes, input + i);
+            const __mmask8 mask = detail::compare<Op>(lanes, detail::gather(column, indices), operands);
+            selected += detail::compress(indices, mask, output + selected);
+        }
+        return selected;
+    });
+}
+
+template<KernelType T>
+Aggregate<T> aggregate(const T* const column, const std::size_t count) noexcept {
+    detail::Accumulator<T> accumulator;
+    for (std::size_t i = 0; i < count; i += 8) {
+        const __mmask8 lanes = count - i >= 8 ? __mmask8{0xff} : detail::head(count - i);
+        accumulator.add(lanes, detail::load(lanes, column + i));
+    }
+
+    Aggregate<T> result = accumulator.reduce();
+    result.count = count;
+    return result;
+}
+
+template<KernelType T>
+Aggregate<T> aggregate_selected(const T* const column, const std::uint32_t* const selection, const std::size_t count) noexcept {
+    detail::Accumulator<T> accumulator;
+    for (std::size_t i = 0; i < count; i += 8) {
+        const __mmask8 lanes = count - i >= 8 ? __mmask8{0xff} : detail::head(count - i);
+        accumulator.add(lanes, detail::gather(column, detail::indices(lanes, selection + i)));
+    }
+
+    Aggregate<T> result = accumulator.reduce();
+    result.count = count;
+    return result;
+}
+
+inline void hash_partition(const std::uint64_t* const keys, const std::size_t count, const std::uint32_t partitionCount,
+                           std::uint32_t* const partitions) noexcept {
+    const __m512i first = _mm512_set1_epi64(static_cast<long long>(0x9e3779b97f4a7c15));
+    const __m512i second = _mm512_set1_epi64(static_cast<long long>(0xd6e8feb86659fd93));
+    const __m512i range = _mm512_set1_epi64(partitionCount);
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        const __mmask8 lanes = count - i >= 8 ? __mmask8{0xff} : detail::head(count - i);
+        __m512i h = _mm512_maskz_loadu_epi64(lanes, keys + i);
+        h = _mm512_mullo_epi64(h, first);
+        h = _mm512_xor_si512(h, _mm512_srli_epi64(h, 32));
+        h = _mm512_mullo_epi64(h, second);
+        h = _mm512_xor_si512(h, _mm512_srli_epi64(h, 32));
+
+        const __m512i ids = _mm512_srli_epi64(_mm512_mul_epu32(h, range), 32);
+        _mm256_mask_storeu_epi32(partitions + i, lanes, _mm512_cvtepi64_epi32(ids));
+    }
+}
+
+template<KernelType T>
+inline constexpr ColumnKernels<T> COLUMN_KERNELS{ &filter<T>, &filter_selected<T>, &aggregate<T>, &aggregate_selected<T> };
+
+} // namespace lute::tm::columnar::avx512
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+
+#endif // __x86_64__
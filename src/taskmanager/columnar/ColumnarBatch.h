@@ -0,0 +1,104 @@
+#pragma once
+
+#include <memory/PlacedBuffer.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+namespace lute::tm::columnar {
+
+/**
+ * Columns start on a cache line, which is also a full AVX-512 vector
+ */
+inline constexpr std::size_t COLUMN_ALIGNMENT = 64;
+
+/**
+ * Field types a column can hold: copied with memcpy, never destroyed
+ */
+template<typename T>
+concept ColumnType = std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>;
+
+/**
+ * @struct ColumnarBatch
+ * @brief Struct-of-arrays view of \c recordCount consecutive records: field \c I of record \c i is
+ * <tt>column<I>()[i]</tt>
+ *
+ * The columnar counterpart of a gate's \c RecordBatch. Each column is contiguous, so a kernel scanning one
+ * field reads only that field's bytes, a full vector at a time.
+ */
+template<ColumnType... Fields>
+struct ColumnarBatch {
+    static constexpr std::size_t fields = sizeof...(Fields);
+
+    template<std::size_t I>
+    using field = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    std::tuple<Fields*...> columns;
+    std::size_t recordCount;
+
+    template<std::size_t I>
+    std::span<field<I>> column() const noexcept { return { std::get<I>(columns), recordCount }; }
+};
+
+/**
+ * @class SelectionVector
+ * @brief Ascending indices of the records of a batch that are still live after filtering
+ *
+ * Filters narrow a batch by writing a selection instead of moving records; later kernels read only the
+ * selected rows. Kernels write up to one entry per input record whatever the selectivity, so the capacity
+ * is the largest batch the vector is used with.
+ *
+ * @thread Operator Thread
+ */
+class SelectionVector {
+public:
+    explicit SelectionVector(const std::size_t capacity)
+        : storage_(std::max<std::size_t>(capacity, 1) * sizeof(std::uint32_t), {}, COLUMN_ALIGNMENT),
+          indices_(reinterpret_cast<std::uint32_t*>(storage_.get())),
+          capacity_(capacity)
+    {}
+
+    /**
+     * @brief Selects every record of a batch of \p count
+     */
+    void selectAll(const std::size_t count) noexcept {
+        assert(count <= capacity_);
+        std::iota(indices_, indices_ + count, std::uint32_t{0});
+        size_ = count;
+    }
+
+    /**
+     * @brief Sets the number of valid entries, after a kernel wrote them through \ref data
+     */
+    void resize(const std::size_t size) noexcept {
+        assert(size <= capacity_);
+        size_ = size;
+    }
+
+    void clear() noexcept { size_ = 0; }
+
+    std::uint32_t* data() noexcept { return indices_; }
+    const std::uint32_t* data() const noexcept { return indices_; }
+
+    std::span<const std::uint32_t> indices() const noexcept { return { indices_, size_ }; }
+    const std::uint32_t* begin() const noexcept { return indices_; }
+    const std::uint32_t* end() const noexcept { return indices_ + size_; }
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+private:
+    memory::PlacedBuffer storage_;
+    std::uint32_t* indices_;
+    std::size_t capacity_;
+    std::size_t size_ = 0;
+};
+
+} // namespace lute::tm::columnar
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace lute::tm::columnar {
+
+/**
+ * Instruction sets the kernels are built for. Every level is compiled into every build; which one runs is
+ * decided at runtime from what the CPU reports (see \ref detected_level).
+ */
+enum class SimdLevel : std::uint8_t {
+    Scalar,
+    Avx2,
+    Avx512,     ///< AVX-512 F, VL and DQ
+};
+
+/**
+ * Filter predicates, comparing a column value against a constant operand: \c Less selects
+ * <tt>value < operand</tt>. Floating-point comparisons follow C++: with NaN only \c NotEqual holds.
+ */
+enum class Compare : std::uint8_t {
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+};
+
+/**
+ * Column types the kernels are instantiated for
+ */
+template<typename T>
+concept KernelType = std::is_same_v<T, std::int64_t> || std::is_same_v<T, double>;
+
+/**
+ * @struct Aggregate
+ * @brief Sum, minimum and maximum of \c count values, computed in one pass
+ *
+ * Integer sums wrap. Floating-point sums are added in a different order at each \ref SimdLevel and may differ
+ * in the last bits. Minimum and maximum of values including NaN are unspecified. With \c count 0, \c min and
+ * \c max hold \ref Aggregate::EMPTY_MIN and \ref Aggregate::EMPTY_MAX.
+ */
+template<KernelType T>
+struct Aggregate {
+    static constexpr T EMPTY_MIN = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    static constexpr T EMPTY_MAX = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+
+    T sum = 0;
+    T min = EMPTY_MIN;
+    T max = EMPTY_MAX;
+    std::size_t count = 0;
+
+    bool operator==(const Aggregate&) const noexcept = default;
+};
+
+/**
+ * @struct ColumnKernels
+ * @brief One \ref SimdLevel's kernels over columns of \p T
+ */
+template<KernelType T>
+struct ColumnKernels {
+    std::size_t (*filter)(const T*, std::size_t, Compare, T, std::uint32_t*) noexcept;
+    std::size_t (*filterSelected)(const T*, const std::uint32_t*, std::size_t, Compare, T, std::uint32_t*) noexcept;
+    Aggregate<T> (*aggregate)(const T*, std::size_t) noexcept;
+    Aggregate<T> (*aggregateSelected)(const T*, const std::uint32_t*, std::size_t) noexcept;
+};
+
+/**
+ * @brief Mixes a 64-bit key into a well-distributed hash; the function every partitioning kernel implements
+ *
+ * Two rounds of multiply and xor-shift. Only full 64-bit multiplies and shifts, so it vectorizes on every
+ * level and all levels agree bit for bit.
+ */
+constexpr std::uint64_t hash_key(std::uint64_t key) noexcept {
+    key *= 0x9e3779b97f4a7c15;
+    key ^= key >> 32;
+    key *= 0xd6e8feb86659fd93;
+    key ^= key >> 32;
+    return key;
+}
+
+/**
+ * @brief Maps \p hash onto <tt>[0, partitions)</tt> by multiplying, without a division
+ */
+constexpr std::uint32_t partition_of(const std::uint64_t hash, const std::uint32_t partitions) noexcept {
+    return static_cast<std::uint32_t>(((hash & 0xffffffff) * partitions) >> 32);
+}
+
+namespace detail {
+
+/**
+ * Calls \p f with \p op as a compile-time constant, so that each kernel loop is specialised per predicate
+ */
+template<typename F>
+decltype(auto) with_compare(const Compare op, F&& f) {
+    switch (op) {
+        case Compare::Less: return f(std::integral_constant<Compare, Compare::Less>{});
+        case Compare::LessEqual: return f(std::integral_constant<Compare, Compare::LessEqual>{});
+        case Compare::Greater: return f(std::integral_constant<Compare, Compare::Greater>{});
+        case Compare::GreaterEqual: return f(std::integral_constant<Compare, Compare::GreaterEqual>{});
+        case Compare::Equal: return f(std::integral_constant<Compare, Compare::Equal>{});
+        case Compare::NotEqual: break;
+    }
+    return f(std::integral_constant<Compare, Compare::NotEqual>{});
+}
+
+} // namespace detail
+
+} // namespace lute::tm::columnar
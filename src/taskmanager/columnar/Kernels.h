@@ -0,0 +1,152 @@
+#pragma once
+
+#include <columnar/Avx2Kernels.h>
+#include <columnar/Avx512Kernels.h>
+#include <columnar/ColumnarBatch.h>
+#include <columnar/KernelTypes.h>
+#include <columnar/ScalarKernels.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace lute::tm::columnar {
+
+/**
+ * @struct Kernels
+ * @brief Dispatch table of one \ref SimdLevel
+ *
+ * Resolved once per process (\ref kernels) rather than per call, so a kernel call is one indirect call per
+ * batch. Operators normally use the free functions below; tests and benchmarks pass a table to pin a level.
+ */
+struct Kernels {
+    SimdLevel level;
+    ColumnKernels<std::int64_t> int64;
+    ColumnKernels<double> float64;
+    void (*hashPartition)(const std::uint64_t*, std::size_t, std::uint32_t, std::uint32_t*) noexcept;
+
+    template<KernelType T>
+    const ColumnKernels<T>& on() const noexcept {
+        if constexpr (std::is_same_v<T, std::int64_t>) return int64;
+        else return float64;
+    }
+};
+
+namespace detail {
+
+inline constexpr Kernels SCALAR_KERNELS{
+    SimdLevel::Scalar, scalar::COLUMN_KERNELS<std::int64_t>, scalar::COLUMN_KERNELS<double>, &scalar::hash_partition
+};
+
+#if defined(__x86_64__)
+// avx2::hash_partition emulates the 64-bit multiplies and measured slower than the scalar loop (1.05 vs 0.7 ns
+// per key); AVX2 hosts hash on the scalar kernel until it wins
+inline constexpr Kernels AVX2_KERNELS{
+    SimdLevel::Avx2, avx2::COLUMN_KERNELS<std::int64_t>, avx2::COLUMN_KERNELS<double>, &scalar::hash_partition
+};
+
+inline constexpr Kernels AVX512_KERNELS{
+    SimdLevel::Avx512, avx512::COLUMN_KERNELS<std::int64_t>, avx512::COLUMN_KERNELS<double>, &avx512::hash_partition
+};
+#endif
+
+inline SimdLevel detect() noexcept {
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq")) {
+        return SimdLevel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi") && __builtin_cpu_supports("popcnt")) {
+        return SimdLevel::Avx2;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+
+} // namespace detail
+
+/**
+ * @brief Widest level this CPU runs, detected on first use
+ */
+inline SimdLevel detected_level() noexcept {
+    static const SimdLevel level = detail::detect();
+    return level;
+}
+
+inline bool supported(const SimdLevel level) noexcept {
+    return level <= detected_level();
+}
+
+/**
+ * @brief Table for \p level, which must be \ref supported
+ */
+inline const Kernels& kernels(const SimdLevel level) noexcept {
+    assert(supported(level));
+#if defined(__x86_64__)
+    if (level == SimdLevel::Avx512) return detail::AVX512_KERNELS;
+    if (level == SimdLevel::Avx2) return detail::AVX2_KERNELS;
+#endif
+    return detail::SCALAR_KERNELS;
+}
+
+/**
+ * @brief Table for the widest level this CPU runs
+ */
+inline const Kernels& kernels() noexcept {
+    static const Kernels& best = kernels(detected_level());
+    return best;
+}
+
+/**
+ * @brief Selects the records of \p column for which <tt>value op operand</tt> holds
+ *
+ * @param selection Replaced with the indices of the selected records; needs capacity for all of \p column
+ * @return Number of records selected
+ */
+template<KernelType T>
+std::size_t filter(const std::span<const T> column, const Compare op, const T operand, SelectionVector& selection,
+                   const Kernels& table = kernels()) noexcept {
+    assert(column.size() <= selection.capacity());
+    selection.resize(table.on<T>().filter(column.data(), column.size(), op, operand, selection.data()));
+    return selection.size();
+}
+
+/**
+ * @brief Narrows \p selection, an earlier selection over \p column, to the records that also satisfy
+ * <tt>value op operand</tt>; chained filters are a conjunction
+ */
+template<KernelType T>
+std::size_t refine(const std::span<const T> column, const Compare op, const T operand, SelectionVector& selection,
+                   const Kernels& table = kernels()) noexcept {
+    selection.resize(table.on<T>().filterSelected(column.data(), selection.data(), selection.size(), op, operand, selection.data()));
+    return selection.size();
+}
+
+template<KernelType T>
+Aggregate<T> aggregate(const std::span<const T> column, const Kernels& table = kernels()) noexcept {
+    return table.on<T>().aggregate(column.data(), column.size());
+}
+
+/**
+ * @brief Sum, minimum and maximum over the records of \p column in \p selection
+ */
+template<KernelType T>
+Aggregate<T> aggregate(const std::span<const T> column, const SelectionVector& selection, const Kernels& table = kernels()) noexcept {
+    return table.on<T>().aggregateSelected(column.data(), selection.data(), selection.size());
+}
+
+/**
+ * @brief Assigns each key to one of \p partitionCount partitions:
+ * <tt>partitions[i] = partition_of(hash_key(keys[i]), partitionCount)</tt> on every level
+ *
+ * @param partitions Room for <tt>keys.size()</tt> partition ids
+ */
+inline void hash_partition(const std::span<const std::uint64_t> keys, const std::uint32_t partitionCount,
+                           std::uint32_t* const partitions, const Kernels& table = kernels()) noexcept {
+    assert(partitionCount != 0);
+    table.hashPartition(keys.data(), keys.size(), partitionCount, partitions);
+}
+
+} // namespace lute::tm::columnar
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <columnar/KernelTypes.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace lute::tm::columnar::scalar {
+
+/**
+ * Portable kernels: the fallback on CPUs without AVX2, the tail loops of the vector kernels and the
+ * reference the vector kernels are tested against.
+ *
+ * Selection outputs are written branch-free: every index is stored and the output position only advances
+ * when the predicate holds, so \p selection needs room for \p count entries whatever the selectivity.
+ */
+
+template<Compare Op, typename T>
+constexpr bool compare(const T value, const T operand) noexcept {
+    if constexpr (Op == Compare::Less) return value < operand;
+    else if constexpr (Op == Compare::LessEqual) return value <= operand;
+    else if constexpr (Op == Compare::Greater) return value > operand;
+    else if constexpr (Op == Compare::GreaterEqual) return value >= operand;
+    else if constexpr (Op == Compare::Equal) return value == operand;
+    else return value != operand;
+}
+
+template<KernelType T>
+T add(const T a, const T b) noexcept {
+    if constexpr (std::is_integral_v<T>) {
+        return static_cast<T>(static_cast<std::uint64_t>(a) + static_cast<std::uint64_t>(b));
+    } else {
+        return a + b;
+    }
+}
+
+/**
+ * @brief Indices \c i in <tt>[0, count)</tt> with <tt>column[i] Op operand</tt>, ascending
+ *
+ * @return Number of indices written to \p selection
+ */
+template<KernelType T>
+std::size_t filter(const T* const column, const std::size_t count, const Compare op, const T operand,
+                   std::uint32_t* const selection) noexcept {
+    return detail::with_compare(op, [&]<Compare Op>(std::integral_constant<Compare, Op>) {
+        std::size_t selected = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            selection[selected] = static_cast<std::uint32_t>(i);
+            selected += compare<Op>(column[i], operand);
+        }
+        return selected;
+    });
+}
+
+/**
+ * @brief Keeps the entries of \p input whose values satisfy the predicate; \p output may be \p input
+ */
+template<KernelType T>
+std::size_t filter_selected(const T* const column, const std::uint32_t* const input, const std::size_t count,
+                            const Compare op, const T operand, std::uint32_t* const output) noexcept {
+    return detail::with_compare(op, [&]<Compare Op>(std::integral_constant<Compare, Op>) {
+        std::size_t selected = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint32_t index = input[i];
+            output[selected] = index;
+            selected += compare<Op>(column[index], operand);
+        }
+        return selected;
+    });
+}
+
+template<KernelType T>
+Aggregate<T> aggregate(const T* const column, const std::size_t count) noexcept {
+    Aggregate<T> result;
+    for (std::size_t i = 0; i < count; ++i) {
+        result.sum = add(result.sum, column[i]);
+        result.min = std::min(result.min, column[i]);
+        result.max = std::max(result.max, column[i]);
+    }
+    result.count = count;
+    return result;
+}
+
+template<KernelType T>
+Aggregate<T> aggregate_selected(const T* const column, const std::uint32_t* const selection, const std::size_t count) noexcept {
+    Aggregate<T> result;
+    for (std::size_t i = 0; i < count; ++i) {
+        const T value = column[selection[i]];
+        result.sum = add(result.sum, value);
+        result.min = std::min(result.min, value);
+        result.max = std::max(result.max, value);
+    }
+    result.count = count;
+    return result;
+}
+
+/**
+ * @brief <tt>partitions[i] = partition_of(hash_key(keys[i]), partitionCount)</tt>
+ */
+inline void hash_partition(const std::uint64_t* const keys, const std::size_t count, const std::uint32_t partitionCount,
+                           std::uint32_t* const partitions) noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        partitions[i] = partition_of(hash_key(keys[i]), partitionCount);
+    }
+}
+
+/**
+ * @brief Folds \p from into \p into, as if their values had been aggregated together
+ */
+template<KernelType T>
+void merge(Aggregate<T>& into, const Aggregate<T>& from) noexcept {
+    into.sum = add(into.sum, from.sum);
+    into.min = std::min(into.min, from.min);
+    into.max = std::max(into.max, from.max);
+    into.count += from.count;
+}
+
+template<KernelType T>
+inline constexpr ColumnKernels<T> COLUMN_KERNELS{ &filter<T>, &filter_selected<T>, &aggregate<T>, &aggregate_selected<T> };
+
+} // namespace lute::tm::columnar::scalar
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <futex.h>
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+
+namespace lute::tm::flow {
+
+/**
+ * @class CreditLink
+ * @brief Credit account shared by the two ends of one edge
+ *
+ * The consumer grants a credit for every record it commits; the producer spends one for every record it
+ * sends. The account starts with the receiver's capacity in records (usually the InputGate capacity), so no
+ * more records than that are ever between the producer's writer and the gate's commit: the gate never
+ * rejects a push, and backpressure is decided at the producer by policy instead of surfacing as a short write
+ * somewhere in between.
+ *
+ * Neither side touches the shared word per record: the producer takes all granted credits at once into a
+ * private balance (\ref take), the consumer grants in batches (see \ref CreditedInputGate).
+ *
+ * @thread One producer (\ref take, \ref wait), one consumer (\ref grant); \ref close from any thread
+ */
+class CreditLink {
+public:
+    static constexpr std::chrono::nanoseconds FOREVER = std::chrono::nanoseconds::max();
+
+    explicit CreditLink(const std::uint32_t initialCredits) noexcept
+        : initial_(initialCredits),
+          granted_(initialCredits)
+    {
+        assert(initialCredits != 0);
+    }
+
+    CreditLink(const CreditLink&) = delete;
+    CreditLink& operator=(const CreditLink&) = delete;
+
+    /**
+     * @brief Returns \p credits to the producer and wakes it if it is parked in \ref wait
+     *
+     * @thread Consumer
+     */
+    void grant(const std::uint32_t credits) noexcept {
+        granted_.fetch_add(credits, std::memory_order_release);
+        wake();
+    }
+
+    /**
+     * @brief Moves every granted credit into the caller's balance
+     *
+     * @thread Producer
+     */
+    std::uint32_t take() noexcept {
+        if (granted_.load(std::memory_order_relaxed) == 0) return 0;
+        return granted_.exchange(0, std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Parks the producer until credits have been granted, the timeout expires or the link is closed
+     *
+     * @return true if credits are available to \ref take
+     *
+     * @thread Producer
+     */
+    bool wait(const std::chrono::nanoseconds timeout = FOREVER) noexcept {
+        using Clock = std::chrono::steady_clock;
+
+        const bool bounded = timeout != FOREVER;
+        const Clock::time_point deadline = bounded ? Clock::now() + timeout : Clock::time_point::max();
+
+        for (;;) {
+            if (granted_.load(std::memory_order_acquire) != 0) return true;
+            if (closed_.load(std::memory_order_acquire)) return false;
+
+            std::chrono::nanoseconds remaining = FOREVER;
+            if (bounded) {
+                remaining = deadline - Clock::now();
+                if (remaining.count() <= 0) return false;
+            }
+
+            producerSleeping_.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // The futex re-checks granted_ == 0 atomically with queueing, so a grant after this check is
+            // either seen by the kernel or followed by a wake
+            if (granted_.load(std::memory_order_relaxed) == 0 && !closed_.load(std::memory_order_relaxed)) {
+                if (bounded) {
+                    core::futex_wait(granted_, 0, remaining);
+                } else {
+                    core::futex_wait(granted_, 0);
+                }
+            }
+            producerSleeping_.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Wakes a parked producer and makes every later \ref wait return at once
+     */
+    void close() noexcept {
+        closed_.store(true, std::memory_order_release);
+        wake();
+    }
+
+    std::uint32_t initial() const noexcept { return initial_; }
+
+private:
+    void wake() noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (producerSleeping_.load(std::memory_order_relaxed) != 0) core::futex_wake(granted_, 1);
+    }
+
+    const std::uint32_t initial_;
+
+    alignas(64) std::atomic<std::uint32_t> granted_;
+
+    alignas(64) std::atomic<std::uint32_t> producerSleeping_{0};
+    std::atomic<bool> closed_{false};
+};
+
+} // namespace lute::tm::flow
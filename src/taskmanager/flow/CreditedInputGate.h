@@ -0,0 +1,93 @@
+#pragma once
+
+#include <flow/CreditLink.h>
+#include <metrics/FlowMetrics.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace lute::tm::flow {
+
+/**
+ * @class CreditedInputGate
+ * @brief Consumer end of a credited edge: grants one credit back to the \ref CreditLink per committed record
+ *
+ * Grants are batched: they go out once \c grantBatch records have been committed since the last grant, or
+ * on \ref flushGrants. The batch must not exceed the link's initial credits, otherwise a producer that has
+ * spent everything could wait for a grant that never reaches the threshold. Exposes the same producer and
+ * operator API as the gate, so it composes with \ref metrics::MeteredInputGate.
+ *
+ * Does not own the gate, the link or the metrics.
+ */
+template<typename Gate>
+class CreditedInputGate {
+public:
+    using record_type = typename Gate::record_type;
+    using RecordBatch = typename Gate::RecordBatch;
+
+    /**
+     * @param grantBatch Records committed per grant; defaults to a quarter of the link's credits
+     */
+    CreditedInputGate(Gate& gate, CreditLink& link, metrics::FlowMetrics& metrics, const std::uint32_t grantBatch = 0) noexcept
+        : gate_(gate),
+          link_(link),
+          metrics_(metrics),
+          grantBatch_(grantBatch != 0 ? grantBatch : std::max<std::uint32_t>(link.initial() / 4, 1))
+    {
+        assert(grantBatch_ <= link.initial());
+        assert(link.initial() <= gate.capacity());
+    }
+
+    template<typename... Args>
+    bool emplace(Args&&... args) noexcept(noexcept(std::declval<Gate&>().emplace(std::forward<Args>(args)...))) {
+        return gate_.emplace(std::forward<Args>(args)...);
+    }
+
+    std::size_t push(const record_type* const records, const std::size_t count)
+        noexcept(noexcept(std::declval<Gate&>().push(records, count))) {
+        return gate_.push(records, count);
+    }
+
+    RecordBatch fetch(const std::size_t maxRecords = 1U) noexcept { return gate_.fetch(maxRecords); }
+
+    /**
+     * @thread Operator
+     */
+    void commit(const std::size_t commitSize = 1U) noexcept {
+        gate_.commit(commitSize);
+
+        ungranted_ += static_cast<std::uint32_t>(commitSize);
+        if (ungranted_ >= grantBatch_) flushGrants();
+    }
+
+    /**
+     * @brief Grants every credit committed so far, e.g. before the operator goes idle
+     *
+     * @thread Operator
+     */
+    void flushGrants() noexcept {
+        if (ungranted_ == 0) return;
+
+        link_.grant(ungranted_);
+        metrics_.creditsGranted.add(ungranted_);
+        ungranted_ = 0;
+    }
+
+    std::size_t service() noexcept { return gate_.service(); }
+    std::size_t capacity() const noexcept { return gate_.capacity(); }
+
+    Gate& gate() noexcept { return gate_; }
+
+private:
+    Gate& gate_;
+    CreditLink& link_;
+    metrics::FlowMetrics& metrics_;
+    const std::uint32_t grantBatch_;
+
+    std::uint32_t ungranted_ = 0;
+};
+
+} // namespace lute::tm::flow
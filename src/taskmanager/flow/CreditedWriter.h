@@ -0,0 +1,206 @@
+#pragma once
+
+#include <channels/ChannelConcept.h>
+#include <channels/InMemoryChannel.h>
+#include <channels/RecordFraming.h>
+#include <flow/CreditLink.h>
+#include <flow/EdgePolicy.h>
+#include <metrics/FlowMetrics.h>
+#include <metrics/LatencyStamps.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace lute::tm::flow {
+
+enum class Admission : std::uint8_t {
+    Sent,       // framed into the output channel
+    Spilled,    // queued in the overflow buffer
+    Shed,       // dropped
+    Blocked,    // nothing happened; retry later
+};
+
+/**
+ * @class CreditedWriter
+ * @brief \ref channels::FramedWriter that spends one credit of a \ref CreditLink per frame and applies the
+ * edge's \ref Backpressure policy when it runs out
+ *
+ * Credits are taken from the link into a private balance only when the balance is empty, so the shared word
+ * is touched about once per granted batch. Under \c Spill, once a record has been spilled every later record
+ * queues behind it until the buffer has drained, so the edge stays in order; a full spill buffer blocks.
+ * The spill buffer is a framed ring allocated up front, so spilling never allocates.
+ *
+ * Operators on the worker pool return false on \c Blocked and keep their input, which is how the stall
+ * propagates upstream (see \ref runtime::exec::OperatorTask). Producers with their own thread can
+ * \ref wait for credits instead of polling.
+ *
+ * @thread Producer
+ */
+template<channels::ZeroCopyChannel ChannelImpl>
+class CreditedWriter {
+public:
+    CreditedWriter(ChannelImpl& channel, CreditLink& link, metrics::FlowMetrics& metrics,
+                   const EdgePolicy policy = {}, const channels::BatchPolicy batching = {})
+        : writer_(channel, batching),
+          link_(link),
+          metrics_(metrics),
+          policy_(policy)
+    {
+        if (policy.backpressure == Backpressure::Spill) spill_.emplace(policy.spillBytes);
+    }
+
+    CreditedWriter(const CreditedWriter&) = delete;
+    CreditedWriter& operator=(const CreditedWriter&) = delete;
+
+    /**
+     * @brief Sends \p payload as one frame if there is a credit for it, otherwise applies the policy
+     */
+    Admission append(const std::span<const std::byte> payload, const channels::FrameKind kind = channels::FrameKind::Record) noexcept {
+        if (spill_ && !spill_->empty() && !drain()) return enqueue(payload, kind);
+
+        if (!acquire()) return onNoCredit(payload, kind);
+        if (!writer_.append(payload, kind)) {
+            metrics_.blocked.add();
+            return Admission::Blocked;      // ring full despite the credit; keep it for the retry
+        }
+
+        spend();
+        return Admission::Sent;
+    }
+
+    /**
+     * @brief Sends spilled records while credits last
+     *
+     * @return true if nothing is left in the spill buffer
+     */
+    bool drain() noexcept {
+        if (!spill_) return true;
+
+        while (!spill_->empty()) {
+            const channels::FrameBatch batch = spill_->reader.fetch(1);
+            if (batch.empty()) break;
+
+            const channels::Frame frame = *batch.begin();
+            if (!acquire() || !writer_.append(frame.payload, frame.kind)) return false;
+
+            spend();
+            spill_->reader.release(batch);
+            --spill_->records;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Drains the spill buffer and publishes output held back longer than the batch delay budget;
+     * call it from the producer loop when there is no new input
+     */
+    void poll() noexcept {
+        drain();
+        writer_.poll();
+    }
+
+    void flush() noexcept {
+        drain();
+        writer_.flush();
+    }
+
+    /**
+     * @brief Publishes the pending output, then parks until credits arrive; for producers that own a thread
+     *
+     * @return true if credits are available
+     */
+    bool wait(const std::chrono::nanoseconds timeout = CreditLink::FOREVER) noexcept {
+        if (balance_ != 0) return true;
+        writer_.flush();
+        return link_.wait(timeout);
+    }
+
+    std::uint32_t credits() const noexcept { return balance_; }
+    std::size_t spilledRecords() const noexcept { return spill_ ? spill_->records : 0; }
+
+    channels::FramedWriter<ChannelImpl>& writer() noexcept { return writer_; }
+
+private:
+    /**
+     * @brief Overflow ring for the Spill policy
+     */
+    struct Spill {
+        explicit Spill(const std::size_t bytes)
+            : ring(std::bit_ceil(std::max(bytes, channels::FRAME_ALIGNMENT * 2))),
+              writer(ring, channels::BatchPolicy{ .maxRecords = 1, .maxBytes = SIZE_MAX, .maxDelay = {} }),
+              reader(ring)
+        {}
+
+        bool empty() const noexcept { return records == 0; }
+
+        channels::InMemoryChannel ring;
+        channels::FramedWriter<channels::InMemoryChannel> writer;
+        channels::FramedReader<channels::InMemoryChannel> reader;
+        std::size_t records = 0;
+    };
+
+    bool acquire() noexcept {
+        if (balance_ == 0) balance_ = link_.take();
+        if (balance_ != 0) {
+            if (stallStart_ != 0) endStall();
+            return true;
+        }
+
+        if (stallStart_ == 0) {
+            stallStart_ = metrics::now_ns();
+            metrics_.stalls.add();
+            writer_.flush();                // the consumer can only grant what it sees
+        }
+        return false;
+    }
+
+    void spend() noexcept {
+        --balance_;
+        metrics_.recordsSent.add();
+    }
+
+    void endStall() noexcept {
+        metrics_.stallNs.record(metrics::now_ns() - stallStart_);
+        stallStart_ = 0;
+    }
+
+    Admission onNoCredit(const std::span<const std::byte> payload, const channels::FrameKind kind) noexcept {
+        switch (policy_.backpressure) {
+            case Backpressure::Spill:
+                return enqueue(payload, kind);
+            case Backpressure::Shed:
+                metrics_.shedRecords.add();
+                return Admission::Shed;
+            case Backpressure::Block:
+                break;
+        }
+        metrics_.blocked.add();
+        return Admission::Blocked;
+    }
+
+    Admission enqueue(const std::span<const std::byte> payload, const channels::FrameKind kind) noexcept {
+        if (!spill_->writer.append(payload, kind)) {
+            metrics_.blocked.add();
+            return Admission::Blocked;
+        }
+
+        ++spill_->records;
+        metrics_.spilledRecords.add();
+        return Admission::Spilled;
+    }
+
+    channels::FramedWriter<ChannelImpl> writer_;
+    CreditLink& link_;
+    metrics::FlowMetrics& metrics_;
+    const EdgePolicy policy_;
+
+    std::uint32_t balance_ = 0;
+    std::uint64_t stallStart_ = 0;
+    std::optional<Spill> spill_;
+};
+
+} // namespace lute::tm::flow
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lute::tm::flow {
+
+/**
+ * @brief What a producer does with a record that has no credit
+ */
+enum class Backpressure : std::uint8_t {
+    Block,      // refuse it; the caller retries later, which holds its own input back
+    Spill,      // queue it in a bounded overflow buffer, sent in order as credits return
+    Shed,       // drop it and count it
+};
+
+/**
+ * @struct EdgePolicy
+ * @brief Per-edge backpressure configuration of a \ref CreditedWriter
+ */
+struct EdgePolicy {
+    Backpressure backpressure = Backpressure::Block;
+    std::size_t spillBytes = 1 << 20;       // overflow buffer for Spill, rounded up to a power of two
+};
+
+} // namespace lute::tm::flow
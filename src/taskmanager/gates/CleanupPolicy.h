@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace lute::tm::gates {
+
+/**
+ * Cleanup policies for \ref InputGate (see ADR 0001).
+ *
+ * A policy decides where \c commit_ (destroying consumed records and handing their slots back to the
+ * producer) runs. Every policy exposes the same two hooks, which the gate calls and the operator never sees:
+ *
+ * - \c on_commit(gate, committedIdx, commitSize) runs on the operator thread inside \c commit()
+ * - \c service(gate) runs on the InputGate thread and performs any cleanup that was delegated to it
+ *
+ * \c committedIdx is the operator's cumulative consumed index after the commit.
+ */
+
+/**
+ * @brief Cleanup runs inline inside \c commit() on the operator thread
+ */
+struct SynchronousCleanup {
+    template<typename Gate>
+    void on_commit(Gate& gate, const std::size_t, const std::size_t commitSize) noexcept {
+        gate.commit_(commitSize);
+    }
+
+    template<typename Gate>
+    std::size_t service(Gate&) noexcept { return 0; }
+};
+
+/**
+ * @brief \c commit() only publishes the consumed index; the InputGate thread cleans up whenever it calls
+ * \c service(), typically once per iteration of its ingest loop
+ */
+struct DeferredCleanup {
+    template<typename Gate>
+    void on_commit(Gate&, const std::size_t committedIdx, const std::size_t) noexcept {
+        committedIdx_.store(committedIdx, std::memory_order_release);
+    }
+
+    template<typename Gate>
+    std::size_t service(Gate& gate) noexcept {
+        const std::size_t committed = committedIdx_.load(std::memory_order_acquire);
+        const std::size_t pending = committed - gate.cleanedIndex();
+
+        if (pending != 0) gate.commit_(pending);
+        return pending;
+    }
+
+private:
+    alignas(64) std::atomic<std::size_t> committedIdx_{0};
+};
+
+/**
+ * @brief Like \ref DeferredCleanup, but a dedicated cleanup thread parks in \c wait() and \c commit()
+ * wakes it up. The wake-up is only issued while the cleanup thread is actually parked, so an operator
+ * that commits faster than cleanup runs never pays for a syscall.
+ */
+struct SignaledCleanup {
+    template<typename Gate>
+    void on_commit(Gate&, const std::size_t committedIdx, const std::size_t) noexcept {
+        committedIdx_.store(committedIdx, std::memory_order_seq_cst);
+
+        if (parked_.load(std::memory_order_seq_cst) != 0) {
+            signal_.fetch_add(1, std::memory_order_release);
+            signal_.notify_one();
+        }
+    }
+
+    template<typename Gate>
+    std::size_t service(Gate& gate) noexcept {
+        const std::size_t committed = committedIdx_.load(std::memory_order_acquire);
+        const std::size_t pending = committed - gate.cleanedIndex();
+
+        if (pending != 0) gate.commit_(pending);
+        return pending;
+    }
+
+    /**
+     * @brief Parks the cleanup thread until the operator commits past \p gate's cleaned index,
+     * or until \ref wake is called after \p stop has been set
+     */
+    template<typename Gate>
+    void wait(Gate& gate, const std::atomic<bool>& stop) noexcept {
+        const std::uint32_t generation = signal_.load(std::memory_order_acquire);
+
+        parked_.store(1, std::memory_order_seq_cst);
+        if (committedIdx_.load(std::memory_order_seq_cst) == gate.cleanedIndex()
+            && !stop.load(std::memory_order_seq_cst)) {
+            signal_.wait(generation, std::memory_order_acquire);
+        }
+        parked_.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Unparks the cleanup thread unconditionally; call after setting the stop flag passed to \ref wait
+     */
+    void wake() noexcept {
+        signal_.fetch_add(1, std::memory_order_seq_cst);
+        signal_.notify_all();
+    }
+
+private:
+    alignas(64) std::atomic<std::size_t> committedIdx_{0};
+    alignas(64) std::atomic<std::uint32_t> parked_{0};
+    std::atomic<std::uint32_t> signal_{0};
+};
+
+/**
+ * @brief No cleanup at all: \c commit() hands slots straight back to the producer. Only valid for records
+ * that need no destruction.
+ */
+struct OmittedCleanup {
+    template<typename Gate>
+    void on_commit(Gate& gate, const std::size_t, const std::size_t commitSize) noexcept {
+        static_assert(std::is_trivially_destructible_v<typename Gate::record_type>,
+                      "OmittedCleanup requires trivially destructible records");
+        gate.release_(commitSize);
+    }
+
+    template<typename Gate>
+    std::size_t service(Gate&) noexcept { return 0; }
+};
+
+} // lute::tm::gates
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <trace.h>
+#include <columnar/ColumnarBatch.h>
+#include <memory/PlacedBuffer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+namespace lute::tm::gates {
+
+/**
+ * @class ColumnarGate
+ * @brief \ref InputGate with the ring stored column by column: one aligned array per field
+ *
+ * The operator fetches a \ref columnar::ColumnarBatch instead of a \c RecordBatch and runs the kernels of
+ * \ref columnar::Kernels over whole columns. Records arrive either one at a time (\ref emplace, which
+ * scatters the fields) or already transposed (\ref push). Fields must be trivially copyable, so commits
+ * only hand slots back; there is no cleanup policy.
+ *
+ * Every column starts on a cache line. A batch starts on one too whenever the operator commits in
+ * multiples of 64 bytes' worth of records, which the kernels do not require but benefit from.
+ *
+ * @tparam Fields Type of each column, in order
+ *
+ * @note Single producer (the InputGate thread), single consumer (the operator thread running the
+ * fetch–commit cycle), like \ref InputGate.
+ */
+template<columnar::ColumnType... Fields>
+class ColumnarGate {
+public:
+    using batch_type = columnar::ColumnarBatch<Fields...>;
+
+    static constexpr std::size_t fields = sizeof...(Fields);
+
+    /**
+     * @param capacity Buffer Size of the gate, in records. Must be a power of two.
+     * @param placement Where the columns live, typically the operator thread's NUMA node
+     */
+    explicit ColumnarGate(const std::size_t capacity, const memory::MemoryPlacement placement = {})
+        : storage_((columnBytes<Fields>(capacity) + ...), placement, columnar::COLUMN_ALIGNMENT),
+          capacity_(capacity),
+          mask_(capacity - 1),
+          writeIdx_(0),
+          readIdx_(0)
+    {
+        assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+
+        std::byte* next = storage_.get();
+        columns_ = std::tuple<Fields*...>{ carve<Fields>(next, capacity)... };
+    }
+
+    ColumnarGate(const ColumnarGate&) = delete;
+    ColumnarGate& operator=(const ColumnarGate&) = delete;
+
+    /**
+     * @brief Appends one record, writing each field into its column
+     *
+     * @return false if the gate is full
+     *
+     * @thread InputGate Thread runs emplace
+     */
+    bool emplace(const Fields... values) noexcept {
+        const std::size_t w = writeIdx_.load(std::memory_order_relaxed);
+        const std::size_t r = readIdx_.load(std::memory_order_acquire);
+
+        if (w - r == capacity_) return false;
+
+        const std::size_t slot = w & mask_;
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((std::get<I>(columns_)[slot] = values), ...);
+        }(std::index_sequence_for<Fields...>{});
+
+        writeIdx_.store(w + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Copies up to \p count records given column by column, one memcpy per column and ring segment,
+     * and publishes them with a single index store
+     *
+     * @return Number of records accepted
+     *
+     * @thread InputGate Thread runs push
+     */
+    std::size_t push(const Fields* const... columns, const std::size_t count) noexcept {
+        return publish(count, [&](const std::size_t slot, const std::size_t from, const std::size_t n) noexcept {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                (std::memcpy(std::get<I>(columns_) + slot, columns + from, n * sizeof(Fields)), ...);
+            }(std::index_sequence_for<Fields...>{});
+        });
+    }
+
+    /**
+     * @brief Transposes up to \p count array-of-structs records into the columns: column \c I receives
+     * member \c I of \p members
+     *
+     * @return Number of records accepted
+     *
+     * @thread InputGate Thread runs transpose
+     */
+    template<typename Record>
+    std::size_t transpose(const Record* const records, const std::size_t count, Fields Record::* const... members) noexcept {
+        return publish(count, [&](const std::size_t slot, const std::size_t from, const std::size_t n) noexcept {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                (scatter<I>(std::get<I>(columns_) + slot, records + from, n, members), ...);
+            }(std::index_sequence_for<Fields...>{});
+        });
+    }
+
+    /**
+     * @brief Columns of up to \p maxRecords records, starting at the first uncommitted one
+     *
+     * As with \ref InputGate::fetch, the batch never crosses the end of the ring, and fetching again without
+     * committing returns the same records.
+     *
+     * @thread Operator Thread runs fetch
+     *
+     * @see commit
+     */
+    batch_type fetch(const std::size_t maxRecords = 1U) noexcept {
+        CORE_TRACE_SCOPE("gate", "ColumnarGate::fetch");
+
+        const std::size_t w = writeIdx_.load(std::memory_order_acquire);
+        const std::size_t r = readIdx_.load(std::memory_order_relaxed);
+        const std::size_t pos = r & mask_;
+
+        const std::size_t count = std::min({maxRecords, w - r, capacity_ - pos});
+        return batch_type{
+            std::apply([pos](Fields* const... columns) { return std::tuple<Fields*...>{ (columns + pos)... }; }, columns_),
+            count
+        };
+    }
+
+    /**
+     * @brief Hands \p commitSize records back to the producer
+     *
+     * @thread Operator Thread runs commit
+     */
+    void commit(const std::size_t commitSize = 1U) noexcept {
+        CORE_TRACE_SCOPE("gate", "ColumnarGate::commit");
+
+        const std::size_t r = readIdx_.load(std::memory_order_relaxed);
+        assert(commitSize <= writeIdx_.load(std::memory_order_relaxed) - r);
+        readIdx_.store(r + commitSize, std::memory_order_release);
+    }
+
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief Records published but not yet committed
+     *
+     * @thread Operator Thread
+     */
+    std::size_t pending() const noexcept {
+        return writeIdx_.load(std::memory_order_acquire) - readIdx_.load(std::memory_order_relaxed);
+    }
+
+private:
+    template<typename T>
+    static constexpr std::size_t columnBytes(const std::size_t capacity) noexcept {
+        return (capacity * sizeof(T) + columnar::COLUMN_ALIGNMENT - 1) / columnar::COLUMN_ALIGNMENT * columnar::COLUMN_ALIGNMENT;
+    }
+
+    template<typename T>
+    static T* carve(std::byte*& next, const std::size_t capacity) noexcept {
+        T* const column = reinterpret_cast<T*>(next);
+        next += columnBytes<T>(capacity);
+        return column;
+    }
+
+    template<std::size_t I, typename T, typename Record>
+    static void scatter(T* const column, const Record* const records, const std::size_t n, T Record::* const member) noexcept {
+        for (std::size_t i = 0; i < n; ++i) column[i] = records[i].*member;
+    }
+
+    /**
+     * Runs \p copy(slot, from, n) over at most two ring segments, then publishes what was copied
+     */
+    template<typename Copy>
+    std::size_t publish(const std::size_t count, Copy&& copy) noexcept {
+        const std::size_t w = writeIdx_.load(std::memory_order_relaxed);
+        const std::size_t r = readIdx_.load(std::memory_order_acquire);
+
+        const std::size_t toPush = std::min(count, capacity_ - (w - r));
+        if (toPush == 0) return 0;
+
+        const std::size_t slot = w & mask_;
+        const std::size_t first = std::min(toPush, capacity_ - slot);
+        copy(slot, 0, first);
+        if (first != toPush) copy(0, first, toPush - first);
+
+        writeIdx_.store(w + toPush, std::memory_order_release);
+        return toPush;
+    }
+
+    memory::PlacedBuffer storage_;
+    std::tuple<Fields*...> columns_;
+    const std::size_t capacity_;
+    const std::size_t mask_;
+
+    alignas(64) std::atomic<std::size_t> writeIdx_;
+    alignas(64) std::atomic<std::size_t> readIdx_;
+};
+
+} // lute::tm::gates
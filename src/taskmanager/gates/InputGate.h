@@ -1,79 +1,243 @@
 #pragma once
 
+#include <trace.h>
+#include <gates/CleanupPolicy.h>
+#include <memory/PlacedBuffer.h>
+
+#include <algorithm>
 #include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace lute::tm::gates {
 
 /**
  * @class InputGate
- * 
+ *
  * @tparam RecordType Type of Record that InputGate ingests from upstream
- * 
- * @note This is supposed to be an interface, does not provide implemenation per se
+ * @tparam CleanupPolicy Where \ref commit_ runs: \ref SynchronousCleanup, \ref DeferredCleanup,
+ * \ref SignaledCleanup or \ref OmittedCleanup. Operator code is identical for all of them.
+ *
+ * @note Single producer (the InputGate thread pushing records from upstream), single consumer (the
+ * operator thread running the fetch–commit cycle). Records live in a preallocated, cache-line-aligned
+ * ring and are handed to the operator in place.
  */
-template<typename RecordType>
+template<typename RecordType, typename CleanupPolicy = SynchronousCleanup>
 class InputGate {
+    static_assert(std::is_nothrow_destructible_v<RecordType>, "Records are destroyed on the hot path");
+
 public:
+    using record_type = RecordType;
+    using cleanup_policy = CleanupPolicy;
+
     /**
      * @brief Construct InputGate
-     * 
-     * @param capacity Buffer Size of Input Gate
+     *
+     * @param capacity Buffer Size of Input Gate, in records. Must be a power of two.
+     * @param placement Where the record ring lives, typically the operator thread's NUMA node
      */
-    InputGate(const std::size_t capacity);
+    explicit InputGate(const std::size_t capacity, const memory::MemoryPlacement placement = {})
+        : storage_(capacity * sizeof(RecordType), placement, ALIGNMENT),
+          buffer_(reinterpret_cast<RecordType*>(storage_.get())),
+          capacity_(capacity),
+          mask_(capacity - 1),
+          writeIdx_(0),
+          readIdx_(0),
+          commitIdx_(0)
+    {
+        assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+    }
+
+    InputGate(const InputGate&) = delete;
+    InputGate& operator=(const InputGate&) = delete;
+
+    ~InputGate() {
+        const std::size_t w = writeIdx_.load(std::memory_order_relaxed);
+        for (std::size_t i = readIdx_.load(std::memory_order_relaxed); i != w; ++i) {
+            std::destroy_at(buffer_ + (i & mask_));
+        }
+    }
 
     struct RecordBatch {
         RecordType* data;
         std::size_t recordCount;
     };
 
+    /**
+     * @brief Constructs a record in the next free slot
+     *
+     * @return false if the gate is full; nothing is constructed in that case
+     *
+     * @thread InputGate Thread runs emplace
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<RecordType, Args...>) {
+        const std::size_t w = writeIdx_.load(std::memory_order_relaxed);
+        const std::size_t r = readIdx_.load(std::memory_order_acquire);
+
+        if (w - r == capacity_) return false;
+
+        std::construct_at(buffer_ + (w & mask_), std::forward<Args>(args)...);
+        writeIdx_.store(w + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Copies up to \p count records into the gate and publishes them with a single index store
+     *
+     * @return Number of records accepted
+     *
+     * @thread InputGate Thread runs push
+     */
+    std::size_t push(const RecordType* const records, const std::size_t count)
+        noexcept(std::is_nothrow_copy_constructible_v<RecordType>) {
+        const std::size_t w = writeIdx_.load(std::memory_order_relaxed);
+        const std::size_t r = readIdx_.load(std::memory_order_acquire);
+
+        const std::size_t toPush = std::min(count, capacity_ - (w - r));
+        for (std::size_t i = 0; i < toPush; ++i) {
+            std::construct_at(buffer_ + ((w + i) & mask_), records[i]);
+        }
+
+        if (toPush != 0) writeIdx_.store(w + toPush, std::memory_order_release);
+        return toPush;
+    }
+
     /**
      * @brief Returns pointer to Record buffer for reading through argument and the number of records to read
-     * 
+     *
+     * The batch always starts at the first uncommitted record and never crosses the end of the ring, so
+     * it may hold fewer than the available records. Fetching again without committing returns the same records.
+     *
      * @param maxRecords Maximum number of records requested; default to 1.
-     * 
+     *
      * @return \c RecordBatch containing pointer and number of records to read
-     * 
+     *
      * @thread Operator Thread runs fetch
-     * 
+     *
      * @see commit
      */
-    RecordBatch fetch(const std::size_t maxRecords = 1U) noexcept;
+    RecordBatch fetch(const std::size_t maxRecords = 1U) noexcept {
+        CORE_TRACE_SCOPE("gate", "InputGate::fetch");
+
+        const std::size_t w = writeIdx_.load(std::memory_order_acquire);
+        const std::size_t pos = commitIdx_ & mask_;
+
+        const std::size_t count = std::min({maxRecords, w - commitIdx_, capacity_ - pos});
+        return RecordBatch{buffer_ + pos, count};
+    }
 
 
     /**
-     * @brief Intimates safe ingestion of records by the operator. The architecture expects the operator to call it after it has successfully 
+     * @brief Intimates safe ingestion of records by the operator. The architecture expects the operator to call it after it has successfully
      * read input record and written output record safely. This defines the buffer positions that are now free to be overwritten.
-     * 
+     *
      * @note The architecture expects \ref commit to be a very lightweight method, if it does any work at all. The cleanup logic can live in the
      * InputGate's protected methods. This is an aspect that determines how lightweight the InputGate is for the Operator thread to use.
-     * 
+     *
      * @thread Operator Thread runs commit
-     * 
+     *
      * @see fetch
      * @see commit_
      */
-    void commit(const std::size_t commitSize = 1U) noexcept;
+    void commit(const std::size_t commitSize = 1U) noexcept {
+        CORE_TRACE_SCOPE("gate", "InputGate::commit");
 
+        assert(commitSize <= writeIdx_.load(std::memory_order_relaxed) - commitIdx_);
+
+        commitIdx_ += commitSize;
+        policy_.on_commit(*this, commitIdx_, commitSize);
+    }
+
+    /**
+     * @brief Runs cleanup that the policy delegated to the gate. A no-op for synchronous and omitted cleanup.
+     *
+     * @return Number of records cleaned up
+     *
+     * @thread InputGate Thread (or the dedicated cleanup thread) runs service; never more than one thread per gate
+     */
+    std::size_t service() noexcept {
+        return policy_.service(*this);
+    }
+
+    /**
+     * @brief Parks the cleanup thread until there is something to clean up. Only for \ref SignaledCleanup.
+     *
+     * @param stop Checked before parking; set it and then call \ref wakeCleanup to shut the cleanup thread down
+     */
+    void waitForCommits(const std::atomic<bool>& stop) noexcept
+        requires std::is_same_v<CleanupPolicy, SignaledCleanup> {
+        policy_.wait(*this, stop);
+    }
+
+    void wakeCleanup() noexcept
+        requires std::is_same_v<CleanupPolicy, SignaledCleanup> {
+        policy_.wake();
+    }
+
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief Records published but not yet committed
+     *
+     * @thread Operator Thread
+     */
+    std::size_t pending() const noexcept {
+        return writeIdx_.load(std::memory_order_acquire) - commitIdx_;
+    }
+
+    /**
+     * @brief Index up to which slots have been cleaned and handed back to the producer
+     */
+    std::size_t cleanedIndex() const noexcept {
+        return readIdx_.load(std::memory_order_relaxed);
+    }
 
 protected:
 
     /**
-     * @brief Implements the work load involved in cleanup of the buffer. Is supposed to be either called by \ref commit, 
+     * @brief Implements the work load involved in cleanup of the buffer. Is supposed to be either called by \ref commit,
      * wait for wake up to do the clean up, or never be called at all (in case the load of cleanup is taken by the operator)
-     * 
+     *
      * @note The architecture expects \ref commit to be a very lightweight method, if it does any work at all. The cleanup logic can live in the
      * InputGate's protected methods. This is an aspect that determines how lightweight the InputGate is for the Operator thread to use.
-     * 
+     *
      * @thread InputGate Thread runs commit
      */
-    void commit_(const std::size_t commitSize = 1U) noexcept;
+    void commit_(const std::size_t commitSize = 1U) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<RecordType>) {
+            const std::size_t r = readIdx_.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i < commitSize; ++i) {
+                std::destroy_at(buffer_ + ((r + i) & mask_));
+            }
+        }
+
+        release_(commitSize);
+    }
 
 private:
-    RecordType* buffer_;
-    size_t capacity_;
+    friend CleanupPolicy;
+
+    static constexpr std::size_t ALIGNMENT = std::max<std::size_t>(64, alignof(RecordType));
+
+    void release_(const std::size_t commitSize) noexcept {
+        readIdx_.store(readIdx_.load(std::memory_order_relaxed) + commitSize, std::memory_order_release);
+    }
+
+    memory::PlacedBuffer storage_;
+    RecordType* const buffer_;
+    const std::size_t capacity_;
+    const std::size_t mask_;
 
     alignas(64) std::atomic<std::size_t> writeIdx_;
     alignas(64) std::atomic<std::size_t> readIdx_;
+
+    alignas(64) std::size_t commitIdx_;
+    CleanupPolicy policy_;
 };
 
 } // lute::tm::gates
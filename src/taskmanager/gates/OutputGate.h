@@ -0,0 +1,216 @@
+#pragma once
+
+#include <trace.h>
+#include <channels/ChannelConcept.h>
+#include <channels/RingRegion.h>
+#include <gates/Partitioners.h>
+#include <memory/PlacedBuffer.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lute::tm::gates {
+
+/**
+ * @class OutputGate
+ * @brief Operator-side end of a keyed shuffle: partitions records in batches and stages them per downstream
+ * channel, publishing each channel's records in bulk
+ *
+ * \ref push runs the partitioner over a batch of records at a time, then scatters the records into one
+ * staging buffer per partition. A buffer that fills is written to its channel with a single reserve and
+ * publish, so the consumer sees one index store per buffer instead of one per record. By default the
+ * buffers together stay within \ref STAGING_BUDGET, about one core's share of L2, so the scatter hits cache
+ * however many partitions there are.
+ *
+ * Channels carry bare records, back to back; the downstream InputGate thread receives them in multiples of
+ * \c sizeof(RecordType). Partly filled buffers are published by \ref flush, which the operator calls when it
+ * runs out of input and before barriers and watermarks are forwarded.
+ *
+ * @tparam RecordType Trivially copyable record
+ * @tparam ChannelType One per downstream partition, in partition order
+ * @tparam PartitionerType \ref HashPartitioner, \ref RangePartitioner, \ref RoundRobinPartitioner or any
+ * other \ref Partitioner
+ *
+ * @thread Operator Thread
+ */
+template<typename RecordType, channels::ZeroCopyChannel ChannelType, Partitioner<RecordType> PartitionerType>
+class OutputGate {
+    static_assert(std::is_trivially_copyable_v<RecordType>, "Records are published as raw bytes");
+
+public:
+    using record_type = RecordType;
+
+    /**
+     * Staging bytes of all partitions together, by default
+     */
+    static constexpr std::size_t STAGING_BUDGET = 256 * 1024;
+
+    /**
+     * Staging bytes of one partition, by default; bigger buffers only delay records without saving publishes
+     */
+    static constexpr std::size_t MAX_STAGING_BYTES = 16 * 1024;
+
+    /**
+     * @brief Records staged per partition when the constructor is not told otherwise
+     */
+    static constexpr std::size_t defaultStaging(const std::size_t partitions) noexcept {
+        const std::size_t bytes = std::min(MAX_STAGING_BYTES, STAGING_BUDGET / std::max<std::size_t>(partitions, 1));
+        return std::max<std::size_t>(bytes / sizeof(RecordType), 1);
+    }
+
+    /**
+     * @param channels Downstream channels; channel \c i receives partition \c i. Not owned.
+     * @param partitioner Must assign exactly <tt>channels.size()</tt> partitions
+     * @param stagingRecords Records staged per partition before a publish; 0 for \ref defaultStaging
+     * @param placement Where the staging buffers live, typically the operator thread's NUMA node
+     */
+    OutputGate(const std::span<ChannelType* const> channels, PartitionerType partitioner,
+               const std::size_t stagingRecords = 0, const memory::MemoryPlacement placement = {})
+        : channels_(channels.begin(), channels.end()),
+          partitioner_(std::move(partitioner)),
+          staging_(stagingRecords != 0 ? stagingRecords : defaultStaging(channels.size())),
+          stride_(alignUp(staging_ * sizeof(RecordType))),
+          storage_(stride_ * channels.size(), placement),
+          fill_(channels.size(), 0)
+    {
+        assert(!channels_.empty() && partitioner_.partitions() == channels_.size());
+    }
+
+    OutputGate(const OutputGate&) = delete;
+    OutputGate& operator=(const OutputGate&) = delete;
+
+    /**
+     * @brief Partitions and stages up to \p count records, publishing every buffer that fills
+     *
+     * Stops at the first record whose buffer is full and whose channel has no room to drain it: the records
+     * before it are accepted, the rest are left to the caller to push again. Records of one partition reach
+     * its channel in the order they were pushed.
+     *
+     * @return Number of records accepted
+     */
+    std::size_t push(const RecordType* const records, const std::size_t count) noexcept {
+        CORE_TRACE_SCOPE("gate", "OutputGate::push");
+
+        for (std::size_t offset = 0; offset < count; offset += PARTITION_BATCH) {
+            const std::size_t n = std::min(PARTITION_BATCH, count - offset);
+            partitioner_.assign(records + offset, n, partitions_.data());
+
+            for (std::size_t i = 0; i < n; ++i) {
+                if (!stage(partitions_[i], records[offset + i])) return offset + i;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Publishes every partly filled buffer
+     *
+     * @return true if nothing is left staged; false if a channel was too full to take all of its records
+     */
+    bool flush() noexcept {
+        CORE_TRACE_SCOPE("gate", "OutputGate::flush");
+
+        bool drained = true;
+        for (std::size_t partition = 0; partition < channels_.size(); ++partition) {
+            publish(partition);
+            drained &= fill_[partition] == 0;
+        }
+        return drained;
+    }
+
+    std::size_t partitions() const noexcept { return channels_.size(); }
+    std::size_t stagingRecords() const noexcept { return staging_; }
+
+    /**
+     * @brief Records staged for \p partition and not yet published
+     */
+    std::size_t staged(const std::size_t partition) const noexcept { return fill_[partition]; }
+
+    /**
+     * @brief Channel publishes so far; \ref published / publishes is the average records per publish
+     */
+    std::uint64_t publishes() const noexcept { return publishes_; }
+    std::uint64_t published() const noexcept { return published_; }
+
+    /**
+     * @brief Pushes cut short by a full channel
+     */
+    std::uint64_t stalls() const noexcept { return stalls_; }
+
+    PartitionerType& partitioner() noexcept { return partitioner_; }
+
+private:
+    static constexpr std::size_t alignUp(const std::size_t bytes) noexcept {
+        return (bytes + 63) / 64 * 64;
+    }
+
+    RecordType* buffer(const std::size_t partition) noexcept {
+        return reinterpret_cast<RecordType*>(storage_.get() + partition * stride_);
+    }
+
+    bool stage(const std::uint32_t partition, const RecordType& record) noexcept {
+        assert(partition < channels_.size());
+
+        std::size_t& fill = fill_[partition];
+        if (fill == staging_) {
+            publish(partition);
+            if (fill == staging_) {
+                ++stalls_;
+                return false;
+            }
+        }
+
+        std::memcpy(buffer(partition) + fill, &record, sizeof(RecordType));
+        if (++fill == staging_) publish(partition);
+        return true;
+    }
+
+    /**
+     * Writes as many whole staged records as the channel has room for with one reserve and one publish;
+     * anything left moves to the front of the buffer
+     */
+    void publish(const std::size_t partition) noexcept {
+        const std::size_t staged = fill_[partition];
+        if (staged == 0) return;
+
+        ChannelType& channel = *channels_[partition];
+        const channels::WritableRegion region = channel.reserve(staged * sizeof(RecordType));
+        const std::size_t records = region.size() / sizeof(RecordType);
+        if (records == 0) return;
+
+        RecordType* const buffer = this->buffer(partition);
+        channels::copy_into(region, buffer, records * sizeof(RecordType));
+        channel.publish(records * sizeof(RecordType));
+
+        if (records != staged) {
+            std::memmove(buffer, buffer + records, (staged - records) * sizeof(RecordType));
+        }
+        fill_[partition] = staged - records;
+
+        ++publishes_;
+        published_ += records;
+    }
+
+    std::vector<ChannelType*> channels_;
+    PartitionerType partitioner_;
+    const std::size_t staging_;
+    const std::size_t stride_;
+    memory::PlacedBuffer storage_;
+    std::vector<std::size_t> fill_;
+
+    alignas(64) std::array<std::uint32_t, PARTITION_BATCH> partitions_;
+
+    std::uint64_t publishes_ = 0;
+    std::uint64_t published_ = 0;
+    std::uint64_t stalls_ = 0;
+};
+
+} // lute::tm::gates
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <columnar/Kernels.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace lute::tm::gates {
+
+/**
+ * Records a partitioner assigns per kernel call: keys and ids of one batch stay in L1
+ */
+inline constexpr std::size_t PARTITION_BATCH = 256;
+
+/**
+ * @concept Partitioner
+ * @brief Assigns each of \c count records a downstream partition in <tt>[0, partitions())</tt>
+ *
+ * Called once per batch rather than per record, so implementations can vectorize across records.
+ */
+template<typename P, typename RecordType>
+concept Partitioner = requires(P& partitioner, const RecordType* records, std::size_t count, std::uint32_t* partitions) {
+    { std::as_const(partitioner).partitions() } -> std::convertible_to<std::uint32_t>;
+    partitioner.assign(records, count, partitions);
+};
+
+/**
+ * @class HashPartitioner
+ * @brief Partitions by a hash of the record's key: equal keys always reach the same partition
+ *
+ * Keys of a batch are gathered into a column and hashed together by \ref columnar::hash_partition on the
+ * widest \ref columnar::SimdLevel the CPU has; the mapping is the same on every level.
+ *
+ * @tparam KeyOf callable as <tt>std::uint64_t(const RecordType&)</tt>
+ */
+template<typename KeyOf>
+class HashPartitioner {
+public:
+    explicit HashPartitioner(const std::uint32_t partitions, KeyOf keyOf = {},
+                             const columnar::Kernels& kernels = columnar::kernels()) noexcept
+        : keyOf_(std::move(keyOf)),
+          kernels_(&kernels),
+          partitions_(partitions)
+    {
+        assert(partitions != 0);
+    }
+
+    std::uint32_t partitions() const noexcept { return partitions_; }
+
+    template<typename RecordType>
+    void assign(const RecordType* const records, const std::size_t count, std::uint32_t* const partitions) noexcept {
+        for (std::size_t offset = 0; offset < count; offset += PARTITION_BATCH) {
+            const std::size_t n = std::min(PARTITION_BATCH, count - offset);
+            for (std::size_t i = 0; i < n; ++i) {
+                keys_[i] = static_cast<std::uint64_t>(keyOf_(records[offset + i]));
+            }
+            kernels_->hashPartition(keys_.data(), n, partitions_, partitions + offset);
+        }
+    }
+
+private:
+    alignas(columnar::COLUMN_ALIGNMENT) std::array<std::uint64_t, PARTITION_BATCH> keys_;
+    KeyOf keyOf_;
+    const columnar::Kernels* kernels_;
+    std::uint32_t partitions_;
+};
+
+/**
+ * @class RangePartitioner
+ * @brief Partitions by key range: partition \c i takes keys in <tt>[bounds[i - 1], bounds[i])</tt>
+ *
+ * \p bounds are the ascending lower bounds of partitions 1..n, so there is one more partition than bounds
+ * and keys below \c bounds[0] go to partition 0. Keeps downstream partitions ordered relative to each other,
+ * e.g. for a distributed sort.
+ *
+ * @tparam KeyOf callable as <tt>std::uint64_t(const RecordType&)</tt>
+ */
+template<typename KeyOf>
+class RangePartitioner {
+public:
+    explicit RangePartitioner(std::vector<std::uint64_t> bounds, KeyOf keyOf = {})
+        : bounds_(std::move(bounds)),
+          keyOf_(std::move(keyOf))
+    {
+        assert(std::is_sorted(bounds_.begin(), bounds_.end()));
+    }
+
+    std::uint32_t partitions() const noexcept { return static_cast<std::uint32_t>(bounds_.size() + 1); }
+
+    template<typename RecordType>
+    void assign(const RecordType* const records, const std::size_t count, std::uint32_t* const partitions) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto key = static_cast<std::uint64_t>(keyOf_(records[i]));
+            partitions[i] = static_cast<std::uint32_t>(std::upper_bound(bounds_.begin(), bounds_.end(), key) - bounds_.begin());
+        }
+    }
+
+private:
+    std::vector<std::uint64_t> bounds_;
+    KeyOf keyOf_;
+};
+
+/**
+ * @class RoundRobinPartitioner
+ * @brief Spreads records evenly regardless of content; for stateless operators that only need load balance
+ *
+ * Turns are taken per batch assigned, so records a full \ref OutputGate hands back do not get theirs again.
+ */
+class RoundRobinPartitioner {
+public:
+    explicit RoundRobinPartitioner(const std::uint32_t partitions) noexcept
+        : partitions_(partitions)
+    {
+        assert(partitions != 0);
+    }
+
+    std::uint32_t partitions() const noexcept { return partitions_; }
+
+    template<typename RecordType>
+    void assign(const RecordType* const, const std::size_t count, std::uint32_t* const partitions) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            partitions[i] = next_;
+            next_ = next_ + 1 == partitions_ ? 0 : next_ + 1;
+        }
+    }
+
+private:
+    std::uint32_t partitions_;
+    std::uint32_t next_ = 0;
+};
+
+} // lute::tm::gates
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace lute::tm::layout {
+
+/**
+ * Byte order of a field on the wire. Records are usually \c Little: every host this runs on today is
+ * little-endian, so reads compile to plain loads and only big-endian hosts pay for the swap.
+ */
+enum class ByteOrder : std::uint8_t {
+    Little,
+    Big,
+};
+
+inline constexpr ByteOrder HOST_ORDER = std::endian::native == std::endian::little ? ByteOrder::Little : ByteOrder::Big;
+
+static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big,
+              "Mixed-endian hosts are not supported");
+
+/**
+ * Types a field can hold: fixed-width integers, floating point and enums over those
+ */
+template<typename T>
+concept Scalar = (std::is_arithmetic_v<T> || std::is_enum_v<T>) && !std::is_same_v<T, bool>
+              && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template<std::unsigned_integral U>
+constexpr U byteswap(const U value) noexcept {
+    if constexpr (sizeof(U) == 1) return value;
+    else if constexpr (sizeof(U) == 2) return static_cast<U>(__builtin_bswap16(value));
+    else if constexpr (sizeof(U) == 4) return static_cast<U>(__builtin_bswap32(value));
+    else return static_cast<U>(__builtin_bswap64(value));
+}
+
+namespace detail {
+
+template<std::size_t Size> struct unsigned_of;
+template<> struct unsigned_of<1> { using type = std::uint8_t; };
+template<> struct unsigned_of<2> { using type = std::uint16_t; };
+template<> struct unsigned_of<4> { using type = std::uint32_t; };
+template<> struct unsigned_of<8> { using type = std::uint64_t; };
+
+} // namespace detail
+
+/**
+ * @brief Reads a \p T stored in \p Order at \p source, which need not be aligned
+ *
+ * memcpy keeps this free of aliasing and alignment UB; compilers turn it into a single load (plus a
+ * \c bswap when the orders differ).
+ */
+template<Scalar T, ByteOrder Order>
+T load(const std::byte* const source) noexcept {
+    using U = typename detail::unsigned_of<sizeof(T)>::type;
+
+    U raw;
+    std::memcpy(&raw, source, sizeof(raw));
+    if constexpr (Order != HOST_ORDER) raw = byteswap(raw);
+    return std::bit_cast<T>(raw);
+}
+
+template<Scalar T, ByteOrder Order>
+void store(std::byte* const target, const T value) noexcept {
+    using U = typename detail::unsigned_of<sizeof(T)>::type;
+
+    U raw = std::bit_cast<U>(value);
+    if constexpr (Order != HOST_ORDER) raw = byteswap(raw);
+    std::memcpy(target, &raw, sizeof(raw));
+}
+
+} // namespace lute::tm::layout
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <layout/Endian.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+namespace lute::tm::layout {
+
+/**
+ * @struct Field
+ * @brief Scalar field of a \ref RecordLayout, stored in \p Order and aligned to its size
+ */
+template<Scalar T, ByteOrder Order = ByteOrder::Little>
+struct Field {
+    using type = T;
+    static constexpr ByteOrder order = Order;
+    static constexpr std::size_t size = sizeof(T);
+    static constexpr std::size_t alignment = sizeof(T);
+};
+
+/**
+ * @struct Bytes
+ * @brief Fixed-size opaque field (symbols, ids, hashes), read in place as a span
+ */
+template<std::size_t N>
+struct Bytes {
+    static_assert(N != 0);
+    static constexpr std::size_t size = N;
+    static constexpr std::size_t alignment = 1;
+};
+
+namespace detail {
+
+template<typename F>
+struct is_bytes : std::false_type {};
+
+template<std::size_t N>
+struct is_bytes<Bytes<N>> : std::true_type {};
+
+constexpr std::size_t align_up(const std::size_t value, const std::size_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * Host-independent description of a field: what it is, how wide, in which order
+ */
+template<typename F>
+constexpr std::uint64_t field_code() noexcept {
+    if constexpr (is_bytes<F>::value) {
+        return 0x100 | (std::uint64_t{F::size} << 16);
+    } else {
+        using T = typename F::type;
+        using V = std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::type_identity<T>>::type;
+        const std::uint64_t kind = std::is_floating_point_v<V> ? 3 : std::is_signed_v<V> ? 2 : 1;
+        return kind | (std::uint64_t{F::size} << 16) | (std::uint64_t{F::order == ByteOrder::Big} << 32);
+    }
+}
+
+} // namespace detail
+
+/**
+ * @class RecordLayout
+ * @brief Wire layout of a fixed-size record, computed at compile time from its fields
+ *
+ * Fields are placed in declaration order, each at the next offset that is a multiple of its alignment, and
+ * the record is padded to the largest alignment. Nothing depends on the compiler's struct layout or the
+ * host's byte order, so a layout is identical on every architecture; \ref fingerprint captures it for
+ * checks across processes and builds. Appending fields never moves existing ones, which is what
+ * \ref Migration relies on.
+ *
+ * Read and write records through \ref RecordView and \ref RecordWriter, directly in channel or gate
+ * buffers.
+ */
+template<typename... Fields>
+class RecordLayout {
+    static_assert(sizeof...(Fields) != 0, "A record layout needs at least one field");
+
+    static constexpr std::array<std::size_t, sizeof...(Fields)> computeOffsets() noexcept {
+        std::array<std::size_t, sizeof...(Fields)> offsets{};
+        std::size_t next = 0;
+        std::size_t i = 0;
+        ((offsets[i++] = next = detail::align_up(next, Fields::alignment), next += Fields::size), ...);
+        return offsets;
+    }
+
+public:
+    static constexpr std::size_t fields = sizeof...(Fields);
+
+    template<std::size_t I>
+    using field = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    static constexpr std::array<std::size_t, fields> offsets = computeOffsets();
+
+    template<std::size_t I>
+    static constexpr std::size_t offset = offsets[I];
+
+    static constexpr std::size_t alignment = std::max({ Fields::alignment... });
+    static constexpr std::size_t size = detail::align_up(offsets.back() + field<fields - 1>::size, alignment);
+
+    /**
+     * FNV-1a over every field's kind, width, byte order and offset
+     */
+    static constexpr std::uint64_t fingerprint = []() {
+        constexpr std::array<std::uint64_t, fields> codes{ detail::field_code<Fields>()... };
+        std::uint64_t hash = 0xcbf29ce484222325;
+        for (std::size_t i = 0; i < fields; ++i) {
+            for (const std::uint64_t word : { codes[i], std::uint64_t{offsets[i]} }) {
+                for (unsigned shift = 0; shift < 64; shift += 8) {
+                    hash = (hash ^ ((word >> shift) & 0xff)) * 0x100000001b3;
+                }
+            }
+        }
+        return hash;
+    }();
+};
+
+/**
+ * @class RecordView
+ * @brief Read-only, in-place access to a record of \p Layout; no copy, no deserialization
+ */
+template<typename Layout>
+class RecordView {
+public:
+    explicit RecordView(const std::byte* const data) noexcept
+        : data_(data)
+    {}
+
+    explicit RecordView(const std::span<const std::byte> record) noexcept
+        : data_(record.data())
+    {
+        assert(record.size() >= Layout::size);
+    }
+
+    /**
+     * @return Field \p I's value, or for \ref Bytes fields a span over it
+     */
+    template<std::size_t I>
+    auto get() const noexcept {
+        using F = typename Layout::template field<I>;
+        const std::byte* const at = data_ + Layout::template offset<I>;
+
+        if constexpr (detail::is_bytes<F>::value) {
+            return std::span<const std::byte, F::size>(at, F::size);
+        } else {
+            return load<typename F::type, F::order>(at);
+        }
+    }
+
+    const std::byte* data() const noexcept { return data_; }
+    std::span<const std::byte, Layout::size> bytes() const noexcept { return std::span<const std::byte, Layout::size>(data_, Layout::size); }
+
+private:
+    const std::byte* data_;
+};
+
+/**
+ * @class RecordWriter
+ * @brief In-place writes to a record of \p Layout, e.g. straight into a channel's ring
+ */
+template<typename Layout>
+class RecordWriter {
+public:
+    explicit RecordWriter(std::byte* const data) noexcept
+        : data_(data)
+    {}
+
+    explicit RecordWriter(const std::span<std::byte> record) noexcept
+        : data_(record.data())
+    {
+        assert(record.size() >= Layout::size);
+    }
+
+    /**
+     * @brief Zeroes the whole record, padding included, so no stale bytes leave the process
+     */
+    RecordWriter& clear() noexcept {
+        std::memset(data_, 0, Layout::size);
+        return *this;
+    }
+
+    template<std::size_t I, typename V>
+        requires (!detail::is_bytes<typename Layout::template field<I>>::value)
+    RecordWriter& set(const V value) noexcept {
+        using F = typename Layout::template field<I>;
+        store<typename F::type, F::order>(data_ + Layout::template offset<I>, static_cast<typename F::type>(value));
+        return *this;
+    }
+
+    /**
+     * @brief Writable span over \ref Bytes field \p I
+     */
+    template<std::size_t I>
+        requires detail::is_bytes<typename Layout::template field<I>>::value
+    std::span<std::byte, Layout::template field<I>::size> bytes() noexcept {
+        return std::span<std::byte, Layout::template field<I>::size>(data_ + Layout::template offset<I>, Layout::template field<I>::size);
+    }
+
+    template<std::size_t I>
+    auto get() const noexcept { return view().template get<I>(); }
+
+    RecordView<Layout> view() const noexcept { return RecordView<Layout>(data_); }
+    std::byte* data() noexcept { return data_; }
+
+private:
+    std::byte* data_;
+};
+
+} // namespace lute::tm::layout
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <layout/RecordLayout.h>
+#include <channels/RecordFraming.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace lute::tm::layout {
+
+/**
+ * Every versioned record starts with this 8-byte header: schema id, schema version and body length, all
+ * little-endian. The body follows at offset 8, so a record framed on a channel (or stored in a gate slot)
+ * has its body 8-byte aligned.
+ */
+using RecordHeader = RecordLayout<Field<std::uint16_t>, Field<std::uint16_t>, Field<std::uint32_t>>;
+
+inline constexpr std::size_t HEADER_SCHEMA = 0;
+inline constexpr std::size_t HEADER_VERSION = 1;
+inline constexpr std::size_t HEADER_LENGTH = 2;
+
+inline constexpr std::size_t RECORD_ALIGNMENT = 8;
+
+static_assert(RecordHeader::size == RECORD_ALIGNMENT);
+static_assert(channels::FRAME_ALIGNMENT % RECORD_ALIGNMENT == 0, "Frame payloads must keep record bodies aligned");
+
+/**
+ * @struct Migration
+ * @brief Upgrades a record body from layout \p Old to the next version's layout \p New
+ *
+ * The default handles the usual evolution, appending fields: fields at the same index are copied (converted
+ * if the type widened or the byte order changed) and appended fields are zero. Specialise it for anything
+ * else, e.g. a field that was split or rescaled.
+ */
+template<typename Old, typename New>
+struct Migration {
+    static void apply(const RecordView<Old> from, RecordWriter<New> to) noexcept {
+        static_assert(Old::fields <= New::fields, "Removing fields needs a specialised Migration");
+
+        to.clear();
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (copy<I>(from, to), ...);
+        }(std::make_index_sequence<Old::fields>{});
+    }
+
+private:
+    template<std::size_t I>
+    static void copy(const RecordView<Old> from, RecordWriter<New>& to) noexcept {
+        using From = typename Old::template field<I>;
+        using To = typename New::template field<I>;
+
+        if constexpr (detail::is_bytes<From>::value || detail::is_bytes<To>::value) {
+            static_assert(std::is_same_v<From, To>, "Bytes fields must keep their size");
+            const auto source = from.template get<I>();
+            std::memcpy(to.template bytes<I>().data(), source.data(), source.size());
+        } else {
+            to.template set<I>(from.template get<I>());
+        }
+    }
+};
+
+/**
+ * @class Schema
+ * @brief Versions of one record type: \p Versions are the \ref RecordLayout of versions 1, 2, ...
+ *
+ * Writers always produce the newest version; \ref SchemaReader accepts all of them.
+ *
+ * @tparam Id Distinguishes record types sharing a channel; checked on every read
+ */
+template<std::uint16_t Id, typename... Versions>
+class Schema {
+    static_assert(sizeof...(Versions) != 0 && sizeof...(Versions) <= 0xffff);
+    static_assert(((Versions::alignment <= RECORD_ALIGNMENT) && ...), "Fields wider than 8 bytes are not supported");
+
+public:
+    static constexpr std::uint16_t id = Id;
+    static constexpr std::uint16_t version = sizeof...(Versions);
+
+    /**
+     * Layout of version \p V, numbered from 1
+     */
+    template<std::uint16_t V>
+        requires (V >= 1 && V <= sizeof...(Versions))
+    using layout = std::tuple_element_t<V - 1, std::tuple<Versions...>>;
+
+    using current = layout<version>;
+
+    /**
+     * Bytes of a current record, header included
+     */
+    static constexpr std::size_t recordBytes = RecordHeader::size + current::size;
+
+    /**
+     * Largest record of any version; what a gate slot must hold
+     */
+    static constexpr std::size_t maxRecordBytes = RecordHeader::size + std::max({ Versions::size... });
+
+    /**
+     * @brief Starts a current-version record at \p record (at least \ref recordBytes): writes the header
+     * and zeroes the body
+     */
+    static RecordWriter<current> initialize(std::byte* const record) noexcept {
+        RecordWriter<RecordHeader>(record)
+            .template set<HEADER_SCHEMA>(Id)
+            .template set<HEADER_VERSION>(version)
+            .template set<HEADER_LENGTH>(current::size);
+        return RecordWriter<current>(record + RecordHeader::size).clear();
+    }
+};
+
+/**
+ * @struct SchemaSlot
+ * @brief Gate record type holding one versioned record of \p SchemaType, of any version, in place
+ */
+template<typename SchemaType>
+struct alignas(RECORD_ALIGNMENT) SchemaSlot {
+    std::byte bytes[SchemaType::maxRecordBytes];
+
+    RecordWriter<typename SchemaType::current> initialize() noexcept { return SchemaType::initialize(bytes); }
+
+    /**
+     * @brief The record, header included, as far as its header says it goes
+     */
+    std::span<const std::byte> record() const noexcept {
+        const std::uint32_t length = RecordView<RecordHeader>(bytes).template get<HEADER_LENGTH>();
+        return { bytes, RecordHeader::size + std::min<std::size_t>(length, sizeof(bytes) - RecordHeader::size) };
+    }
+};
+
+/**
+ * @class SchemaReader
+ * @brief Boundary where records of \p SchemaType enter an operator: current records are read in place,
+ * older ones are upgraded on first read
+ *
+ * A record of the current version is returned as a view into the buffer it arrived in (a frame payload, a
+ * gate slot). A record of an older version is run through the \ref Migration chain into the reader's
+ * scratch record, and the view points there; it stays valid until the next \ref read. Upgrading costs
+ * nothing until an old record actually shows up, and nothing is ever upgraded ahead of time.
+ *
+ * @thread Operator Thread
+ */
+template<typename SchemaType>
+class SchemaReader {
+public:
+    using current = typename SchemaType::current;
+
+    /**
+     * @param record Header and body, e.g. a frame payload
+     * @return A view of the record as the current version, or nothing if the record is not of this schema,
+     *         is truncated, or comes from a newer version than this build knows
+     */
+    std::optional<RecordView<current>> read(const std::span<const std::byte> record) noexcept {
+        if (record.size() < RecordHeader::size) return reject();
+
+        const RecordView<RecordHeader> header(record.data());
+        const std::uint16_t version = header.template get<HEADER_VERSION>();
+        const std::uint32_t length = header.template get<HEADER_LENGTH>();
+
+        if (header.template get<HEADER_SCHEMA>() != SchemaType::id) return reject();
+        if (version == 0 || version > SchemaType::version) return reject();
+        if (length < LAYOUT_SIZES[version - 1] || length > record.size() - RecordHeader::size) return reject();
+
+        const std::byte* const body = record.data() + RecordHeader::size;
+        if (version == SchemaType::version) return RecordView<current>(body);
+
+        UPGRADES[version - 1](body, scratch_.data());
+        ++upgraded_;
+        return RecordView<current>(scratch_.data());
+    }
+
+    /**
+     * @brief Records that went through the migration chain
+     */
+    std::uint64_t upgraded() const noexcept { return upgraded_; }
+    std::uint64_t rejected() const noexcept { return rejected_; }
+
+private:
+    using Upgrade = void (*)(const std::byte*, std::byte*) noexcept;
+
+    static constexpr std::size_t SCRATCH_BYTES = std::max<std::size_t>(current::size, 1);
+
+    template<std::uint16_t V>
+    static void upgradeFrom(const std::byte* const from, std::byte* const to) noexcept {
+        using Old = typename SchemaType::template layout<V>;
+        if constexpr (V == SchemaType::version) {
+            std::memcpy(to, from, Old::size);
+        } else {
+            using New = typename SchemaType::template layout<V + 1>;
+            alignas(RECORD_ALIGNMENT) std::byte next[New::size];
+            Migration<Old, New>::apply(RecordView<Old>(from), RecordWriter<New>(next));
+            upgradeFrom<V + 1>(next, to);
+        }
+    }
+
+    static constexpr std::array<Upgrade, SchemaType::version> UPGRADES = []<std::size_t... I>(std::index_sequence<I...>) {
+        return std::array<Upgrade, SchemaType::version>{ &upgradeFrom<static_cast<std::uint16_t>(I + 1)>... };
+    }(std::make_index_sequence<SchemaType::version>{});
+
+    static constexpr std::array<std::size_t, SchemaType::version> LAYOUT_SIZES = []<std::size_t... I>(std::index_sequence<I...>) {
+        return std::array<std::size_t, SchemaType::version>{ SchemaType::template layout<static_cast<std::uint16_t>(I + 1)>::size... };
+    }(std::make_index_sequence<SchemaType::version>{});
+
+    std::optional<RecordView<current>> reject() noexcept {
+        ++rejected_;
+        return std::nullopt;
+    }
+
+    alignas(RECORD_ALIGNMENT) std::array<std::byte, SCRATCH_BYTES> scratch_{};
+    std::uint64_t upgraded_ = 0;
+    std::uint64_t rejected_ = 0;
+};
+
+} // namespace lute::tm::layout
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+namespace lute::tm::memory {
+
+/**
+ * @brief How pages of a placed buffer are bound to their NUMA node
+ */
+enum class NumaPolicy : std::uint8_t {
+    FirstTouch,     ///< No binding; pages are faulted in by the allocating thread, so allocate from the consumer
+    Preferred,      ///< mbind(MPOL_PREFERRED): the node is preferred, other nodes are used if it runs out
+    Bind,           ///< mbind(MPOL_BIND): pages must come from the node
+};
+
+/**
+ * @brief Whether a placed buffer should be backed by huge pages
+ */
+enum class HugePages : std::uint8_t {
+    Never,
+    IfAvailable,    ///< Explicit huge pages when the pool has room, else transparent huge pages, else 4K pages
+};
+
+/**
+ * @struct MemoryPlacement
+ * @brief Placement hint for channel and gate buffers, typically the NUMA node of the consumer thread
+ *
+ * A default-constructed placement means "wherever the allocator puts it" and keeps the plain heap path.
+ */
+struct MemoryPlacement {
+    static constexpr int ANY_NODE = -1;
+
+    int node = ANY_NODE;
+    NumaPolicy policy = NumaPolicy::Preferred;
+    HugePages hugePages = HugePages::Never;
+
+    bool isDefault() const noexcept {
+        return node == ANY_NODE && policy != NumaPolicy::FirstTouch && hugePages == HugePages::Never;
+    }
+};
+
+} // namespace lute::tm::memory
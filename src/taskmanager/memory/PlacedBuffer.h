@@ -0,0 +1,172 @@
+#pragma once
+
+#include <memory/MemoryPlacement.h>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace lute::tm::memory {
+
+/**
+ * @class PlacedBuffer
+ * @brief Owning, pre-faulted byte buffer placed according to a \ref MemoryPlacement
+ *
+ * Default placements use the aligned heap. Any other placement maps anonymous memory directly so that it
+ * can be bound to a node with \c mbind and backed by huge pages, then touches every page from the allocating
+ * thread. Pages are therefore resident before the data plane starts and the hot path never page-faults.
+ *
+ * Binding is best effort: on kernels or containers without NUMA support \c mbind fails and the buffer falls
+ * back to first-touch placement. \ref bound and \ref hugePages report what was actually obtained.
+ */
+class PlacedBuffer {
+public:
+    static constexpr std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    PlacedBuffer() noexcept = default;
+
+    PlacedBuffer(const std::size_t bytes, const MemoryPlacement placement = {}, const std::size_t alignment = 64)
+        : size_(bytes),
+          alignment_(alignment)
+    {
+        if (placement.isDefault()) {
+            data_ = static_cast<std::byte*>(::operator new(bytes, std::align_val_t{alignment}));
+            return;
+        }
+
+        map(placement);
+    }
+
+    PlacedBuffer(PlacedBuffer&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(other.size_),
+          alignment_(other.alignment_),
+          mapped_(std::exchange(other.mapped_, 0)),
+          bound_(other.bound_),
+          hugePages_(other.hugePages_)
+    {}
+
+    PlacedBuffer& operator=(PlacedBuffer&& other) noexcept {
+        if (this != &other) {
+            reset();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = other.size_;
+            alignment_ = other.alignment_;
+            mapped_ = std::exchange(other.mapped_, 0);
+            bound_ = other.bound_;
+            hugePages_ = other.hugePages_;
+        }
+        return *this;
+    }
+
+    PlacedBuffer(const PlacedBuffer&) = delete;
+    PlacedBuffer& operator=(const PlacedBuffer&) = delete;
+
+    ~PlacedBuffer() { reset(); }
+
+    std::byte* get() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+
+    /**
+     * @brief True if the pages were bound to the requested node with mbind
+     */
+    bool bound() const noexcept { return bound_; }
+
+    /**
+     * @brief True if the buffer is backed by explicit or transparent huge pages
+     */
+    bool hugePages() const noexcept { return hugePages_; }
+
+private:
+    // From <linux/mempolicy.h>; spelled out to avoid depending on libnuma headers
+    static constexpr int MPOL_PREFERRED_ = 1;
+    static constexpr int MPOL_BIND_ = 2;
+    static constexpr unsigned MPOL_MF_MOVE_ = 1U << 1;
+    static constexpr int MAX_NODES = 1024;
+
+    void map(const MemoryPlacement placement) {
+        const auto pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const bool wantHuge = placement.hugePages == HugePages::IfAvailable;
+
+        void* addr = MAP_FAILED;
+        if (wantHuge) {
+            mapped_ = round_up(size_, HUGE_PAGE_SIZE);
+            addr = ::mmap(nullptr, mapped_, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            hugePages_ = addr != MAP_FAILED;
+        }
+
+        if (addr == MAP_FAILED) {
+            mapped_ = round_up(size_, wantHuge ? HUGE_PAGE_SIZE : pageSize);
+            addr = ::mmap(nullptr, mapped_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (addr == MAP_FAILED) throw std::bad_alloc();
+
+            if (wantHuge) {
+                hugePages_ = ::madvise(addr, mapped_, MADV_HUGEPAGE) == 0;
+            }
+        }
+
+        data_ = static_cast<std::byte*>(addr);
+
+        if (placement.node != MemoryPlacement::ANY_NODE && placement.policy != NumaPolicy::FirstTouch) {
+            bound_ = bind(placement);
+        }
+
+        // Fault every page in now, from this thread: realises the binding (or first-touch placement)
+        // before the data plane starts
+        for (std::size_t offset = 0; offset < mapped_; offset += pageSize) {
+            data_[offset] = std::byte{0};
+        }
+    }
+
+    bool bind(const MemoryPlacement placement) const noexcept {
+        if (placement.node < 0 || placement.node >= MAX_NODES) return false;
+
+        unsigned long nodemask[MAX_NODES / (8 * sizeof(unsigned long))] = {};
+        const auto node = static_cast<std::size_t>(placement.node);
+        nodemask[node / (8 * sizeof(unsigned long))] |= 1UL << (node % (8 * sizeof(unsigned long)));
+
+        const int mode = placement.policy == NumaPolicy::Bind ? MPOL_BIND_ : MPOL_PREFERRED_;
+        return ::syscall(SYS_mbind, data_, mapped_, mode, nodemask, MAX_NODES + 1, MPOL_MF_MOVE_) == 0;
+    }
+
+    void reset() noexcept {
+        if (data_ == nullptr) return;
+
+        if (mapped_ != 0) {
+            ::munmap(data_, mapped_);
+        } else {
+            ::operator delete(data_, std::align_val_t{alignment_});
+        }
+        data_ = nullptr;
+    }
+
+    static constexpr std::size_t round_up(const std::size_t bytes, const std::size_t granularity) noexcept {
+        return (bytes + granularity - 1) / granularity * granularity;
+    }
+
+    std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t alignment_ = 64;
+    std::size_t mapped_ = 0;
+    bool bound_ = false;
+    bool hugePages_ = false;
+};
+
+/**
+ * @brief NUMA node the calling thread is currently running on, or \ref MemoryPlacement::ANY_NODE if unknown
+ */
+inline int current_node() noexcept {
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return MemoryPlacement::ANY_NODE;
+    return static_cast<int>(node);
+}
+
+} // namespace lute::tm::memory
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <metrics/Histogram.h>
+#include <metrics/LatencyStamps.h>
+
+#include <channels/Channel.h>
+#include <channels/ChannelConcept.h>
+#include <channels/RingRegion.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace lute::tm::metrics {
+
+/**
+ * @struct ChannelMetrics
+ * @brief Data-plane counters of one channel; producer and consumer fields sit on separate cache lines
+ */
+struct ChannelMetrics {
+    // ---- Producer ----
+    alignas(64) Counter bytesIn;
+    Counter publishes;
+    Counter fullStalls;             // reserve returned less than requested
+
+    // ---- Consumer ----
+    alignas(64) Counter bytesOut;
+    Counter releases;
+    Counter emptyStalls;            // peek found nothing
+    Histogram occupancy;            // readable bytes seen by peek, capped at the size asked for
+    Histogram latencyNs;            // publish → release, per published batch
+};
+
+/**
+ * @class MeteredChannel
+ * @brief Records \ref ChannelMetrics around any zero-copy channel; itself a zero-copy channel
+ *
+ * Wrap the channels of an edge whose metrics should be published; unmetered edges keep the bare channel
+ * and pay nothing. Framing, \ref channels::ChannelAdapter and operator tasks work on the wrapper unchanged.
+ * It does not own the channel or the metrics.
+ */
+template<channels::ZeroCopyChannel ChannelImpl>
+class MeteredChannel : public channels::Channel<MeteredChannel<ChannelImpl>> {
+public:
+    MeteredChannel(ChannelImpl& channel, ChannelMetrics& metrics) noexcept
+        : channel_(channel),
+          metrics_(metrics)
+    {}
+
+    std::size_t send(const void* data, std::size_t size) {
+        const channels::WritableRegion region = reserve(size);
+        const std::size_t to_write = region.size();
+
+        if (to_write == 0) return 0;
+
+        channels::copy_into(region, data, to_write);
+
+        publish(to_write);
+        return to_write;
+    }
+
+    std::size_t receive(void* data, std::size_t size) {
+        const channels::ReadableRegion region = peek(size);
+        const std::size_t to_read = region.size();
+
+        if (to_read == 0) return 0;
+
+        channels::copy_from(region, data, to_read);
+
+        release(to_read);
+        return to_read;
+    }
+
+    channels::WritableRegion reserve(std::size_t size) noexcept {
+        const channels::WritableRegion region = channel_.reserve(size);
+        if (region.size() < size) metrics_.fullStalls.add();
+        return region;
+    }
+
+    void publish(std::size_t size) noexcept {
+        // Stamped first: a consumer that releases the bytes as soon as they are visible must find the stamp
+        stamps_.push(published_ + size, now_ns());
+        channel_.publish(size);
+
+        published_ += size;
+        metrics_.bytesIn.add(size);
+        metrics_.publishes.add();
+    }
+
+    channels::ReadableRegion peek(std::size_t size = std::numeric_limits<std::size_t>::max()) noexcept {
+        const channels::ReadableRegion region = channel_.peek(size);
+        if (region.empty()) {
+            metrics_.emptyStalls.add();
+        } else {
+            metrics_.occupancy.record(region.size());
+        }
+        return region;
+    }
+
+    void release(std::size_t size) noexcept {
+        channel_.release(size);
+
+        released_ += size;
+        metrics_.bytesOut.add(size);
+        metrics_.releases.add();
+        stamps_.drain(released_, now_ns(), [this](const std::uint64_t ns) { metrics_.latencyNs.record(ns); });
+    }
+
+    std::size_t capacity() const noexcept { return channel_.capacity(); }
+
+    ChannelImpl& channel() noexcept { return channel_; }
+
+private:
+    ChannelImpl& channel_;
+    ChannelMetrics& metrics_;
+
+    LatencyStamps stamps_;
+
+    alignas(64) std::uint64_t published_ = 0;
+    alignas(64) std::uint64_t released_ = 0;
+};
+
+} // namespace lute::tm::metrics
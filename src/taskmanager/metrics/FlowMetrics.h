@@ -0,0 +1,27 @@
+#pragma once
+
+#include <metrics/Histogram.h>
+
+namespace lute::tm::metrics {
+
+/**
+ * @struct FlowMetrics
+ * @brief Credit flow-control counters of one edge; producer and consumer fields sit on separate cache lines
+ *
+ * A stall is an episode during which the producer had records to send but no credit; it ends with the next
+ * record that gets a credit. \c stallNs.sum() is the total time the edge spent backpressured.
+ */
+struct FlowMetrics {
+    // ---- Producer ----
+    alignas(64) Counter recordsSent;
+    Counter stalls;
+    Counter blocked;                // appends refused: Block policy, or a full spill buffer
+    Counter spilledRecords;
+    Counter shedRecords;            // dropped under the Shed policy
+    Histogram stallNs;
+
+    // ---- Consumer ----
+    alignas(64) Counter creditsGranted;
+};
+
+} // namespace lute::tm::metrics
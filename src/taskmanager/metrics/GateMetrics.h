@@ -0,0 +1,135 @@
+#pragma once
+
+#include <metrics/Histogram.h>
+#include <metrics/LatencyStamps.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace lute::tm::metrics {
+
+/**
+ * @struct GateMetrics
+ * @brief Data-plane counters of one InputGate; producer and operator fields sit on separate cache lines
+ */
+struct GateMetrics {
+    // ---- InputGate thread ----
+    alignas(64) Counter recordsIn;
+    Counter pushes;
+    Counter fullStalls;             // emplace/push could not place every record
+
+    // ---- Operator thread ----
+    alignas(64) Counter recordsOut;
+    Counter commits;
+    Counter emptyStalls;            // fetch returned no records
+    Histogram occupancy;            // records pending at fetch
+    Histogram latencyNs;            // push → commit, per pushed batch
+};
+
+/**
+ * @class MeteredInputGate
+ * @brief Records \ref GateMetrics around an InputGate; exposes the same producer and operator API
+ *
+ * Does not own the gate or the metrics.
+ */
+template<typename Gate>
+class MeteredInputGate {
+public:
+    using record_type = typename Gate::record_type;
+    using RecordBatch = typename Gate::RecordBatch;
+
+    MeteredInputGate(Gate& gate, GateMetrics& metrics) noexcept
+        : gate_(gate),
+          metrics_(metrics)
+    {}
+
+    template<typename... Args>
+    bool emplace(Args&&... args) noexcept(noexcept(std::declval<Gate&>().emplace(std::forward<Args>(args)...))) {
+        stamp(1);         // already at the only record it can be trimmed to
+        const bool accepted = gate_.emplace(std::forward<Args>(args)...);
+        if (accepted) {
+            published(1);
+        } else {
+            metrics_.fullStalls.add();
+        }
+        return accepted;
+    }
+
+    std::size_t push(const record_type* const records, const std::size_t count)
+        noexcept(noexcept(std::declval<Gate&>().push(records, count))) {
+        const bool stamped = stamp(count);
+        const std::size_t accepted = gate_.push(records, count);
+        if (accepted < count) {
+            metrics_.fullStalls.add();
+            if (stamped) trim(accepted);
+        }
+        if (accepted != 0) published(accepted);
+        return accepted;
+    }
+
+    RecordBatch fetch(const std::size_t maxRecords = 1U) noexcept {
+        const RecordBatch batch = gate_.fetch(maxRecords);
+        if (batch.recordCount == 0) {
+            metrics_.emptyStalls.add();
+        } else {
+            metrics_.occupancy.record(gate_.pending());
+        }
+        return batch;
+    }
+
+    void commit(const std::size_t commitSize = 1U) noexcept {
+        gate_.commit(commitSize);
+
+        committed_ += commitSize;
+        metrics_.recordsOut.add(commitSize);
+        metrics_.commits.add();
+        stamps_.drain(committed_, now_ns(), [this](const std::uint64_t ns) { metrics_.latencyNs.record(ns); });
+    }
+
+    std::size_t service() noexcept { return gate_.service(); }
+    std::size_t capacity() const noexcept { return gate_.capacity(); }
+
+    Gate& gate() noexcept { return gate_; }
+
+private:
+    /**
+     * Stamps the end of a push of \p count records before the gate makes them visible, so an operator that
+     * commits them at once finds the stamp. A retry of records the gate turned away is not stamped again:
+     * they keep the time of their first offer, stall included.
+     */
+    bool stamp(const std::size_t count) noexcept {
+        const std::uint64_t position = pushed_ + count;
+        if (position <= stamped_ || !stamps_.push(position, now_ns())) return false;
+
+        stamped_ = position;
+        return true;
+    }
+
+    /**
+     * The gate took only \p accepted records of the stamped push; the stamp moves to the last of them, or to
+     * the first record still to come if it took none
+     */
+    void trim(const std::size_t accepted) noexcept {
+        stamped_ = pushed_ + std::max<std::size_t>(accepted, 1);
+        stamps_.trim(stamped_);
+    }
+
+    void published(const std::size_t count) noexcept {
+        pushed_ += count;
+        metrics_.recordsIn.add(count);
+        metrics_.pushes.add();
+    }
+
+    Gate& gate_;
+    GateMetrics& metrics_;
+
+    LatencyStamps stamps_;
+
+    alignas(64) std::uint64_t pushed_ = 0;
+    std::uint64_t stamped_ = 0;
+    alignas(64) std::uint64_t committed_ = 0;
+};
+
+} // namespace lute::tm::metrics
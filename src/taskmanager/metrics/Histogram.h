@@ -0,0 +1,167 @@
+#pragma once
+
+#include <counter.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lute::tm::metrics {
+
+/**
+ * @class Counter
+ * @brief Monotonic counter with a single writer; any thread may read it
+ *
+ * The writer uses a plain load + store instead of a locked read-modify-write.
+ */
+class Counter {
+public:
+    void add(const std::uint64_t n = 1) noexcept {
+        core::bump(value_, n);
+    }
+
+    std::uint64_t load() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::uint64_t> value_{0};
+};
+
+/**
+ * @class HistogramSnapshot
+ * @brief Plain copy of a \ref Histogram; subtract two snapshots to get the distribution of an interval
+ */
+class HistogramSnapshot {
+public:
+    HistogramSnapshot() = default;
+    HistogramSnapshot(std::vector<std::uint64_t> counts, const std::uint64_t sum, const std::uint64_t max)
+        : counts_(std::move(counts)),
+          sum_(sum),
+          max_(max)
+    {
+        for (const std::uint64_t c : counts_) count_ += c;
+    }
+
+    std::uint64_t count() const noexcept { return count_; }
+    std::uint64_t sum() const noexcept { return sum_; }
+
+    /**
+     * @brief Largest value recorded since the histogram was created (not per interval)
+     */
+    std::uint64_t max() const noexcept { return max_; }
+
+    double mean() const noexcept {
+        return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_);
+    }
+
+    /**
+     * @param quantile In [0, 1], e.g. 0.999
+     * @return Upper bound of the bucket holding the quantile, so the error is at most one bucket width
+     */
+    std::uint64_t percentile(double quantile) const noexcept;
+
+    HistogramSnapshot operator-(const HistogramSnapshot& earlier) const {
+        std::vector<std::uint64_t> counts(counts_);
+        for (std::size_t i = 0; i < std::min(counts.size(), earlier.counts_.size()); ++i) {
+            counts[i] -= earlier.counts_[i];
+        }
+        return { std::move(counts), sum_ - earlier.sum_, max_ };
+    }
+
+private:
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t count_ = 0;
+    std::uint64_t sum_ = 0;
+    std::uint64_t max_ = 0;
+};
+
+/**
+ * @class Histogram
+ * @brief Log-linear (HDR-style) histogram of non-negative integers with a single writer
+ *
+ * Values below \c 2^SUB_BUCKET_BITS are counted exactly; above that every power of two is split into
+ * \c 2^SUB_BUCKET_BITS buckets, giving a relative error under 1 / 2^SUB_BUCKET_BITS (about 3%).
+ * Values beyond \c 2^MAX_EXPONENT land in the last bucket.
+ *
+ * \ref record is a bucket lookup (one \c lzcnt) and three relaxed single-writer stores. Readers copy the
+ * buckets with \ref snapshot at any time without stopping the writer; a snapshot may miss records that
+ * land while it is taken, but never sees a count go backwards.
+ */
+class Histogram {
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 5;
+    static constexpr unsigned MAX_EXPONENT = 40;        // 2^40 ns is about 18 minutes
+    static constexpr std::size_t SUB_BUCKETS = std::size_t{1} << SUB_BUCKET_BITS;
+    static constexpr std::size_t BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + SUB_BUCKETS;
+
+    static constexpr std::size_t bucket_of(std::uint64_t value) noexcept {
+        value = std::min<std::uint64_t>(value, (std::uint64_t{1} << (MAX_EXPONENT + 1)) - 1);
+        if (value < SUB_BUCKETS) return static_cast<std::size_t>(value);
+
+        const unsigned exponent = static_cast<unsigned>(std::bit_width(value)) - 1;
+        const std::size_t sub = static_cast<std::size_t>(value >> (exponent - SUB_BUCKET_BITS)) - SUB_BUCKETS;
+        return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+    }
+
+    /**
+     * @return Smallest value that maps to \p bucket
+     */
+    static constexpr std::uint64_t lower_bound(const std::size_t bucket) noexcept {
+        if (bucket < SUB_BUCKETS) return bucket;
+
+        const unsigned exponent = static_cast<unsigned>(bucket / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+        const std::uint64_t sub = bucket % SUB_BUCKETS;
+        return (SUB_BUCKETS + sub) << (exponent - SUB_BUCKET_BITS);
+    }
+
+    /**
+     * @return Largest value that maps to \p bucket
+     */
+    static constexpr std::uint64_t upper_bound(const std::size_t bucket) noexcept {
+        return bucket + 1 < BUCKETS ? lower_bound(bucket + 1) - 1 : lower_bound(bucket);
+    }
+
+    /**
+     * @thread Single writer
+     */
+    void record(const std::uint64_t value) noexcept {
+        core::bump(counts_[bucket_of(value)]);
+        core::bump(sum_, value);
+        if (value > max_.load(std::memory_order_relaxed)) max_.store(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @thread Any
+     */
+    HistogramSnapshot snapshot() const {
+        std::vector<std::uint64_t> counts(BUCKETS);
+        for (std::size_t i = 0; i < BUCKETS; ++i) {
+            counts[i] = counts_[i].load(std::memory_order_relaxed);
+        }
+        return { std::move(counts), sum_.load(std::memory_order_relaxed), max_.load(std::memory_order_relaxed) };
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, BUCKETS> counts_{};
+    std::atomic<std::uint64_t> sum_{0};
+    std::atomic<std::uint64_t> max_{0};
+};
+
+static_assert(Histogram::bucket_of(Histogram::lower_bound(Histogram::BUCKETS - 1)) == Histogram::BUCKETS - 1);
+
+inline std::uint64_t HistogramSnapshot::percentile(const double quantile) const noexcept {
+    if (count_ == 0) return 0;
+
+    const auto rank = static_cast<std::uint64_t>(quantile * static_cast<double>(count_ - 1)) + 1;
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < counts_.size(); ++i) {
+        seen += counts_[i];
+        if (seen >= rank) return std::min(Histogram::upper_bound(i), max_);
+    }
+    return max_;
+}
+
+} // namespace lute::tm::metrics
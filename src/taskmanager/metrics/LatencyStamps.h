@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace lute::tm::metrics {
+
+inline std::uint64_t now_ns() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @class LatencyStamps
+ * @brief SPSC queue of (stream position, publish time) pairs used to measure enqueue→dequeue latency
+ * without touching the payload
+ *
+ * The producer stamps the stream position at which a publish will end, before making it visible: once the
+ * consumer has released past that position, the batch has been dequeued and the stamp yields its latency.
+ * Stamping after the publish would let a fast consumer release past it first, and the stamp would then wait
+ * for the next release, adding the consumer's idle time. When the queue is full the producer skips the
+ * stamp, so under overload latency is sampled rather than blocking the producer.
+ */
+class LatencyStamps {
+public:
+    static constexpr std::size_t SLOTS = 256;
+
+    /**
+     * @thread Producer
+     */
+    bool push(const std::uint64_t position, const std::uint64_t timeNs) noexcept {
+        const std::size_t t = tail_.load(std::memory_order_relaxed);
+        if (t - head_.load(std::memory_order_acquire) == SLOTS) return false;
+
+        stamps_[t % SLOTS].position.store(position, std::memory_order_relaxed);
+        stamps_[t % SLOTS].timeNs = timeNs;
+        tail_.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Moves the newest stamp back to \p position, for a publish that took less than it was stamped for
+     *
+     * Only for the stamp the last \ref push queued. The consumer cannot have released up to the old position,
+     * so whichever of the two it reads, the stamp is still waiting.
+     *
+     * @thread Producer
+     */
+    void trim(const std::uint64_t position) noexcept {
+        const std::size_t t = tail_.load(std::memory_order_relaxed);
+        stamps_[(t - 1) % SLOTS].position.store(position, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Calls \p onDequeued with the latency of every stamp at or before \p position
+     *
+     * @thread Consumer
+     */
+    template<typename OnDequeued>
+    void drain(const std::uint64_t position, const std::uint64_t nowNs, OnDequeued&& onDequeued) noexcept {
+        std::size_t h = head_.load(std::memory_order_relaxed);
+        const std::size_t t = tail_.load(std::memory_order_acquire);
+
+        while (h != t && stamps_[h % SLOTS].position.load(std::memory_order_relaxed) <= position) {
+            const std::uint64_t stamped = stamps_[h % SLOTS].timeNs;
+            onDequeued(nowNs > stamped ? nowNs - stamped : 0);
+            ++h;
+        }
+        head_.store(h, std::memory_order_release);
+    }
+
+private:
+    struct Stamp {
+        std::atomic<std::uint64_t> position;        // atomic only for trim
+        std::uint64_t timeNs;
+    };
+
+    std::array<Stamp, SLOTS> stamps_{};
+
+    alignas(64) std::atomic<std::size_t> tail_{0};
+    alignas(64) std::atomic<std::size_t> head_{0};
+};
+
+} // namespace lute::tm::metrics
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <replay/ReplayLog.h>
+#include <channels/RecordFraming.h>
+#include <checkpoint/Barrier.h>
+#include <watermarks/Watermark.h>
+
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lute::tm::replay {
+
+/**
+ * @class Recorder
+ * @brief Logs what one operator consumes, in the order it consumed it, for \ref Replayer to reproduce
+ *
+ * Events are encoded into a buffer owned by the operator thread; every \c chunkBytes the buffer is handed to
+ * \c sink (in the runtime, a queue drained by the replay log writer thread), so the data plane never waits
+ * on the file. \ref tick records how much wall-clock time passed, at most once per \c tickResolution, which
+ * is what lets a replay report where the recorded run spent its time without waiting for it.
+ *
+ * @tparam Clock \c now() returning a \c std::chrono::time_point
+ *
+ * @thread Operator Thread
+ */
+template<typename Clock = std::chrono::steady_clock>
+class Recorder {
+public:
+    using Sink = std::function<void(std::vector<std::byte>&&)>;
+
+    static constexpr std::size_t DEFAULT_CHUNK_BYTES = 64 * 1024;
+
+    explicit Recorder(Sink sink, const std::size_t chunkBytes = DEFAULT_CHUNK_BYTES,
+                      const std::chrono::nanoseconds tickResolution = std::chrono::microseconds(1))
+        : sink_(std::move(sink)),
+          chunkBytes_(chunkBytes),
+          tickResolution_(tickResolution),
+          lastTick_(Clock::now())
+    {
+        encoder_.reserve(chunkBytes_ + chunkBytes_ / 4);
+    }
+
+    /**
+     * @brief Records the time elapsed since the previous tick, if it is at least the tick resolution
+     *
+     * Call it once per batch rather than per record.
+     */
+    void tick() {
+        const auto now = Clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - lastTick_);
+        if (elapsed < tickResolution_) return;
+
+        encoder_.tick(static_cast<std::uint64_t>(elapsed.count()));
+        lastTick_ = now;
+        ++ticks_;
+    }
+
+    void record(const std::uint32_t input, const std::span<const std::byte> payload) {
+        encoder_.record(input, payload);
+        appended();
+    }
+
+    void timedRecord(const std::uint32_t input, const std::uint64_t eventTime, const std::span<const std::byte> payload) {
+        encoder_.timedRecord(input, eventTime, payload);
+        appended();
+    }
+
+    void watermark(const std::uint32_t input, const watermarks::EventTime watermark) {
+        encoder_.watermark(input, watermark);
+        appended();
+    }
+
+    void barrier(const std::uint32_t input, const checkpoint::CheckpointId checkpoint) {
+        encoder_.barrier(input, checkpoint);
+        appended();
+    }
+
+    /**
+     * @brief Records a frame consumed from a framed channel; padding is not part of the input
+     */
+    void frame(const std::uint32_t input, const channels::Frame& frame) {
+        switch (frame.kind) {
+            case channels::FrameKind::Record:
+                record(input, frame.payload);
+                break;
+            case channels::FrameKind::Watermark:
+                if (const auto value = watermarks::watermark_of(frame)) watermark(input, *value);
+                break;
+            case channels::FrameKind::Barrier:
+                if (const auto value = checkpoint::barrier_of(frame)) barrier(input, *value);
+                break;
+            case channels::FrameKind::Padding:
+                break;
+        }
+    }
+
+    /**
+     * @brief Hands whatever is buffered to the sink, e.g. before shutdown
+     */
+    void flush() {
+        if (encoder_.size() != 0) sink_(encoder_.take());
+    }
+
+    std::uint64_t events() const noexcept { return events_; }
+    std::uint64_t ticks() const noexcept { return ticks_; }
+
+private:
+    void appended() {
+        ++events_;
+        if (encoder_.size() >= chunkBytes_) sink_(encoder_.take());
+    }
+
+    Sink sink_;
+    const std::size_t chunkBytes_;
+    const std::chrono::nanoseconds tickResolution_;
+
+    ReplayEncoder encoder_;
+    typename Clock::time_point lastTick_;
+    std::uint64_t events_ = 0;
+    std::uint64_t ticks_ = 0;
+};
+
+template<typename T>
+struct is_element : std::false_type {};
+
+template<typename T>
+struct is_element<watermarks::Element<T>> : std::true_type {};
+
+/**
+ * @class RecordingGate
+ * @brief Gate in front of an \ref gates::InputGate that records every record the operator commits
+ *
+ * Has the gate's \c fetch / \c commit interface, so operator tasks run on it unchanged. Records are logged at
+ * \c commit: what the operator fetched but did not commit is fetched again and would otherwise appear twice.
+ * \ref watermarks::Element records are logged as timed records, watermarks and barriers; any other record
+ * type is logged as its bytes.
+ *
+ * @thread Operator Thread
+ */
+template<typename Gate, typename Clock = std::chrono::steady_clock>
+class RecordingGate {
+public:
+    using record_type = typename Gate::record_type;
+    using RecordBatch = typename Gate::RecordBatch;
+
+    static_assert(is_element<record_type>::value || std::is_trivially_copyable_v<record_type>,
+                  "Recorded records are logged as their bytes");
+
+    RecordingGate(Gate& gate, Recorder<Clock>& recorder, const std::uint32_t input) noexcept
+        : gate_(gate),
+          recorder_(recorder),
+          input_(input)
+    {}
+
+    RecordBatch fetch(const std::size_t maxRecords = 1U) noexcept {
+        batch_ = gate_.fetch(maxRecords);
+        return batch_;
+    }
+
+    void commit(const std::size_t commitSize = 1U) {
+        assert(commitSize <= batch_.recordCount);
+
+        if (commitSize != 0) recorder_.tick();
+        for (std::size_t i = 0; i < commitSize; ++i) log(batch_.data[i]);
+
+        gate_.commit(commitSize);
+        batch_.data += commitSize;
+        batch_.recordCount -= commitSize;
+    }
+
+    std::size_t pending() const noexcept { return gate_.pending(); }
+    std::size_t capacity() const noexcept { return gate_.capacity(); }
+
+private:
+    void log(const record_type& record) {
+        if constexpr (is_element<record_type>::value) {
+            static_assert(std::is_trivially_copyable_v<decltype(record.value)>, "Recorded values are logged as their bytes");
+            switch (record.kind) {
+                case watermarks::ElementKind::Record:
+                    recorder_.timedRecord(input_, record.timestamp, std::as_bytes(std::span(&record.value, 1)));
+                    break;
+                case watermarks::ElementKind::Watermark:
+                    recorder_.watermark(input_, record.timestamp);
+                    break;
+                case watermarks::ElementKind::Barrier:
+                    recorder_.barrier(input_, record.timestamp);
+                    break;
+            }
+        } else {
+            recorder_.record(input_, std::as_bytes(std::span(&record, 1)));
+        }
+    }
+
+    Gate& gate_;
+    Recorder<Clock>& recorder_;
+    const std::uint32_t input_;
+    RecordBatch batch_{ nullptr, 0 };
+};
+
+} // namespace lute::tm::replay
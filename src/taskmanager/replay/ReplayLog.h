@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace lute::tm::replay {
+
+/**
+ * Events of a replay stream, in the order one operator consumed them
+ */
+enum class EventKind : std::uint8_t {
+    Record = 0,         // payload of a framed record
+    TimedRecord = 1,    // event time + value of a gate \ref watermarks::Element
+    Watermark = 2,
+    Barrier = 3,
+    Tick = 4,           // wall-clock nanoseconds since the previous tick; not tied to an input
+};
+
+/**
+ * @struct ReplayEvent
+ * @brief One decoded event; \c payload points into the stream it was read from
+ */
+struct ReplayEvent {
+    EventKind kind;
+    std::uint32_t input;            // operator input (gate or channel index) the event arrived on
+    std::uint64_t value;            // event time, watermark, checkpoint id or tick nanoseconds
+    std::span<const std::byte> payload;
+};
+
+/**
+ * Encoding: one tag byte (kind in the low 3 bits, input in the high 5; input 31 means a varint input
+ * follows), then LEB128 varints for \c value and, for records, the payload length followed by the payload.
+ * A record of a small struct arriving on one of the first 31 inputs costs 2-3 bytes on top of its payload.
+ */
+inline constexpr std::uint32_t INLINE_INPUTS = 31;
+
+/**
+ * @class ReplayEncoder
+ * @brief Appends events to a growable byte buffer
+ *
+ * @thread Operator Thread
+ */
+class ReplayEncoder {
+public:
+    void record(const std::uint32_t input, const std::span<const std::byte> payload) {
+        tag(EventKind::Record, input);
+        bytes(payload);
+    }
+
+    void timedRecord(const std::uint32_t input, const std::uint64_t eventTime, const std::span<const std::byte> payload) {
+        tag(EventKind::TimedRecord, input);
+        varint(eventTime);
+        bytes(payload);
+    }
+
+    void watermark(const std::uint32_t input, const std::uint64_t watermark) {
+        tag(EventKind::Watermark, input);
+        varint(watermark);
+    }
+
+    void barrier(const std::uint32_t input, const std::uint64_t checkpoint) {
+        tag(EventKind::Barrier, input);
+        varint(checkpoint);
+    }
+
+    void tick(const std::uint64_t nanoseconds) {
+        tag(EventKind::Tick, 0);
+        varint(nanoseconds);
+    }
+
+    std::size_t size() const noexcept { return buffer_.size(); }
+    std::span<const std::byte> encoded() const noexcept { return buffer_; }
+
+    /**
+     * @brief Hands over what was encoded and starts a new buffer of the same capacity
+     */
+    std::vector<std::byte> take() {
+        std::vector<std::byte> next;
+        next.reserve(buffer_.capacity());
+        next.swap(buffer_);
+        return next;
+    }
+
+    void reserve(const std::size_t bytes) { buffer_.reserve(bytes); }
+
+private:
+    void tag(const EventKind kind, const std::uint32_t input) {
+        const std::uint32_t inlined = input < INLINE_INPUTS ? input : INLINE_INPUTS;
+        buffer_.push_back(static_cast<std::byte>(static_cast<std::uint32_t>(kind) | (inlined << 3)));
+        if (inlined == INLINE_INPUTS) varint(input);
+    }
+
+    void varint(std::uint64_t value) {
+        while (value >= 0x80) {
+            buffer_.push_back(static_cast<std::byte>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        buffer_.push_back(static_cast<std::byte>(value));
+    }
+
+    void bytes(const std::span<const std::byte> payload) {
+        varint(payload.size());
+        buffer_.insert(buffer_.end(), payload.begin(), payload.end());
+    }
+
+    std::vector<std::byte> buffer_;
+};
+
+/**
+ * @class ReplayDecoder
+ * @brief Reads the events of one stream back, in order
+ */
+class ReplayDecoder {
+public:
+    explicit ReplayDecoder(const std::span<const std::byte> stream) noexcept
+        : stream_(stream)
+    {}
+
+    /**
+     * @return The next event, or nothing at the end of the stream
+     * @throw std::runtime_error if the stream is truncated or holds an unknown event
+     */
+    std::optional<ReplayEvent> next() {
+        if (offset_ == stream_.size()) return std::nullopt;
+
+        const auto tag = static_cast<std::uint8_t>(stream_[offset_++]);
+        const auto kind = static_cast<EventKind>(tag & 0x7);
+        if (kind > EventKind::Tick) throw std::runtime_error("replay stream: unknown event kind");
+
+        ReplayEvent event{ kind, static_cast<std::uint32_t>(tag >> 3), 0, {} };
+        if (event.input == INLINE_INPUTS) event.input = static_cast<std::uint32_t>(varint());
+
+        switch (kind) {
+            case EventKind::Record:
+                event.payload = bytes();
+                break;
+            case EventKind::TimedRecord:
+                event.value = varint();
+                event.payload = bytes();
+                break;
+            case EventKind::Watermark:
+            case EventKind::Barrier:
+            case EventKind::Tick:
+                event.value = varint();
+                break;
+        }
+        return event;
+    }
+
+    bool done() const noexcept { return offset_ == stream_.size(); }
+
+private:
+    std::uint64_t varint() {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (offset_ == stream_.size()) throw std::runtime_error("replay stream: truncated event");
+
+            const auto byte = static_cast<std::uint8_t>(stream_[offset_++]);
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+        throw std::runtime_error("replay stream: varint too long");
+    }
+
+    std::span<const std::byte> bytes() {
+        const std::uint64_t length = varint();
+        if (length > stream_.size() - offset_) throw std::runtime_error("replay stream: truncated payload");
+
+        const auto payload = stream_.subspan(offset_, static_cast<std::size_t>(length));
+        offset_ += static_cast<std::size_t>(length);
+        return payload;
+    }
+
+    std::span<const std::byte> stream_;
+    std::size_t offset_ = 0;
+};
+
+} // namespace lute::tm::replay
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <replay/ReplayLog.h>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace lute::tm::replay {
+
+/**
+ * @class Replayer
+ * @brief Feeds a recorded stream back to an operator, as fast as it can take it
+ *
+ * Events are delivered in exactly the order the recorded operator consumed them, across all of its inputs,
+ * so the operator sees the same interleaving and produces the same output. Ticks are never waited for; they
+ * advance \ref recordedNanos, the wall-clock time the recorded run had reached, which operators and
+ * benchmarks can use in place of the clock.
+ *
+ * @thread Operator Thread
+ */
+class Replayer {
+public:
+    explicit Replayer(const std::span<const std::byte> stream) noexcept
+        : decoder_(stream)
+    {}
+
+    /**
+     * @brief Delivers up to \p maxEvents events
+     *
+     * @param onRecord <tt>bool(std::size_t input, std::uint64_t eventTime, std::span<const std::byte>)</tt>;
+     *        \c eventTime is 0 for framed records. Returning false stops before that record, which is
+     *        delivered again by the next poll.
+     * @param onWatermark <tt>void(std::size_t input, std::uint64_t watermark)</tt>
+     * @param onBarrier <tt>void(std::size_t input, std::uint64_t checkpoint)</tt>
+     *
+     * @return Events delivered; ticks are not counted
+     * @throw std::runtime_error if the stream is corrupt
+     */
+    template<typename OnRecord, typename OnWatermark, typename OnBarrier>
+        requires std::predicate<OnRecord&, std::size_t, std::uint64_t, std::span<const std::byte>>
+    std::size_t poll(OnRecord&& onRecord, OnWatermark&& onWatermark, OnBarrier&& onBarrier,
+                     const std::size_t maxEvents = std::numeric_limits<std::size_t>::max()) {
+        std::size_t delivered = 0;
+        while (delivered < maxEvents) {
+            if (!held_) {
+                const auto event = decoder_.next();
+                if (!event) break;
+                event_ = *event;
+            }
+            held_ = false;
+
+            switch (event_.kind) {
+                case EventKind::Record:
+                case EventKind::TimedRecord:
+                    if (!onRecord(std::size_t{event_.input}, event_.value, event_.payload)) {
+                        held_ = true;
+                        return delivered;
+                    }
+                    ++records_;
+                    break;
+                case EventKind::Watermark:
+                    onWatermark(std::size_t{event_.input}, event_.value);
+                    break;
+                case EventKind::Barrier:
+                    onBarrier(std::size_t{event_.input}, event_.value);
+                    break;
+                case EventKind::Tick:
+                    recordedNanos_ += event_.value;
+                    continue;
+            }
+            ++delivered;
+        }
+        return delivered;
+    }
+
+    bool done() const noexcept { return !held_ && decoder_.done(); }
+
+    /**
+     * @brief Wall-clock nanoseconds the recorded run had spent when it consumed the last delivered event
+     */
+    std::uint64_t recordedNanos() const noexcept { return recordedNanos_; }
+
+    std::uint64_t records() const noexcept { return records_; }
+
+private:
+    ReplayDecoder decoder_;
+    ReplayEvent event_{};
+    bool held_ = false;
+
+    std::uint64_t recordedNanos_ = 0;
+    std::uint64_t records_ = 0;
+};
+
+} // namespace lute::tm::replay
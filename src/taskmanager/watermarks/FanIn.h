@@ -0,0 +1,217 @@
+#pragma once
+
+#include <checkpoint/Barrier.h>
+#include <channels/ChannelConcept.h>
+#include <channels/RecordFraming.h>
+#include <watermarks/Watermark.h>
+#include <watermarks/WatermarkMerger.h>
+
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace lute::tm::watermarks {
+
+/**
+ * @class FramedFanIn
+ * @brief Operator side of a fan-in over framed channels: records out, watermark frames merged, checkpoint
+ * barriers aligned
+ *
+ * Each \ref poll takes one batch from every input in turn. Record frames go to the operator; watermark frames
+ * are only \ref WatermarkMerger::observe "observed". After the round the merger is settled once, and the
+ * operator hears about the combined watermark only if it advanced, so watermark handling costs one
+ * tree update per input and round, not one per frame. Every record that preceded a watermark frame on
+ * its input has been handed over before the combined watermark it contributes to is reported.
+ *
+ * A barrier frame ends its input's batch, and the input is skipped until the barrier has arrived on every
+ * open input (see \ref checkpoint::BarrierAligner). The barrier that completes the alignment first settles
+ * the watermarks observed so far, then calls the barrier handler: at that point every record before the
+ * barrier, and none after it, has been handed over, so the handler snapshots state and forwards the barrier.
+ * An input whose watermark reaches \ref END_OF_TIME is finished and no longer takes part in alignment.
+ *
+ * @thread Operator Thread
+ */
+template<channels::ZeroCopyChannel ChannelImpl>
+class FramedFanIn {
+public:
+    explicit FramedFanIn(const std::span<ChannelImpl* const> inputs)
+        : merger_(inputs.size()),
+          aligner_(inputs.size())
+    {
+        readers_.reserve(inputs.size());
+        for (ChannelImpl* input : inputs) readers_.emplace_back(*input);
+    }
+
+    /**
+     * @brief Runs one round over all inputs
+     *
+     * @param onRecord <tt>bool(std::size_t input, std::span<const std::byte> payload)</tt>; false stops the
+     *        input for this round, keeping that record and everything after it (backpressure)
+     * @param onWatermark <tt>void(EventTime)</tt>, called when the combined watermark advances: at most once
+     *        per round, plus once before each aligned barrier
+     * @param onBarrier <tt>void(checkpoint::CheckpointId)</tt>, called when a checkpoint's barrier has
+     *        aligned across the inputs
+     * @param maxFrames Frames taken from each input per round
+     *
+     * @return Frames consumed, watermarks and barriers included
+     */
+    template<typename OnRecord, typename OnWatermark, typename OnBarrier>
+        requires std::predicate<OnRecord&, std::size_t, std::span<const std::byte>>
+              && std::invocable<OnWatermark&, EventTime>
+              && std::invocable<OnBarrier&, checkpoint::CheckpointId>
+    std::size_t poll(OnRecord&& onRecord, OnWatermark&& onWatermark, OnBarrier&& onBarrier,
+                     const std::size_t maxFrames = 64) {
+        std::size_t consumed = 0;
+
+        for (std::size_t input = 0; input < readers_.size(); ++input) {
+            if (aligner_.blocked(input)) continue;
+
+            channels::FramedReader<ChannelImpl>& reader = readers_[input];
+            const channels::FrameBatch batch = reader.fetch(maxFrames);
+            if (batch.empty()) continue;
+
+            std::size_t processed = 0;
+            bool aligned = false;
+            auto it = batch.begin();
+            for (; it != batch.end(); ++it) {
+                const channels::Frame frame = *it;
+                if (const std::optional<EventTime> watermark = watermark_of(frame)) {
+                    merger_.observe(input, *watermark);
+                    if (*watermark == END_OF_TIME) aligned = aligner_.close(input);
+                } else if (const std::optional<checkpoint::CheckpointId> barrier = checkpoint::barrier_of(frame)) {
+                    aligned = aligner_.arrive(input, *barrier);
+                    ++processed;
+                    ++it;
+                    break;
+                } else if (!onRecord(input, frame.payload)) {
+                    break;
+                }
+                ++processed;
+                if (aligned) {
+                    ++it;
+                    break;
+                }
+            }
+
+            reader.release(batch.prefix(it, processed));
+            consumed += processed;
+
+            if (aligned) {
+                if (merger_.settle()) onWatermark(merger_.current());
+                onBarrier(aligner_.completed());
+            }
+        }
+
+        if (merger_.settle()) onWatermark(merger_.current());
+        return consumed;
+    }
+
+    /**
+     * @brief \ref poll for operators that keep no checkpointed state; barriers still align
+     */
+    template<typename OnRecord, typename OnWatermark>
+        requires std::predicate<OnRecord&, std::size_t, std::span<const std::byte>>
+              && std::invocable<OnWatermark&, EventTime>
+    std::size_t poll(OnRecord&& onRecord, OnWatermark&& onWatermark, const std::size_t maxFrames = 64) {
+        return poll(onRecord, onWatermark, [](checkpoint::CheckpointId) {}, maxFrames);
+    }
+
+    EventTime watermark() const noexcept { return merger_.current(); }
+    const WatermarkMerger& merger() const noexcept { return merger_; }
+    const checkpoint::BarrierAligner& aligner() const noexcept { return aligner_; }
+
+private:
+    std::vector<channels::FramedReader<ChannelImpl>> readers_;
+    WatermarkMerger merger_;
+    checkpoint::BarrierAligner aligner_;
+};
+
+/**
+ * @class GateFanIn
+ * @brief \ref FramedFanIn for input gates of \ref Element records
+ *
+ * @thread Operator Thread
+ */
+template<typename Gate>
+class GateFanIn {
+public:
+    using value_type = decltype(Gate::record_type::value);
+
+    explicit GateFanIn(const std::span<Gate* const> inputs)
+        : inputs_(inputs.begin(), inputs.end()),
+          merger_(inputs.size()),
+          aligner_(inputs.size())
+    {}
+
+    /**
+     * @brief Runs one round over all gates; same contract as \ref FramedFanIn::poll with
+     * <tt>bool onRecord(std::size_t input, EventTime timestamp, const value_type&)</tt>
+     */
+    template<typename OnRecord, typename OnWatermark, typename OnBarrier>
+        requires std::predicate<OnRecord&, std::size_t, EventTime, const value_type&>
+              && std::invocable<OnWatermark&, EventTime>
+              && std::invocable<OnBarrier&, checkpoint::CheckpointId>
+    std::size_t poll(OnRecord&& onRecord, OnWatermark&& onWatermark, OnBarrier&& onBarrier,
+                     const std::size_t maxRecords = 64) {
+        std::size_t consumed = 0;
+
+        for (std::size_t input = 0; input < inputs_.size(); ++input) {
+            if (aligner_.blocked(input)) continue;
+
+            Gate& gate = *inputs_[input];
+            const auto batch = gate.fetch(maxRecords);
+
+            std::size_t processed = 0;
+            bool aligned = false;
+            while (processed < batch.recordCount) {
+                const auto& element = batch.data[processed];
+                if (element.isWatermark()) {
+                    merger_.observe(input, element.timestamp);
+                    if (element.timestamp == END_OF_TIME) aligned = aligner_.close(input);
+                } else if (element.isBarrier()) {
+                    aligned = aligner_.arrive(input, element.timestamp);
+                    ++processed;
+                    break;
+                } else if (!onRecord(input, element.timestamp, element.value)) {
+                    break;
+                }
+                ++processed;
+                if (aligned) break;
+            }
+
+            if (processed != 0) gate.commit(processed);
+            consumed += processed;
+
+            if (aligned) {
+                if (merger_.settle()) onWatermark(merger_.current());
+                onBarrier(aligner_.completed());
+            }
+        }
+
+        if (merger_.settle()) onWatermark(merger_.current());
+        return consumed;
+    }
+
+    /**
+     * @brief \ref poll for operators that keep no checkpointed state; barriers still align
+     */
+    template<typename OnRecord, typename OnWatermark>
+        requires std::predicate<OnRecord&, std::size_t, EventTime, const value_type&>
+              && std::invocable<OnWatermark&, EventTime>
+    std::size_t poll(OnRecord&& onRecord, OnWatermark&& onWatermark, const std::size_t maxRecords = 64) {
+        return poll(onRecord, onWatermark, [](checkpoint::CheckpointId) {}, maxRecords);
+    }
+
+    EventTime watermark() const noexcept { return merger_.current(); }
+    const WatermarkMerger& merger() const noexcept { return merger_; }
+    const checkpoint::BarrierAligner& aligner() const noexcept { return aligner_; }
+
+private:
+    std::vector<Gate*> inputs_;
+    WatermarkMerger merger_;
+    checkpoint::BarrierAligner aligner_;
+};
+
+} // namespace lute::tm::watermarks
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <channels/RecordFraming.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <span>
+
+namespace lute::tm::watermarks {
+
+/**
+ * Event time in ticks; the unit is the job's choice. A watermark \c w promises that no record with an event
+ * time below \c w will follow on that stream.
+ */
+using EventTime = std::uint64_t;
+
+inline constexpr EventTime NO_WATERMARK = 0;
+inline constexpr EventTime END_OF_TIME = std::numeric_limits<EventTime>::max();     // stream finished
+
+/**
+ * @brief Watermarks travel in-band as \ref channels::FrameKind::Watermark frames with an 8-byte payload
+ *
+ * @return false if the ring is full
+ */
+template<typename ChannelType>
+bool append_watermark(channels::FramedWriter<ChannelType>& writer, const EventTime watermark) noexcept {
+    return writer.append(std::as_bytes(std::span(&watermark, 1)), channels::FrameKind::Watermark);
+}
+
+/**
+ * @return The watermark carried by \p frame, or nothing if it is not a watermark frame
+ */
+inline std::optional<EventTime> watermark_of(const channels::Frame& frame) noexcept {
+    if (frame.kind != channels::FrameKind::Watermark || frame.payload.size() != sizeof(EventTime)) return std::nullopt;
+
+    EventTime watermark;
+    std::memcpy(&watermark, frame.payload.data(), sizeof(watermark));
+    return watermark;
+}
+
+enum class ElementKind : std::uint8_t {
+    Record,
+    Watermark,
+    Barrier,
+};
+
+/**
+ * @struct Element
+ * @brief Record type for gates that carry control events in-band: a record with its event time, a watermark,
+ * or a checkpoint barrier whose id rides in \c timestamp (\c value is left default-constructed for both)
+ */
+template<typename T>
+struct Element {
+    ElementKind kind;
+    EventTime timestamp;
+    T value;
+
+    static Element record(const EventTime timestamp, const T& value) { return { ElementKind::Record, timestamp, value }; }
+    static Element watermark(const EventTime watermark) { return { ElementKind::Watermark, watermark, T{} }; }
+    static Element barrier(const std::uint64_t checkpoint) { return { ElementKind::Barrier, checkpoint, T{} }; }
+
+    bool isWatermark() const noexcept { return kind == ElementKind::Watermark; }
+    bool isBarrier() const noexcept { return kind == ElementKind::Barrier; }
+};
+
+/**
+ * @struct WatermarkPolicy
+ * @brief How eagerly a \ref WatermarkBatcher forwards watermark progress
+ */
+struct WatermarkPolicy {
+    EventTime minAdvance = 1;       // ticks the watermark must move before another one is sent
+};
+
+/**
+ * @class WatermarkBatcher
+ * @brief Coalesces watermark progress on an output edge
+ *
+ * Operators report progress as often as they like through \ref advance; it only moves a pending value.
+ * The output side sends that value at its batch boundaries (\ref flush_to right before publishing), and only
+ * once it has moved by \ref WatermarkPolicy::minAdvance, so an edge carries at most one watermark frame per
+ * published batch however many records advanced the clock. \ref END_OF_TIME is always sent.
+ *
+ * @thread Producer
+ */
+class WatermarkBatcher {
+public:
+    explicit WatermarkBatcher(const WatermarkPolicy policy = {}) noexcept
+        : policy_(policy)
+    {}
+
+    /**
+     * @brief Raises the pending watermark; regressions are ignored
+     */
+    void advance(const EventTime watermark) noexcept {
+        pending_ = std::max(pending_, watermark);
+    }
+
+    bool due() const noexcept {
+        if (pending_ == emitted_) return false;
+        return pending_ == END_OF_TIME || pending_ - emitted_ >= policy_.minAdvance;
+    }
+
+    /**
+     * @brief Marks the pending watermark as sent
+     */
+    EventTime take() noexcept {
+        emitted_ = pending_;
+        return emitted_;
+    }
+
+    /**
+     * @brief Appends the pending watermark to \p writer if it is due; call before the writer publishes
+     *
+     * @return false if a watermark was due but the ring is full; it stays pending
+     */
+    template<typename ChannelType>
+    bool flush_to(channels::FramedWriter<ChannelType>& writer) noexcept {
+        if (!due()) return true;
+        if (!append_watermark(writer, pending_)) return false;
+
+        take();
+        return true;
+    }
+
+    EventTime pending() const noexcept { return pending_; }
+    EventTime emitted() const noexcept { return emitted_; }
+
+private:
+    const WatermarkPolicy policy_;
+    EventTime pending_ = NO_WATERMARK;
+    EventTime emitted_ = NO_WATERMARK;
+};
+
+/**
+ * @class BoundedLateness
+ * @brief Source-side heuristic: the watermark trails the largest event time seen by a fixed lateness
+ *
+ * Records that arrive later than that are late downstream (see \ref windows::AbelianWindow::late).
+ */
+class BoundedLateness {
+public:
+    explicit BoundedLateness(const EventTime lateness) noexcept
+        : lateness_(lateness)
+    {}
+
+    /**
+     * @return The watermark after seeing a record at \p eventTime
+     */
+    EventTime observe(const EventTime eventTime) noexcept {
+        maxSeen_ = std::max(maxSeen_, eventTime);
+        return watermark();
+    }
+
+    EventTime watermark() const noexcept { return maxSeen_ > lateness_ ? maxSeen_ - lateness_ : NO_WATERMARK; }
+
+private:
+    const EventTime lateness_;
+    EventTime maxSeen_ = 0;
+};
+
+} // namespace lute::tm::watermarks
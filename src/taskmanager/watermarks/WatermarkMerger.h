@@ -0,0 +1,150 @@
+#pragma once
+
+#include <watermarks/Watermark.h>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lute::tm::watermarks {
+
+/**
+ * @class WatermarkMerger
+ * @brief Combined watermark of a fan-in: the minimum over its inputs, kept in a tournament tree
+ *
+ * Leaves are the inputs' watermarks (padded to a power of two with \ref END_OF_TIME); every inner node holds
+ * the input with the smaller watermark of its two children, so the root is the input holding the combined
+ * watermark back. Replaying an update can stop at the first node whose winner is unchanged and did not rise
+ * itself, since nothing above it can change: an update costs at most O(log n) and usually O(1).
+ *
+ * Updates are batched: \ref observe only records an input's newest watermark (O(1), coalescing repeats), and
+ * \ref settle replays each changed input once. When most inputs changed, \ref settle rebuilds the tree
+ * bottom-up in O(n) instead.
+ *
+ * @thread Operator Thread
+ */
+class WatermarkMerger {
+public:
+    explicit WatermarkMerger(const std::size_t inputs)
+        : inputs_(inputs),
+          leaves_(std::bit_ceil(inputs)),
+          watermarks_(leaves_, END_OF_TIME),
+          winners_(leaves_, 0),
+          dirty_(leaves_, false)
+    {
+        assert(inputs != 0);
+
+        std::fill(watermarks_.begin(), watermarks_.begin() + static_cast<std::ptrdiff_t>(inputs), NO_WATERMARK);
+        changed_.reserve(inputs);
+        rebuild();
+    }
+
+    /**
+     * @brief Records \p watermark for \p input without touching the tree; regressions are ignored
+     */
+    void observe(const std::size_t input, const EventTime watermark) noexcept {
+        assert(input < inputs_);
+        if (watermark <= watermarks_[input]) return;
+
+        watermarks_[input] = watermark;
+        if (!dirty_[input]) {
+            dirty_[input] = true;
+            changed_.push_back(static_cast<std::uint32_t>(input));
+        }
+    }
+
+    /**
+     * @brief Applies the watermarks recorded since the last call
+     *
+     * @return true if the combined watermark advanced
+     */
+    bool settle() noexcept {
+        if (changed_.empty()) return false;
+
+        const EventTime before = combined_;
+
+        if (changed_.size() * static_cast<std::size_t>(std::bit_width(leaves_)) > leaves_) {
+            rebuild();
+        } else {
+            for (const std::uint32_t input : changed_) replay(input);
+        }
+
+        for (const std::uint32_t input : changed_) dirty_[input] = false;
+        changed_.clear();
+
+        combined_ = watermarks_[laggard()];
+        return combined_ > before;
+    }
+
+    /**
+     * @brief \ref observe followed by \ref settle
+     */
+    bool update(const std::size_t input, const EventTime watermark) noexcept {
+        observe(input, watermark);
+        return settle();
+    }
+
+    /**
+     * @brief Marks \p input finished; it no longer holds the combined watermark back
+     */
+    void close(const std::size_t input) noexcept { observe(input, END_OF_TIME); }
+
+    /**
+     * @brief Combined watermark as of the last \ref settle
+     */
+    EventTime current() const noexcept { return combined_; }
+
+    /**
+     * @brief The input holding the combined watermark back as of the last \ref settle
+     */
+    std::size_t laggard() const noexcept { return leaves_ == 1 ? 0 : winners_[1]; }
+
+    /**
+     * @brief Newest watermark recorded for \p input, settled or not
+     */
+    EventTime watermark(const std::size_t input) const noexcept { return watermarks_[input]; }
+
+    std::size_t inputs() const noexcept { return inputs_; }
+
+private:
+    /**
+     * @brief Input that wins tree node \p node; nodes [leaves_, 2 * leaves_) are the inputs themselves
+     */
+    std::uint32_t winner(const std::size_t node) const noexcept {
+        return node >= leaves_ ? static_cast<std::uint32_t>(node - leaves_) : winners_[node];
+    }
+
+    std::uint32_t match(const std::size_t node) const noexcept {
+        const std::uint32_t left = winner(2 * node);
+        const std::uint32_t right = winner(2 * node + 1);
+        return watermarks_[right] < watermarks_[left] ? right : left;
+    }
+
+    void replay(const std::uint32_t input) noexcept {
+        for (std::size_t node = (leaves_ + input) / 2; node != 0; node /= 2) {
+            // Ancestors last saw this node's winner at its old watermark: they only need replaying if the
+            // winner changed, or if it is itself one of the inputs that rose in this settle
+            const std::uint32_t previous = winners_[node];
+            winners_[node] = match(node);
+            if (winners_[node] == previous && !dirty_[previous]) return;
+        }
+    }
+
+    void rebuild() noexcept {
+        for (std::size_t node = leaves_ - 1; node != 0; --node) winners_[node] = match(node);
+    }
+
+    const std::size_t inputs_;
+    const std::size_t leaves_;
+
+    std::vector<EventTime> watermarks_;
+    std::vector<std::uint32_t> winners_;        // inner nodes 1 .. leaves_ - 1; slot 0 unused
+    std::vector<bool> dirty_;
+    std::vector<std::uint32_t> changed_;
+    EventTime combined_ = NO_WATERMARK;
+};
+
+} // namespace lute::tm::watermarks
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <windows/Aggregations.h>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace lute::tm::windows {
+
+/**
+ * @class AbelianWindow
+ * @brief Sliding window over \ref AbelianGroup aggregations that accepts out-of-order input
+ *
+ * Time is cut into panes of \p slide ticks and the window spans the newest \c range / \c slide panes. Each
+ * pane keeps the partial of the values that fell into it, and the window keeps a running total. A value is
+ * combined into its pane and into the total wherever it lands in the window; when the window slides, each
+ * departing pane is subtracted from the total and reset. Inserts, evictions and queries are O(1) per value
+ * and per pane, with no ordering assumption inside the window.
+ *
+ * The window ends with the newest pane seen (or passed to \ref advance). Values for panes that have already
+ * left the window are late: they are dropped and counted in \ref late.
+ *
+ * Pane partials are stored one contiguous array per aggregation (\ref AggregateColumns). \ref insert_batch
+ * folds runs of values that share a pane column by column before touching the pane, which is the common case
+ * for mostly ordered batches.
+ *
+ * @thread Operator Thread
+ */
+template<AbelianGroup... Aggs>
+class AbelianWindow {
+public:
+    using Columns = AggregateColumns<Aggs...>;
+    using input_type = typename Columns::input_type;
+    using Partials = typename Columns::Partials;
+    using Results = typename Columns::Results;
+
+    /**
+     * @param range Time extent in ticks; a multiple of \p slide
+     * @param slide Pane width in ticks; with 1 the window slides with every tick
+     */
+    explicit AbelianWindow(const std::uint64_t range, const std::uint64_t slide = 1)
+        : slide_(slide),
+          panes_(range / slide),
+          mask_(std::bit_ceil(panes_) - 1),
+          partials_(mask_ + 1)
+    {
+        assert(slide != 0 && range != 0 && range % slide == 0);
+    }
+
+    /**
+     * @return false if \p timestamp is late; the value is dropped
+     */
+    bool insert(const std::uint64_t timestamp, const input_type& value) noexcept {
+        const std::uint64_t pane = timestamp / slide_;
+        if (!admit(pane)) {
+            ++late_;
+            return false;
+        }
+
+        add(pane, Columns::lift(value));
+        return true;
+    }
+
+    /**
+     * @brief \ref insert for \p count values in any order
+     *
+     * @return Number of values accepted
+     */
+    std::size_t insert_batch(const std::uint64_t* const timestamps, const input_type* const values, const std::size_t count) noexcept {
+        std::size_t accepted = 0;
+
+        for (std::size_t i = 0; i < count;) {
+            const std::uint64_t pane = timestamps[i] / slide_;
+
+            std::size_t j = i + 1;
+            while (j < count && timestamps[j] / slide_ == pane) ++j;
+
+            if (admit(pane)) {
+                add(pane, Columns::reduce(values + i, j - i));
+                accepted += j - i;
+            } else {
+                late_ += j - i;
+            }
+            i = j;
+        }
+
+        return accepted;
+    }
+
+    /**
+     * @brief Slides the window so it ends with the pane of \p now, e.g. on a watermark; never slides back
+     */
+    void advance(const std::uint64_t now) noexcept {
+        admit(now / slide_);
+    }
+
+    /**
+     * @brief Aggregate of every value in the window; the identity if it is empty
+     */
+    Partials query() const noexcept { return total_; }
+
+    Results results() const noexcept { return Columns::lower(total_); }
+
+    /**
+     * @brief First tick past the window; 0 before the first value
+     */
+    std::uint64_t end() const noexcept { return started_ ? (head_ + 1) * slide_ : 0; }
+
+    std::uint64_t range() const noexcept { return panes_ * slide_; }
+    std::uint64_t slide() const noexcept { return slide_; }
+
+    /**
+     * @brief Values dropped because their pane had already left the window
+     */
+    std::uint64_t late() const noexcept { return late_; }
+
+private:
+    /**
+     * @brief Slides the window forward to \p pane if it is newer than the head
+     *
+     * @return false if \p pane has already left the window
+     */
+    bool admit(const std::uint64_t pane) noexcept {
+        if (!started_) {
+            head_ = pane;
+            started_ = true;
+            return true;
+        }
+
+        if (pane > head_) {
+            slide_to(pane);
+            return true;
+        }
+
+        return head_ - pane < panes_;
+    }
+
+    void add(const std::uint64_t pane, const Partials& partial) noexcept {
+        partials_.accumulate(pane & mask_, partial);
+        total_ = Columns::combine(total_, partial);
+    }
+
+    /**
+     * @brief Subtracts and resets the panes that leave when the head moves to \p pane
+     *
+     * Slots outside the window always hold the identity, so the panes that enter need no reset.
+     */
+    void slide_to(const std::uint64_t pane) noexcept {
+        const std::uint64_t gap = pane - head_;
+        head_ = pane;
+
+        if (gap >= panes_) {
+            partials_.clear(0, partials_.size());
+            total_ = Columns::identity();
+            return;
+        }
+
+        // Departing panes are the oldest `gap` ones: a contiguous run of slots, split at most once by the wrap
+        const std::size_t first = (pane - gap - panes_ + 1) & mask_;
+        const std::size_t head = std::min<std::size_t>(gap, partials_.size() - first);
+
+        evict_slots(first, first + head);
+        evict_slots(0, gap - head);
+    }
+
+    void evict_slots(const std::size_t begin, const std::size_t end) noexcept {
+        if (begin == end) return;
+
+        total_ = Columns::subtract(total_, partials_.fold(begin, end));
+        partials_.clear(begin, end);
+    }
+
+    const std::uint64_t slide_;
+    const std::uint64_t panes_;
+    const std::size_t mask_;
+
+    Columns partials_;
+    Partials total_ = Columns::identity();
+
+    std::uint64_t head_ = 0;
+    bool started_ = false;
+    std::uint64_t late_ = 0;
+};
+
+} // namespace lute::tm::windows
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lute::tm::windows {
+
+/**
+ * @concept Monoid
+ * @brief Aggregation with an associative \c combine and an identity; enough for in-order sliding windows
+ *
+ * \c combine(older, newer) need not be commutative; windows always pass the older partial first.
+ * Partials are plain values so a window can keep one contiguous array per aggregation.
+ */
+template<typename A>
+concept Monoid = requires(const typename A::input_type& in,
+                          const typename A::partial_type& a,
+                          const typename A::partial_type& b) {
+    typename A::result_type;
+    { A::identity() } -> std::same_as<typename A::partial_type>;
+    { A::lift(in) } -> std::same_as<typename A::partial_type>;
+    { A::combine(a, b) } -> std::same_as<typename A::partial_type>;
+    { A::lower(a) } -> std::same_as<typename A::result_type>;
+} && std::is_trivially_copyable_v<typename A::partial_type>;
+
+/**
+ * @concept AbelianGroup
+ * @brief Commutative monoid with an inverse: \c subtract(combine(a, b), b) == a. Lets a window take a value
+ * out again, so it can evict in O(1) regardless of the order values arrived in.
+ */
+template<typename A>
+concept AbelianGroup = Monoid<A> && requires(const typename A::partial_type& a, const typename A::partial_type& b) {
+    { A::subtract(a, b) } -> std::same_as<typename A::partial_type>;
+};
+
+/**
+ * @brief Sum of the inputs. With floating point inputs, subtract-on-evict accumulates rounding error over
+ * the life of the window; prefer integer (e.g. fixed-point) inputs where the result must be exact.
+ */
+template<typename T>
+struct Sum {
+    using input_type = T;
+    using partial_type = T;
+    using result_type = T;
+
+    static constexpr T identity() noexcept { return T{}; }
+    static constexpr T lift(const T value) noexcept { return value; }
+    static constexpr T combine(const T a, const T b) noexcept { return a + b; }
+    static constexpr T subtract(const T a, const T b) noexcept { return a - b; }
+    static constexpr T lower(const T a) noexcept { return a; }
+};
+
+template<typename T>
+struct Count {
+    using input_type = T;
+    using partial_type = std::uint64_t;
+    using result_type = std::uint64_t;
+
+    static constexpr std::uint64_t identity() noexcept { return 0; }
+    static constexpr std::uint64_t lift(const T&) noexcept { return 1; }
+    static constexpr std::uint64_t combine(const std::uint64_t a, const std::uint64_t b) noexcept { return a + b; }
+    static constexpr std::uint64_t subtract(const std::uint64_t a, const std::uint64_t b) noexcept { return a - b; }
+    static constexpr std::uint64_t lower(const std::uint64_t a) noexcept { return a; }
+};
+
+/**
+ * @brief Smallest input; the identity (and the result of an empty window) is the type's maximum
+ */
+template<typename T>
+struct Min {
+    using input_type = T;
+    using partial_type = T;
+    using result_type = T;
+
+    static constexpr T identity() noexcept {
+        if constexpr (std::numeric_limits<T>::has_infinity) return std::numeric_limits<T>::infinity();
+        return std::numeric_limits<T>::max();
+    }
+    static constexpr T lift(const T value) noexcept { return value; }
+    static constexpr T combine(const T a, const T b) noexcept { return b < a ? b : a; }
+    static constexpr T lower(const T a) noexcept { return a; }
+};
+
+/**
+ * @brief Largest input; the identity (and the result of an empty window) is the type's lowest value
+ */
+template<typename T>
+struct Max {
+    using input_type = T;
+    using partial_type = T;
+    using result_type = T;
+
+    static constexpr T identity() noexcept {
+        if constexpr (std::numeric_limits<T>::has_infinity) return -std::numeric_limits<T>::infinity();
+        return std::numeric_limits<T>::lowest();
+    }
+    static constexpr T lift(const T value) noexcept { return value; }
+    static constexpr T combine(const T a, const T b) noexcept { return a < b ? b : a; }
+    static constexpr T lower(const T a) noexcept { return a; }
+};
+
+/**
+ * @class AggregateColumns
+ * @brief Several aggregations over the same input, evaluated together and stored structure-of-arrays
+ *
+ * Partials are handled as one tuple (\c Partials) per slot, but stored as one contiguous array per
+ * aggregation, so a window that touches only a few slots loads only the columns it needs and the bulk
+ * kernels (\ref reduce, \ref fold) run as tight single-type loops the compiler can vectorise.
+ *
+ * Windows that need to take values out again (\ref subtract) require every aggregation to be an
+ * \ref AbelianGroup; mixing in e.g. \ref Max is a compile error there.
+ */
+template<Monoid... Aggs>
+    requires (sizeof...(Aggs) > 0)
+class AggregateColumns {
+public:
+    using input_type = typename std::tuple_element_t<0, std::tuple<Aggs...>>::input_type;
+    using Partials = std::tuple<typename Aggs::partial_type...>;
+    using Results = std::tuple<typename Aggs::result_type...>;
+
+    static_assert((std::is_same_v<typename Aggs::input_type, input_type> && ...),
+                  "All aggregations of one window take the same input");
+
+    static constexpr bool invertible = (AbelianGroup<Aggs> && ...);
+
+    explicit AggregateColumns(const std::size_t size)
+        : columns_(std::vector<typename Aggs::partial_type>(size, Aggs::identity())...)
+    {}
+
+    static constexpr Partials identity() noexcept { return Partials{ Aggs::identity()... }; }
+
+    static constexpr Partials lift(const input_type& value) noexcept { return Partials{ Aggs::lift(value)... }; }
+
+    static constexpr Partials combine(const Partials& older, const Partials& newer) noexcept {
+        return zip(older, newer, [](auto agg, const auto& a, const auto& b) { return decltype(agg)::type::combine(a, b); });
+    }
+
+    static constexpr Partials subtract(const Partials& a, const Partials& b) noexcept requires invertible {
+        return zip(a, b, [](auto agg, const auto& x, const auto& y) { return decltype(agg)::type::subtract(x, y); });
+    }
+
+    static constexpr Results lower(const Partials& partials) noexcept {
+        return lower(partials, std::index_sequence_for<Aggs...>{});
+    }
+
+    /**
+     * @brief Partial of \p count inputs in order, computed one column at a time
+     */
+    static Partials reduce(const input_type* const values, const std::size_t count) noexcept {
+        return reduce(values, count, std::index_sequence_for<Aggs...>{});
+    }
+
+    Partials load(const std::size_t slot) const noexcept {
+        return load(slot, std::index_sequence_for<Aggs...>{});
+    }
+
+    void store(const std::size_t slot, const Partials& partials) noexcept {
+        store(slot, partials, std::index_sequence_for<Aggs...>{});
+    }
+
+    /**
+     * @brief Combines \p partials into \p slot in place
+     */
+    void accumulate(const std::size_t slot, const Partials& partials) noexcept {
+        store(slot, combine(load(slot), partials));
+    }
+
+    /**
+     * @brief Combination of slots [begin, end), oldest first, computed one column at a time
+     */
+    Partials fold(const std::size_t begin, const std::size_t end) const noexcept {
+        return fold(begin, end, std::index_sequence_for<Aggs...>{});
+    }
+
+    /**
+     * @brief Resets slots [begin, end) to the identity
+     */
+    void clear(const std::size_t begin, const std::size_t end) noexcept {
+        clear(begin, end, std::index_sequence_for<Aggs...>{});
+    }
+
+    std::size_t size() const noexcept { return std::get<0>(columns_).size(); }
+
+    template<std::size_t I>
+    const auto* column() const noexcept { return std::get<I>(columns_).data(); }
+
+private:
+    template<typename A>
+    struct Tag { using type = A; };
+
+    template<typename Op>
+    static constexpr Partials zip(const Partials& a, const Partials& b, Op op) noexcept {
+        return zip(a, b, op, std::index_sequence_for<Aggs...>{});
+    }
+
+    template<typename Op, std::size_t... I>
+    static constexpr Partials zip(const Partials& a, const Partials& b, Op op, std::index_sequence<I...>) noexcept {
+        return Partials{ op(Tag<Aggs>{}, std::get<I>(a), std::get<I>(b))... };
+    }
+
+    template<std::size_t... I>
+    static constexpr Results lower(const Partials& partials, std::index_sequence<I...>) noexcept {
+        return Results{ Aggs::lower(std::get<I>(partials))... };
+    }
+
+    template<typename A>
+    static typename A::partial_type reduceColumn(const input_type* const values, const std::size_t count) noexcept {
+        typename A::partial_type acc = A::identity();
+        for (std::size_t i = 0; i < count; ++i) acc = A::combine(acc, A::lift(values[i]));
+        return acc;
+    }
+
+    template<std::size_t... I>
+    static Partials reduce(const input_type* const values, const std::size_t count, std::index_sequence<I...>) noexcept {
+        return Partials{ reduceColumn<Aggs>(values, count)... };
+    }
+
+    template<std::size_t... I>
+    Partials load(const std::size_t slot, std::index_sequence<I...>) const noexcept {
+        return Partials{ std::get<I>(columns_)[slot]... };
+    }
+
+    template<std::size_t... I>
+    void store(const std::size_t slot, const Partials& partials, std::index_sequence<I...>) noexcept {
+        ((std::get<I>(columns_)[slot] = std::get<I>(partials)), ...);
+    }
+
+    template<typename A>
+    static typename A::partial_type foldColumn(const std::vector<typename A::partial_type>& column,
+                                               const std::size_t begin, const std::size_t end) noexcept {
+        typename A::partial_type acc = A::identity();
+        for (std::size_t i = begin; i < end; ++i) acc = A::combine(acc, column[i]);
+        return acc;
+    }
+
+    template<std::size_t... I>
+    Partials fold(const std::size_t begin, const std::size_t end, std::index_sequence<I...>) const noexcept {
+        return Partials{ foldColumn<Aggs>(std::get<I>(columns_), begin, end)... };
+    }
+
+    template<std::size_t... I>
+    void clear(const std::size_t begin, const std::size_t end, std::index_sequence<I...>) noexcept {
+        ((std::fill(std::get<I>(columns_).begin() + static_cast<std::ptrdiff_t>(begin),
+                    std::get<I>(columns_).begin() + static_cast<std::ptrdiff_t>(end), Aggs::identity())), ...);
+    }
+
+    std::tuple<std::vector<typename Aggs::partial_type>...> columns_;
+};
+
+} // namespace lute::tm::windows
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <windows/Aggregations.h>
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace lute::tm::windows {
+
+/**
+ * @class MonoidWindow
+ * @brief In-order sliding window over any \ref Monoid aggregations, worst-case O(1) per insert, evict and query
+ *
+ * Values live in a ring in arrival order and are split into up to three segments, oldest first:
+ *
+ * - front  [F, B)   each slot holds the aggregate of itself up to B (the classic two-stacks "front stack")
+ * - middle [B, X)   the former back segment, being turned into a front segment; its total is kept aside
+ * - back   [X, E)   only its running total is kept
+ *
+ * Two-stacks rebuilds the front in one O(window) pass when it runs empty. Here the rebuild starts as soon as
+ * the back outgrows the front and advances \ref STEPS_PER_OPERATION slots on every insert and evict, writing
+ * into a second aggregate array so queries keep using the first. The middle segment's own aggregates are
+ * finished before the front is exhausted, and the old front slots (re-based onto the middle's total) before the
+ * next rebuild is due, so no operation ever pays for more than a constant number of \c combine calls. Queries
+ * combine at most three partials.
+ *
+ * Timestamps must not decrease; out-of-order input needs an \ref AbelianWindow. The window is bounded by time
+ * (\p range) and by count (\p capacity); whichever bound is hit first evicts.
+ *
+ * Values, both aggregate arrays and timestamps are separate contiguous arrays per aggregation
+ * (\ref AggregateColumns), allocated once at construction.
+ *
+ * @thread Operator Thread
+ */
+template<Monoid... Aggs>
+class MonoidWindow {
+public:
+    using Columns = AggregateColumns<Aggs...>;
+    using input_type = typename Columns::input_type;
+    using Partials = typename Columns::Partials;
+    using Results = typename Columns::Results;
+
+    static constexpr std::uint64_t UNBOUNDED = std::numeric_limits<std::uint64_t>::max();
+
+    /**
+     * @brief Rebuild slots advanced per insert or evict; two keep the rebuild ahead of the front
+     */
+    static constexpr std::size_t STEPS_PER_OPERATION = 2;
+
+    /**
+     * @param capacity Most values held at once; inserting into a full window evicts the oldest value
+     * @param range Time extent: after inserting at \c t the window holds the values in (t - range, t].
+     *              \ref UNBOUNDED makes a purely count-based window.
+     */
+    explicit MonoidWindow(const std::size_t capacity, const std::uint64_t range = UNBOUNDED)
+        : limit_(capacity),
+          mask_(std::bit_ceil(capacity) - 1),
+          range_(range),
+          timestamps_(mask_ + 1),
+          values_(mask_ + 1),
+          aggs_{ Columns(mask_ + 1), Columns(mask_ + 1) }
+    {
+        assert(capacity != 0 && range != 0);
+    }
+
+    /**
+     * @brief Appends \p value, after evicting what falls out of the range or exceeds the capacity
+     *
+     * @pre \p timestamp is not older than the newest value in the window
+     */
+    void insert(const std::uint64_t timestamp, const input_type& value) noexcept {
+        assert(empty() || timestamp >= newest_);
+
+        advance(timestamp);
+        if (size() == limit_) evict();
+
+        const std::size_t slot = E_ & mask_;
+        const Partials lifted = Columns::lift(value);
+
+        timestamps_[slot] = timestamp;
+        values_.store(slot, lifted);
+        back_ = Columns::combine(back_, lifted);
+        newest_ = timestamp;
+        ++E_;
+
+        maintain();
+    }
+
+    /**
+     * @brief \ref insert for \p count values in order
+     */
+    void insert_batch(const std::uint64_t* const timestamps, const input_type* const values, const std::size_t count) noexcept {
+        for (std::size_t i = 0; i < count; ++i) insert(timestamps[i], values[i]);
+    }
+
+    /**
+     * @brief Evicts the values that fall out of the range at time \p now, e.g. on a watermark
+     */
+    void advance(const std::uint64_t now) noexcept {
+        if (range_ == UNBOUNDED || now < range_) return;
+
+        const std::uint64_t cutoff = now - range_;
+        while (!empty() && timestamps_[F_ & mask_] <= cutoff) evict();
+    }
+
+    /**
+     * @brief Drops the oldest value
+     */
+    void evict() noexcept {
+        assert(!empty());
+
+        ++F_;
+        maintain();
+    }
+
+    /**
+     * @brief Aggregate of every value in the window, oldest first; the identity if it is empty
+     */
+    Partials query() const noexcept {
+        Partials front = Columns::identity();
+
+        if (F_ < B_) {
+            front = aggs_[current_].load(F_ & mask_);
+            if (rebuilding_) front = Columns::combine(front, middle_);
+        } else if (rebuilding_) {
+            assert(backCursor_ <= F_);
+            front = aggs_[current_ ^ 1].load(F_ & mask_);
+        }
+
+        return Columns::combine(front, back_);
+    }
+
+    Results results() const noexcept { return Columns::lower(query()); }
+
+    std::size_t size() const noexcept { return static_cast<std::size_t>(E_ - F_); }
+    bool empty() const noexcept { return E_ == F_; }
+    std::size_t capacity() const noexcept { return limit_; }
+    std::uint64_t range() const noexcept { return range_; }
+
+    /**
+     * @pre !empty()
+     */
+    std::uint64_t oldest() const noexcept { return timestamps_[F_ & mask_]; }
+
+private:
+    /**
+     * @brief Starts a rebuild once the back outgrows the front, and advances the one in progress
+     */
+    void maintain() noexcept {
+        if (!rebuilding_) {
+            if (E_ - B_ <= B_ - F_) return;
+
+            X_ = E_;
+            middle_ = back_;
+            back_ = Columns::identity();
+            backCursor_ = X_;
+            frontCursor_ = B_;
+            rebuilding_ = true;
+        }
+
+        for (std::size_t i = 0; i < STEPS_PER_OPERATION && rebuilding_; ++i) step();
+    }
+
+    /**
+     * @brief Computes one slot of the next front: first the middle segment from its end, then the surviving
+     * old front slots re-based onto the middle's total. Finishes the rebuild when both are done.
+     */
+    void step() noexcept {
+        Columns& next = aggs_[current_ ^ 1];
+
+        if (backCursor_ > B_) {
+            --backCursor_;
+            const std::size_t slot = backCursor_ & mask_;
+            const Partials value = values_.load(slot);
+
+            next.store(slot, backCursor_ + 1 == X_ ? value
+                                                   : Columns::combine(value, next.load((backCursor_ + 1) & mask_)));
+        } else if (frontCursor_ > F_) {
+            --frontCursor_;
+            const std::size_t slot = frontCursor_ & mask_;
+            next.store(slot, Columns::combine(aggs_[current_].load(slot), middle_));
+        }
+
+        if (backCursor_ == B_ && frontCursor_ <= F_) {
+            assert(F_ <= X_);
+
+            current_ ^= 1;
+            B_ = X_;
+            middle_ = Columns::identity();
+            rebuilding_ = false;
+        }
+    }
+
+    const std::size_t limit_;
+    const std::size_t mask_;
+    const std::uint64_t range_;
+
+    std::vector<std::uint64_t> timestamps_;
+    Columns values_;
+    Columns aggs_[2];
+    unsigned current_ = 0;
+
+    // Absolute positions; slots are position & mask_
+    std::uint64_t F_ = 0;
+    std::uint64_t B_ = 0;
+    std::uint64_t X_ = 0;
+    std::uint64_t E_ = 0;
+
+    bool rebuilding_ = false;
+    std::uint64_t backCursor_ = 0;      // middle slots [backCursor_, X_) are done
+    std::uint64_t frontCursor_ = 0;     // re-based front slots [frontCursor_, B_) are done
+
+    Partials middle_ = Columns::identity();
+    Partials back_ = Columns::identity();
+    std::uint64_t newest_ = 0;
+};
+
+} // namespace lute::tm::windows
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <checkpoint/snapshot_store.h>
+#include <checkpoint/snapshot_writer.h>
+#include <checkpoint/PagedState.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+using namespace lute::runtime::checkpoint;
+using lute::tm::checkpoint::NO_CHECKPOINT;
+using lute::tm::checkpoint::PagedState;
+using namespace std::chrono_literals;
+
+namespace {
+
+/**
+ * Checkpoint root that is removed again with the test
+ */
+class SnapshotWriterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto* test = ::testing::UnitTest::GetInstance()->current_test_info();
+        root_ = std::filesystem::temp_directory_path() / ("lute-checkpoint-" + std::to_string(::getpid()) + "-" + test->name());
+        std::filesystem::remove_all(root_);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(root_);
+    }
+
+    std::string root() const { return root_.string(); }
+
+    SnapshotWriterOptions options(const std::size_t states) const {
+        SnapshotWriterOptions options;
+        options.directory = root();
+        options.states = states;
+        return options;
+    }
+
+private:
+    std::filesystem::path root_;
+};
+
+void fill(PagedState<std::uint64_t>& state, const std::uint64_t seed) {
+    for (std::size_t i = 0; i < state.size(); i += 7) state.mutate(i) = seed * 1000 + i;
+}
+
+} // namespace
+
+TEST_F(SnapshotWriterTest, CompletesOnceEveryStateIsDurable) {
+    SnapshotWriter writer(options(2));
+    writer.start();
+
+    PagedState<std::uint64_t> counts(1000);
+    PagedState<std::uint64_t> sums(300);
+    fill(counts, 1);
+    fill(sums, 2);
+
+    writer.submit("counts", counts.snapshot(1));
+    EXPECT_FALSE(writer.wait_for(1, 50ms));
+    EXPECT_EQ(latest_complete(root()), NO_CHECKPOINT);
+
+    writer.submit("sums", sums.snapshot(1));
+    ASSERT_TRUE(writer.wait_for(1, 5s));
+    EXPECT_EQ(writer.latest_completed(), 1u);
+    EXPECT_EQ(latest_complete(root()), 1u);
+
+    const SnapshotWriterStats stats = writer.stats();
+    EXPECT_EQ(stats.snapshots, 2u);
+    EXPECT_EQ(stats.completed, 1u);
+    EXPECT_EQ(stats.failed, 0u);
+    EXPECT_GT(stats.bytes, (1000u + 300u) * sizeof(std::uint64_t));
+}
+
+TEST_F(SnapshotWriterTest, RestoresIncrementalChainFromDisk) {
+    SnapshotWriter writer(options(1));
+    writer.start();
+
+    PagedState<std::uint64_t> state(5000);
+    fill(state, 1);
+    writer.submit("state", state.snapshot(1));
+
+    for (CheckpointId checkpoint = 2; checkpoint <= 4; ++checkpoint) {
+        state.mutate(checkpoint * 611) = checkpoint;
+        writer.submit("state", state.snapshot(checkpoint));
+    }
+    writer.stop();                              // drains the queue
+
+    ASSERT_EQ(latest_complete(root()), 4u);
+    const auto chain = read_snapshot_chain(root(), 4, "state");
+    ASSERT_EQ(chain.size(), 4u);
+    EXPECT_FALSE(chain.front().incremental());
+    EXPECT_EQ(chain.back().pages.size(), 1u);
+
+    PagedState<std::uint64_t> restored(5000);
+    for (const auto& snapshot : chain) restored.restore(snapshot);
+    for (std::size_t i = 0; i < state.size(); ++i) ASSERT_EQ(restored[i], state[i]) << "element " << i;
+}
+
+TEST_F(SnapshotWriterTest, FailedStateNeverCompletesItsCheckpoint) {
+    SnapshotWriter writer(options(1));
+    writer.start();
+
+    PagedState<std::uint64_t> state(10);
+    writer.submit("../escape", state.snapshot(1));
+    writer.submit("state", state.snapshot(2, true));
+
+    ASSERT_TRUE(writer.wait_for(2, 5s));
+    EXPECT_EQ(writer.stats().failed, 1u);
+    EXPECT_FALSE(std::filesystem::exists(checkpoint_directory(root(), 1) + "/_COMPLETE"));
+}
+
+TEST_F(SnapshotWriterTest, IncrementalOnAFailedSnapshotWaitsForTheNextFullOne) {
+    SnapshotWriter writer(options(1));
+    writer.start();
+
+    PagedState<std::uint64_t> state(5000);
+    fill(state, 1);
+    writer.submit("state", state.snapshot(1));
+    ASSERT_TRUE(writer.wait_for(1, 5s));
+    EXPECT_FALSE(writer.needs_full("state"));
+
+    // A file where checkpoint 2's directory should go makes writing it fail
+    std::ofstream(checkpoint_directory(root(), 2)) << "in the way";
+    state.mutate(100) = 2;
+    writer.submit("state", state.snapshot(2));
+    state.mutate(4000) = 3;
+    writer.submit("state", state.snapshot(3));
+    EXPECT_FALSE(writer.wait_for(3, 200ms));
+
+    EXPECT_TRUE(writer.needs_full("state"));
+    EXPECT_EQ(writer.stats().failed, 2u);
+    EXPECT_FALSE(std::filesystem::exists(checkpoint_directory(root(), 3)));
+    EXPECT_EQ(latest_complete(root()), 1u);
+
+    writer.submit("state", state.snapshot(4, writer.needs_full("state")));
+    ASSERT_TRUE(writer.wait_for(4, 5s));
+    EXPECT_FALSE(writer.needs_full("state"));
+
+    const auto chain = read_snapshot_chain(root(), latest_complete(root()), "state");
+    ASSERT_EQ(chain.size(), 1u);
+    PagedState<std::uint64_t> restored(5000);
+    restored.restore(chain.front());
+    for (std::size_t i = 0; i < state.size(); ++i) ASSERT_EQ(restored[i], state[i]) << "element " << i;
+}
+
+TEST_F(SnapshotWriterTest, RejectsFilesThatAreNotSnapshots) {
+    std::filesystem::create_directories(checkpoint_directory(root(), 1));
+    std::ofstream(checkpoint_directory(root(), 1) + "/state.state") << "definitely not a snapshot, but long enough to hold a header";
+
+    EXPECT_THROW(read_snapshot(root(), 1, "state"), std::runtime_error);
+    EXPECT_THROW(read_snapshot(root(), 2, "state"), std::runtime_error);
+    EXPECT_THROW(SnapshotWriter(SnapshotWriterOptions{}), std::runtime_error);
+}
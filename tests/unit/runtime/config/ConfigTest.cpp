@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <config/config.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace lute::runtime::config;
+using lute::tm::memory::HugePages;
+using lute::tm::memory::MemoryPlacement;
+using lute::tm::memory::NumaPolicy;
+
+namespace {
+
+AppConfig parse(const std::string& text) {
+    std::istringstream in(text);
+    return parse_config(in);
+}
+
+AppConfig load(const std::string& text) {
+    AppConfig config = parse(text);
+    validate(config);
+    return config;
+}
+
+} // namespace
+
+// ============================================================================
+// Parsing Tests
+// ============================================================================
+
+TEST(ConfigTest, EmptyFileKeepsValidDefaults) {
+    const AppConfig config = load("");
+    EXPECT_EQ(config.execution.worker_threads, 1);
+    EXPECT_TRUE(config.execution.worker_cpus.empty());
+    EXPECT_EQ(config.gates.cleanup, GateCleanup::Synchronous);
+    EXPECT_TRUE(config.memory.isDefault());
+}
+
+TEST(ConfigTest, ParsesEverySection) {
+    const AppConfig config = load(R"(
+        # comment line
+        [execution]
+        worker_threads = 2
+        worker_cpus = 2-3      # trailing comment
+        control_cpus = 0x3
+
+        [backoff]
+        spin_iterations = 10
+        pause_iterations = 20
+        park_timeout_us = 30
+
+        [channels]
+        capacity = 4096
+        mpsc_slots = 64
+        mpsc_slot_payload = 128
+        batch_max_records = 8
+        batch_max_bytes = 1024
+        batch_max_delay_us = 5
+        wait = park
+        wait_spin_iterations = 50
+
+        [gates]
+        capacity = 256
+        fetch_batch = 16
+        cleanup = signaled
+
+        [flow]
+        backpressure = spill
+        spill_bytes = 4096
+        grant_batch = 32
+
+        [memory]
+        numa_node = 1
+        numa_policy = bind
+        huge_pages = if_available
+    )");
+
+    EXPECT_EQ(config.execution.worker_threads, 2);
+    EXPECT_EQ(config.execution.worker_cpus, (std::vector<int>{2, 3}));
+    EXPECT_EQ(config.execution.control_cpus, (std::vector<int>{0, 1}));
+    EXPECT_EQ(config.backoff.spin_iterations, 10u);
+    EXPECT_EQ(config.backoff.pause_iterations, 20u);
+    EXPECT_EQ(config.backoff.park_timeout_us, 30u);
+    EXPECT_EQ(config.channels.capacity, 4096u);
+    EXPECT_EQ(config.channels.mpsc_slots, 64u);
+    EXPECT_EQ(config.channels.mpsc_slot_payload, 128u);
+    EXPECT_EQ(config.channels.batch_max_records, 8u);
+    EXPECT_EQ(config.channels.batch_max_bytes, 1024u);
+    EXPECT_EQ(config.channels.batch_max_delay_us, 5u);
+    EXPECT_EQ(config.channels.wait, ChannelWait::Park);
+    EXPECT_EQ(config.channels.wait_spin_iterations, 50u);
+    EXPECT_EQ(config.gates.capacity, 256u);
+    EXPECT_EQ(config.gates.fetch_batch, 16u);
+    EXPECT_EQ(config.gates.cleanup, GateCleanup::Signaled);
+    EXPECT_EQ(config.flow.backpressure, lute::tm::flow::Backpressure::Spill);
+    EXPECT_EQ(config.flow.spill_bytes, 4096u);
+    EXPECT_EQ(config.flow.grant_batch, 32u);
+    EXPECT_EQ(config.memory.node, 1);
+    EXPECT_EQ(config.memory.policy, NumaPolicy::Bind);
+    EXPECT_EQ(config.memory.hugePages, HugePages::IfAvailable);
+}
+
+TEST(ConfigTest, HexMaskSkipsGroupSeparators) {
+    const AppConfig config = parse("[execution]\nworker_cpus = 0x1,00000001\n");
+    EXPECT_EQ(config.execution.worker_cpus, (std::vector<int>{0, 32}));
+}
+
+TEST(ConfigTest, ErrorsNameSourceLineAndKey) {
+    try {
+        std::istringstream in("[gates]\n\ncapacity = lots\n");
+        parse_config(in, "prod.conf");
+        FAIL() << "expected a parse error";
+    } catch (const std::runtime_error& e) {
+        const std::string message = e.what();
+        EXPECT_NE(message.find("prod.conf:3"), std::string::npos) << message;
+        EXPECT_NE(message.find("gates.capacity"), std::string::npos) << message;
+    }
+}
+
+TEST(ConfigTest, RejectsMalformedInput) {
+    EXPECT_THROW(parse("[gates]\ncapacity = 16\ncapacity = 32\n"), std::runtime_error);
+    EXPECT_THROW(parse("[gates]\ncapcity = 16\n"), std::runtime_error);
+    EXPECT_THROW(parse("capacity = 16\n"), std::runtime_error);
+    EXPECT_THROW(parse("[gates\n"), std::runtime_error);
+    EXPECT_THROW(parse("[gates]\ncleanup = lazy\n"), std::runtime_error);
+    EXPECT_THROW(parse("[backoff]\nspin_iterations = -1\n"), std::runtime_error);
+    EXPECT_THROW(parse("[execution]\nworker_cpus = 0xZ\n"), std::runtime_error);
+}
+
+// ============================================================================
+// Validation Tests
+// ============================================================================
+
+TEST(ConfigTest, RejectsValuesThatCannotRun) {
+    EXPECT_THROW(load("[execution]\nworker_threads = 0\n"), std::runtime_error);
+    EXPECT_THROW(load("[execution]\nworker_threads = 3\nworker_cpus = 0-1\n"), std::runtime_error);
+    EXPECT_THROW(load("[execution]\nworker_cpus = 1,1\n"), std::runtime_error);
+    EXPECT_THROW(load("[execution]\nworker_cpus = 1\ncontrol_cpus = 0-1\n"), std::runtime_error);
+    EXPECT_THROW(load("[channels]\ncapacity = 1000\n"), std::runtime_error);
+    EXPECT_THROW(load("[channels]\ncapacity = 4096\nbatch_max_bytes = 8192\n"), std::runtime_error);
+    EXPECT_THROW(load("[gates]\ncapacity = 16\nfetch_batch = 32\n"), std::runtime_error);
+    EXPECT_THROW(load("[gates]\ncapacity = 16\nfetch_batch = 16\n[flow]\ngrant_batch = 32\n"), std::runtime_error);
+    EXPECT_THROW(load("[memory]\nnuma_policy = bind\n"), std::runtime_error);
+    EXPECT_THROW(load("[transport]\nring_bytes = 1000\n"), std::runtime_error);
+    EXPECT_THROW(load("[execution]\nworker_cpus = 2-3\n[transport]\nio_cpus = 3\n"), std::runtime_error);
+    EXPECT_THROW(load("[sim]\naction = rewind\n"), std::runtime_error);
+}
+
+TEST(ConfigTest, ShippedProfilesLoad) {
+    for (const char* profile : { "prod", "dev" }) {
+        const std::string path = std::string(LUTE_SOURCE_DIR) + "/configs/" + profile + "/taskmanager.conf";
+        EXPECT_NO_THROW(load_config(path)) << path;
+    }
+}
+
+TEST(ConfigTest, MissingFileThrows) {
+    EXPECT_THROW(load_config("/nonexistent/taskmanager.conf"), std::runtime_error);
+}
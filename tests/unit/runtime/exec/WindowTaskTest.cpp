@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <exec/window_task.h>
+
+#include <gates/InputGate.h>
+#include <windows/AbelianWindow.h>
+#include <windows/MonoidWindow.h>
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace lute::runtime::exec;
+using namespace lute::tm::windows;
+using lute::tm::gates::InputGate;
+
+namespace {
+
+struct Trade {
+    std::uint64_t timestamp;
+    std::int64_t price;
+    std::uint64_t payload[6];
+};
+
+auto tradePrice() {
+    return [](const Trade& trade) { return std::pair{ trade.timestamp, trade.price }; };
+}
+
+} // namespace
+
+TEST(WindowTaskTest, EmitsOncePerBatchAndCommits) {
+    using Window = MonoidWindow<Max<std::int64_t>, Count<std::int64_t>>;
+
+    InputGate<Trade> gate(16);
+    std::vector<std::pair<std::uint64_t, Window::Results>> emitted;
+
+    WindowTask task(gate, Window(64, 10), tradePrice(),
+                    [&](const std::uint64_t t, const Window::Results& results) { emitted.emplace_back(t, results); },
+                    4);
+
+    EXPECT_EQ(task.poll(), 0u);
+    EXPECT_TRUE(emitted.empty());
+
+    for (std::uint64_t t = 1; t <= 6; ++t) ASSERT_TRUE(gate.emplace(Trade{ t * 3, static_cast<std::int64_t>(t % 4), {} }));
+
+    EXPECT_EQ(task.poll(), 4u);
+    EXPECT_EQ(task.poll(), 2u);
+    EXPECT_EQ(task.poll(), 0u);
+    EXPECT_EQ(gate.pending(), 0u);
+
+    ASSERT_EQ(emitted.size(), 2u);
+    EXPECT_EQ(emitted[0], std::pair(12ul, Window::Results(3, 4)));     // 3..12
+    EXPECT_EQ(emitted[1], std::pair(18ul, Window::Results(3, 4)));     // (8, 18]: 9, 12, 15, 18
+}
+
+TEST(WindowTaskTest, FeedsOutOfOrderRecordsToGroupWindow) {
+    using Window = AbelianWindow<Sum<std::int64_t>>;
+
+    InputGate<Trade> gate(16);
+    Window::Results last{};
+
+    WindowTask task(gate, Window(100, 10), tradePrice(),
+                    [&](std::uint64_t, const Window::Results& results) { last = results; });
+
+    for (const std::uint64_t t : { 50u, 20u, 140u, 55u, 39u, 130u }) {
+        ASSERT_TRUE(gate.emplace(Trade{ t, 1, {} }));
+    }
+
+    EXPECT_EQ(task.poll(), 6u);
+    EXPECT_EQ(std::get<0>(last), 4);        // 50, 140, 55, 130; 20 left the window, 39 arrived late
+    EXPECT_EQ(task.window().late(), 1u);
+}
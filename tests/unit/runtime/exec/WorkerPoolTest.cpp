@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <exec/cpu_affinity.h>
+#include <exec/operator_task.h>
+#include <exec/worker_pool.h>
+
+#include <channels/InMemoryChannel.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace lute::runtime::exec;
+using namespace lute::tm::channels;
+
+namespace {
+
+WorkerPoolOptions workers(std::size_t count, std::vector<int> cpus = {}) {
+    WorkerPoolOptions options;
+    options.worker_threads = count;
+    options.worker_cpus = std::move(cpus);
+    return options;
+}
+
+class CountingTask : public Task {
+public:
+    explicit CountingTask(std::size_t budget) : budget_(budget) {}
+
+    std::size_t poll() override {
+        polls.fetch_add(1, std::memory_order_relaxed);
+        if (budget_ == 0) return 0;
+        --budget_;
+        return 1;
+    }
+
+    std::atomic<std::uint64_t> polls{0};
+
+private:
+    std::size_t budget_;
+};
+
+template<typename Predicate>
+bool eventually(Predicate predicate, std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+// ============================================================================
+// Configuration Tests
+// ============================================================================
+
+TEST(WorkerPoolTest, RejectsZeroWorkers) {
+    EXPECT_THROW(WorkerPool(workers(0)), std::runtime_error);
+}
+
+TEST(WorkerPoolTest, RejectsTooFewCpus) {
+    EXPECT_THROW(WorkerPool(workers(2, {0})), std::runtime_error);
+}
+
+TEST(WorkerPoolTest, PinsCurrentThread) {
+    const std::vector<int> original = current_thread_affinity();
+    ASSERT_FALSE(original.empty());
+
+    std::thread([&]() {
+        pin_current_thread({original.front()});
+        EXPECT_EQ(current_thread_affinity(), std::vector<int>{original.front()});
+    }).join();
+}
+
+// ============================================================================
+// Execution Tests
+// ============================================================================
+
+TEST(WorkerPoolTest, PollsAssignedTasksAndCountsUtilization) {
+    WorkerPool pool(workers(2));
+    CountingTask first(100);
+    CountingTask second(0);
+    pool.assign(0, first);
+    pool.assign(1, second);
+
+    pool.start();
+    ASSERT_TRUE(eventually([&]() { return pool.utilization(0).work_items == 100; }));
+    ASSERT_TRUE(eventually([&]() { return second.polls.load() > 0; }));
+    pool.stop();
+
+    const WorkerUtilization busy = pool.utilization(0);
+    EXPECT_EQ(busy.busy_polls, 100);
+    EXPECT_GT(busy.idle_polls, 0);
+    EXPECT_GT(busy.utilization(), 0.0);
+
+    EXPECT_EQ(pool.utilization(1).work_items, 0);
+    EXPECT_EQ(pool.utilization(1).utilization(), 0.0);
+}
+
+TEST(WorkerPoolTest, IdleWorkerParksAndNotifyWakesIt) {
+    WorkerPoolOptions options = workers(1);
+    options.backoff = BackoffPolicy{ .spin_iterations = 1, .pause_iterations = 1,
+                                     .park_timeout = std::chrono::seconds(10) };
+    WorkerPool pool(options);
+    CountingTask task(0);
+    pool.assign(0, task);
+
+    pool.start();
+    ASSERT_TRUE(eventually([&]() { return pool.utilization(0).parks > 0; }));
+
+    const std::uint64_t polls = task.polls.load();
+    pool.notify(0);
+    EXPECT_TRUE(eventually([&]() { return task.polls.load() > polls; }, std::chrono::seconds(2)));
+
+    pool.stop();
+    pool.stop();
+}
+
+TEST(WorkerPoolTest, OperatorTaskMovesFramedRecords) {
+    constexpr std::uint64_t NUM_RECORDS = 5000;
+
+    InMemoryChannel input(4096);
+    InMemoryChannel output(4096);
+
+    auto doubler = [](std::span<const std::byte> payload, FramedWriter<InMemoryChannel>& out) {
+        std::uint64_t value;
+        std::memcpy(&value, payload.data(), sizeof(value));
+        std::span<std::byte> slot = out.allocate(sizeof(value));
+        if (slot.data() == nullptr) return false;
+        value *= 2;
+        std::memcpy(slot.data(), &value, sizeof(value));
+        out.commit();
+        return true;
+    };
+
+    OperatorTask task(input, output, doubler, BatchPolicy{ .maxRecords = 16, .maxBytes = 1024,
+                                                           .maxDelay = std::chrono::microseconds(10) });
+
+    WorkerPool pool(workers(1));
+    pool.assign(0, task);
+    pool.start();
+
+    std::thread producer([&]() {
+        FramedWriter<InMemoryChannel> writer(input, BatchPolicy{ .maxRecords = 8, .maxBytes = 512, .maxDelay = {} });
+        for (std::uint64_t i = 0; i < NUM_RECORDS; ++i) {
+            const std::span<const std::byte> bytes{ reinterpret_cast<const std::byte*>(&i), sizeof(i) };
+            while (!writer.append(bytes)) std::this_thread::yield();
+        }
+        writer.flush();
+    });
+
+    FramedReader<InMemoryChannel> reader(output);
+    std::uint64_t expected = 0;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (expected < NUM_RECORDS && std::chrono::steady_clock::now() < deadline) {
+        FrameBatch batch = reader.fetch();
+        for (Frame frame : batch) {
+            std::uint64_t value;
+            std::memcpy(&value, frame.payload.data(), sizeof(value));
+            ASSERT_EQ(value, expected * 2);
+            ++expected;
+        }
+        reader.release(batch);
+    }
+
+    producer.join();
+    pool.stop();
+    EXPECT_EQ(expected, NUM_RECORDS);
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <logging/log.h>
+#include <logging/backends/log_backend.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lute::runtime::logging;
+
+namespace {
+
+struct Captured {
+    std::mutex mutex;
+    std::vector<std::string> lines;
+    std::atomic<bool> hold{false};      // stalls the formatter inside write while set
+
+    std::vector<std::string> snapshot() {
+        std::lock_guard lock(mutex);
+        return lines;
+    }
+};
+
+class CapturingBackend final : public LogBackend {
+public:
+    explicit CapturingBackend(std::shared_ptr<Captured> captured) : captured_(std::move(captured)) {}
+
+    void write(std::string_view line) override {
+        while (captured_->hold.load()) std::this_thread::yield();
+        std::lock_guard lock(captured_->mutex);
+        captured_->lines.emplace_back(line);
+    }
+
+    void flush() override {}
+
+private:
+    std::shared_ptr<Captured> captured_;
+};
+
+enum class Phase : std::uint8_t { Warmup = 3 };
+
+} // namespace
+
+class LogFrontendTest : public ::testing::Test {
+protected:
+    void start(LogConfig logConfig = {}) {
+        logConfig.flush_interval_ms = 1;
+        start_logging(logConfig, std::make_unique<CapturingBackend>(captured));
+    }
+
+    void TearDown() override {
+        stop_logging();
+    }
+
+    std::shared_ptr<Captured> captured = std::make_shared<Captured>();
+};
+
+#if defined(RUNTIME_LOGGING_ENABLED)
+
+namespace {
+
+LogConfig config(LogLevel level, std::size_t ringBytes = LogConfig{}.ring_bytes) {
+    LogConfig config;
+    config.level = level;
+    config.ring_bytes = ringBytes;
+    return config;
+}
+
+} // namespace
+
+// ============================================================================
+// Formatting Tests
+// ============================================================================
+
+TEST_F(LogFrontendTest, FormatsBinaryRecordsOffTheHotPath) {
+    start();
+
+    const std::string name = "map";
+    RUNTIME_LOG_INFO("operator {} processed {} records in {}s ({}) phase {}", name, 42, 0.5, true, Phase::Warmup);
+    stop_logging();
+
+    const std::vector<std::string> lines = captured->snapshot();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("INFO"), std::string::npos) << lines[0];
+    EXPECT_NE(lines[0].find("LogFrontendTest.cpp:"), std::string::npos) << lines[0];
+    EXPECT_NE(lines[0].find("operator map processed 42 records in 0.5s (true) phase 3\n"), std::string::npos) << lines[0];
+}
+
+TEST_F(LogFrontendTest, LevelBelowThresholdIsSkipped) {
+    start(config(LogLevel::Warn));
+
+    int evaluated = 0;
+    RUNTIME_LOG_INFO("skipped {}", ++evaluated);
+    RUNTIME_LOG_ERROR("kept {}", 7);
+    stop_logging();
+
+    EXPECT_EQ(evaluated, 0);
+    const std::vector<std::string> lines = captured->snapshot();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("kept 7"), std::string::npos);
+}
+
+TEST_F(LogFrontendTest, NothingIsRecordedBeforeStart) {
+    RUNTIME_LOG_ERROR("before start");
+    start();
+    stop_logging();
+    EXPECT_TRUE(captured->snapshot().empty());
+}
+
+// ============================================================================
+// Ring Tests
+// ============================================================================
+
+TEST_F(LogFrontendTest, FullRingDropsAndCounts) {
+    start(config(LogLevel::Info, 1024));
+    const LogStats before = log_stats();
+
+    std::thread([&]() {
+        ASSERT_TRUE(attach_current_thread());
+
+        RUNTIME_LOG_INFO("first");
+        while (captured->snapshot().empty()) std::this_thread::yield();
+
+        captured->hold = true;
+        RUNTIME_LOG_INFO("stalls the formatter");
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        for (int i = 0; i < 1000; ++i) {
+            RUNTIME_LOG_INFO("record {}", i);
+        }
+        captured->hold = false;
+    }).join();
+
+    stop_logging();
+    const LogStats after = log_stats();
+    EXPECT_GT(after.dropped - before.dropped, 0u);
+    EXPECT_LT(after.written - before.written, 1002u);
+
+    const std::vector<std::string> lines = captured->snapshot();
+    const bool reported = std::any_of(lines.begin(), lines.end(), [](const std::string& line) {
+        return line.find("log ring overflow") != std::string::npos;
+    });
+    EXPECT_TRUE(reported);
+}
+
+TEST_F(LogFrontendTest, ThreadsKeepPerThreadOrder) {
+    constexpr int NUM_THREADS = 4;
+    constexpr int NUM_RECORDS = 2000;
+    start(config(LogLevel::Info, 1 << 20));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                RUNTIME_LOG_INFO("thread {} seq {}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    stop_logging();
+
+    std::vector<int> next(NUM_THREADS, 0);
+    for (const std::string& line : captured->snapshot()) {
+        int t, seq;
+        const std::size_t at = line.find("thread ");
+        ASSERT_NE(at, std::string::npos);
+        ASSERT_EQ(std::sscanf(line.c_str() + at, "thread %d seq %d", &t, &seq), 2);
+        ASSERT_EQ(seq, next[static_cast<std::size_t>(t)]++);
+    }
+    for (const int count : next) EXPECT_EQ(count, NUM_RECORDS);
+}
+
+#else
+
+TEST_F(LogFrontendTest, CallsCompileOut) {
+    start();
+
+    int evaluated = 0;
+    RUNTIME_LOG_ERROR("compiled out {}", ++evaluated);
+    stop_logging();
+
+    EXPECT_EQ(evaluated, 0);
+    EXPECT_TRUE(captured->snapshot().empty());
+}
+
+#endif
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <metrics/metrics_registry.h>
+#include <metrics/metrics_reporter.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace lute::runtime::metrics;
+using lute::tm::metrics::ChannelMetrics;
+using lute::tm::metrics::FlowMetrics;
+using lute::tm::metrics::GateMetrics;
+
+class MetricsRegistryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        registry.add_channel("source->map", channel);
+        registry.add_gate("map.in", gate);
+        registry.add_edge("map->sink", edge);
+    }
+
+    ChannelMetrics channel;
+    GateMetrics gate;
+    FlowMetrics edge;
+    MetricsRegistry registry;
+};
+
+// ============================================================================
+// Snapshot Tests
+// ============================================================================
+
+TEST_F(MetricsRegistryTest, IntervalSubtractsEarlierSnapshot) {
+    channel.bytesIn.add(100);
+    channel.latencyNs.record(500);
+    const MetricsSnapshot first = registry.snapshot();
+
+    channel.bytesIn.add(50);
+    channel.latencyNs.record(2000);
+    gate.recordsIn.add(3);
+    const MetricsSnapshot interval = registry.snapshot().since(first);
+
+    ASSERT_EQ(interval.channels.size(), 1u);
+    EXPECT_EQ(interval.channels[0].name, "source->map");
+    EXPECT_EQ(interval.channels[0].bytes_in, 50u);
+    EXPECT_EQ(interval.channels[0].latency_ns.count(), 1u);
+    EXPECT_GE(interval.channels[0].latency_ns.percentile(0.5), 2000u - 2000u / 32);
+    EXPECT_EQ(interval.gates[0].records_in, 3u);
+    EXPECT_GE(interval.interval_ns, 0u);
+}
+
+TEST_F(MetricsRegistryTest, RendersJsonAndText) {
+    channel.fullStalls.add(2);
+    gate.emptyStalls.add(5);
+    edge.shedRecords.add(3);
+    edge.stallNs.record(1000);
+    const MetricsSnapshot snapshot = registry.snapshot();
+
+    const std::string json = render_json(snapshot);
+    EXPECT_EQ(json.find('\n'), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"source->map\""), std::string::npos);
+    EXPECT_NE(json.find("\"full_stalls\":2"), std::string::npos);
+    EXPECT_NE(json.find("\"gates\":[{\"name\":\"map.in\""), std::string::npos);
+    EXPECT_NE(json.find("\"p999\":"), std::string::npos);
+    EXPECT_NE(json.find("\"edges\":[{\"name\":\"map->sink\""), std::string::npos);
+    EXPECT_NE(json.find("\"shed\":3"), std::string::npos);
+    EXPECT_NE(json.find("\"stall_time_ns\":1000"), std::string::npos);
+
+    const std::string text = render_text(snapshot);
+    EXPECT_NE(text.find("channel source->map:"), std::string::npos);
+    EXPECT_NE(text.find("gate map.in:"), std::string::npos);
+    EXPECT_NE(text.find("empty_stalls=5"), std::string::npos);
+    EXPECT_NE(text.find("edge map->sink:"), std::string::npos);
+}
+
+// ============================================================================
+// Reporter Tests
+// ============================================================================
+
+TEST_F(MetricsRegistryTest, ReporterAppendsPeriodicSnapshots) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "lute_metrics_reporter_test.jsonl";
+    std::filesystem::remove(path);
+
+    {
+        MetricsReporter reporter(registry, MetricsConfig{ .interval_ms = 5, .path = path.string(), .format = MetricsFormat::Json });
+        reporter.start();
+        channel.bytesIn.add(10);
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        reporter.stop();
+    }
+
+    std::ifstream in(path);
+    std::string line;
+    std::size_t lines = 0;
+    std::uint64_t bytes = 0;
+    while (std::getline(in, line)) {
+        ++lines;
+        const std::size_t at = line.find("\"bytes_in\":");
+        ASSERT_NE(at, std::string::npos);
+        bytes += std::stoull(line.substr(at + 11));
+    }
+    std::filesystem::remove(path);
+
+    EXPECT_GE(lines, 2u);
+    EXPECT_EQ(bytes, 10u);      // intervals never double count
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <numa/topology.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+using namespace lute::runtime::numa;
+
+namespace fs = std::filesystem;
+
+class TopologyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        root = fs::temp_directory_path() /
+               ("lute_topology_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + "_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::create_directories(root);
+    }
+
+    void TearDown() override {
+        fs::remove_all(root);
+    }
+
+    void writeFile(const fs::path& relative, const std::string& content) {
+        fs::create_directories((root / relative).parent_path());
+        std::ofstream(root / relative) << content;
+    }
+
+    void addNode(int id, const std::string& cpulist, const std::string& distance) {
+        const std::string dir = "node" + std::to_string(id);
+        writeFile(dir + "/cpulist", cpulist + "\n");
+        writeFile(dir + "/distance", distance + "\n");
+    }
+
+    fs::path root;
+};
+
+// ============================================================================
+// CPU List Parsing Tests
+// ============================================================================
+
+TEST(CpuListTest, ParsesRangesAndSingles) {
+    EXPECT_EQ(parse_cpu_list("0-3,8,10-11\n"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(parse_cpu_list("5"), (std::vector<int>{5}));
+    EXPECT_TRUE(parse_cpu_list("").empty());
+}
+
+TEST(CpuListTest, RejectsMalformedInput) {
+    EXPECT_THROW(parse_cpu_list("0-"), std::runtime_error);
+    EXPECT_THROW(parse_cpu_list("a"), std::runtime_error);
+    EXPECT_THROW(parse_cpu_list("4-2"), std::runtime_error);
+}
+
+// ============================================================================
+// Sysfs Detection Tests
+// ============================================================================
+
+TEST_F(TopologyTest, DetectsDualSocketLayout) {
+    addNode(1, "8-15,24-31", "21 10");
+    addNode(0, "0-7,16-23", "10 21");
+    writeFile("node1/hugepages/hugepages-2048kB/free_hugepages", "512\n");
+    writeFile("possible", "0-1\n");
+
+    const Topology topology = detect_topology(root);
+
+    ASSERT_EQ(topology.nodes.size(), 2);
+    EXPECT_TRUE(topology.is_numa());
+    EXPECT_EQ(topology.nodes[0].id, 0);
+    EXPECT_EQ(topology.nodes[1].id, 1);
+    EXPECT_EQ(topology.nodes[0].cpus.size(), 16);
+    EXPECT_EQ(topology.nodes[1].distances, (std::vector<int>{21, 10}));
+    EXPECT_EQ(topology.nodes[0].free_huge_pages, 0);
+    EXPECT_EQ(topology.nodes[1].free_huge_pages, 512);
+
+    EXPECT_EQ(topology.node_of_cpu(3), 0);
+    EXPECT_EQ(topology.node_of_cpu(26), 1);
+    EXPECT_EQ(topology.node_of_cpu(99), -1);
+    ASSERT_NE(topology.find_node(1), nullptr);
+    EXPECT_EQ(topology.find_node(2), nullptr);
+}
+
+TEST_F(TopologyTest, FallsBackToSingleNodeWithoutSysfs) {
+    const Topology topology = detect_topology(root / "missing");
+
+    ASSERT_EQ(topology.nodes.size(), 1);
+    EXPECT_FALSE(topology.is_numa());
+    EXPECT_EQ(topology.node_of_cpu(0), 0);
+}
+
+TEST_F(TopologyTest, RejectsCorruptCpuList) {
+    addNode(0, "0-x", "10");
+    EXPECT_THROW(detect_topology(root), std::runtime_error);
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <replay/replay_log.h>
+#include <replay/Replayer.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lute::runtime::replay;
+using lute::tm::replay::Recorder;
+using lute::tm::replay::Replayer;
+
+namespace {
+
+/**
+ * Replay log path that is removed again with the test
+ */
+class ReplayLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto* test = ::testing::UnitTest::GetInstance()->current_test_info();
+        path_ = std::filesystem::temp_directory_path() / ("lute-replay-" + std::to_string(::getpid()) + "-" + test->name() + ".log");
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path_);
+    }
+
+    std::string path() const { return path_.string(); }
+
+private:
+    std::filesystem::path path_;
+};
+
+std::span<const std::byte> asBytes(const std::uint64_t& value) {
+    return { reinterpret_cast<const std::byte*>(&value), sizeof(value) };
+}
+
+/**
+ * Values of the records in \p stream, in order
+ */
+std::vector<std::uint64_t> replayValues(const std::vector<std::byte>& stream) {
+    std::vector<std::uint64_t> values;
+    Replayer replayer(stream);
+    replayer.poll(
+        [&](std::size_t, std::uint64_t, std::span<const std::byte> payload) {
+            std::uint64_t value;
+            std::memcpy(&value, payload.data(), sizeof(value));
+            values.push_back(value);
+            return true;
+        },
+        [](std::size_t, std::uint64_t) {},
+        [](std::size_t, std::uint64_t) {});
+    return values;
+}
+
+} // namespace
+
+TEST_F(ReplayLogTest, KeepsStreamsOfConcurrentRecordersApart) {
+    constexpr std::uint64_t RECORDS = 20'000;
+    {
+        ReplayLogWriter writer(path());
+        writer.start();
+
+        std::vector<std::thread> operators;
+        for (StreamId stream = 0; stream < 3; ++stream) {
+            operators.emplace_back([&writer, stream]() {
+                Recorder<> recorder(writer.sink(stream), 4096);
+                for (std::uint64_t i = 0; i < RECORDS; ++i) {
+                    recorder.tick();
+                    const std::uint64_t value = stream * RECORDS + i;
+                    recorder.record(0, asBytes(value));
+                }
+                recorder.flush();
+            });
+        }
+        for (std::thread& t : operators) t.join();
+
+        writer.stop();
+        EXPECT_EQ(writer.stats().failed, 0u);
+        EXPECT_GT(writer.stats().chunks, 3u);
+    }
+
+    const auto streams = read_replay_log(path());
+    ASSERT_EQ(streams.size(), 3u);
+    for (const auto& [stream, events] : streams) {
+        const std::vector<std::uint64_t> values = replayValues(events);
+        ASSERT_EQ(values.size(), RECORDS) << "stream " << stream;
+        for (std::uint64_t i = 0; i < RECORDS; ++i) ASSERT_EQ(values[i], stream * RECORDS + i);
+    }
+}
+
+TEST_F(ReplayLogTest, DropsChunkCutShortByACrash) {
+    {
+        ReplayLogWriter writer(path());
+        writer.start();
+        Recorder<> recorder(writer.sink(7), 4096);
+        for (std::uint64_t i = 0; i < 2000; ++i) recorder.record(0, asBytes(i));
+        recorder.flush();
+        writer.stop();
+    }
+
+    const auto whole = read_replay_log(path());
+    std::filesystem::resize_file(path(), std::filesystem::file_size(path()) - 10);
+
+    const auto cut = read_replay_log(path());
+    ASSERT_EQ(cut.count(7), 1u);
+    EXPECT_LT(cut.at(7).size(), whole.at(7).size());
+
+    const std::vector<std::uint64_t> values = replayValues(cut.at(7));
+    ASSERT_FALSE(values.empty());
+    for (std::size_t i = 0; i < values.size(); ++i) ASSERT_EQ(values[i], i);
+}
+
+TEST_F(ReplayLogTest, RejectsFilesThatAreNotReplayLogs) {
+    std::ofstream(path()) << "definitely not a replay log";
+
+    EXPECT_THROW(read_replay_log(path()), std::runtime_error);
+    EXPECT_THROW(read_replay_log(path() + ".missing"), std::runtime_error);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <tracing/trace_dump.h>
+
+#include <channels/InMemoryChannel.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace lute::core::trace;
+using namespace lute::runtime::tracing;
+
+namespace {
+
+constexpr TraceSite OUTER{ "test", "outer" };
+constexpr TraceSite INNER{ "test", "inner" };
+
+/**
+ * @brief Runs \p body on a fresh thread and returns that thread's trace
+ */
+template<typename Body>
+ThreadTrace traceOf(Body body) {
+    std::int64_t tid = 0;
+    std::thread([&]() {
+        attach_current_thread();
+        tid = t_ring->tid;
+        body();
+    }).join();
+
+    for (ThreadTrace& trace : snapshot()) {
+        if (trace.tid == tid) return trace;
+    }
+    return {};
+}
+
+} // namespace
+
+// ============================================================================
+// Recording Tests
+// ============================================================================
+
+TEST(TraceDumpTest, ScopesRecordCompleteEvents) {
+    const ThreadTrace trace = traceOf([]() {
+        const TraceScope outer(OUTER);
+        { const TraceScope inner(INNER); }
+        { const TraceScope inner(INNER); }
+    });
+
+    ASSERT_EQ(trace.events.size(), 3u);
+    EXPECT_EQ(trace.events[0].site, &INNER);
+    EXPECT_EQ(trace.events[1].site, &INNER);
+    EXPECT_EQ(trace.events[2].site, &OUTER);
+
+    for (const TraceEvent& event : trace.events) EXPECT_LE(event.begin, event.end);
+    EXPECT_LE(trace.events[2].begin, trace.events[0].begin);
+    EXPECT_GE(trace.events[2].end, trace.events[1].end);
+}
+
+TEST(TraceDumpTest, RingKeepsNewestEvents) {
+    set_ring_events(8);
+    const ThreadTrace trace = traceOf([]() {
+        for (std::uint64_t i = 0; i < 20; ++i) record(OUTER, i, i + 1);
+    });
+    set_ring_events(64 * 1024);
+
+    // The slot the writer would fill next is never trusted, so a full ring yields capacity - 1 events
+    ASSERT_EQ(trace.events.size(), 7u);
+    for (std::size_t i = 0; i < trace.events.size(); ++i) {
+        EXPECT_EQ(trace.events[i].begin, 13 + i);
+    }
+}
+
+TEST(TraceDumpTest, ChannelTracePointsFollowBuildFlag) {
+    const ThreadTrace trace = traceOf([]() {
+        lute::tm::channels::InMemoryChannel channel(64);
+        const std::uint64_t value = 1;
+        std::uint64_t out = 0;
+        channel.send(&value, sizeof(value));
+        channel.receive(&out, sizeof(out));
+    });
+
+    const auto named = [&](std::string_view name) {
+        return std::count_if(trace.events.begin(), trace.events.end(),
+                             [&](const TraceEvent& event) { return name == event.site->name; });
+    };
+
+#if defined(CORE_TRACING_ENABLED)
+    EXPECT_EQ(named("InMemoryChannel::send"), 1);
+    EXPECT_EQ(named("InMemoryChannel::receive"), 1);
+#else
+    EXPECT_TRUE(trace.events.empty());
+    EXPECT_EQ(named("InMemoryChannel::send"), 0);
+#endif
+}
+
+// ============================================================================
+// Dump Tests
+// ============================================================================
+
+TEST(TraceDumpTest, WritesChromeTraceEvents) {
+    const ThreadTrace trace{ 42, "lute-worker-0", { { &OUTER, 1000, 3000 } } };
+
+    std::ostringstream out;
+    out.precision(3);
+    out << std::fixed;
+    write_chrome_trace(out, { trace }, 1000.0, 0);
+
+    const std::string json = out.str();
+    EXPECT_NE(json.find("\"traceEvents\":["), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"M\",\"name\":\"thread_name\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"lute-worker-0\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\",\"name\":\"outer\",\"cat\":\"test\""), std::string::npos);
+    EXPECT_NE(json.find("\"tid\":42,\"ts\":1.000,\"dur\":2.000"), std::string::npos) << json;
+}
+
+TEST(TraceDumpTest, DumpTraceWritesFile) {
+    traceOf([]() { const TraceScope scope(OUTER); });
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "lute_trace_dump_test.json";
+    dump_trace(path.string());
+
+    std::ifstream in(path);
+    const std::string json{ std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\"", 0), 0u);
+    EXPECT_NE(json.find("\"name\":\"outer\""), std::string::npos);
+}
+
+TEST(TraceDumpTest, DumpRequestIsTakenOnce) {
+    EXPECT_FALSE(take_trace_dump_request());
+    request_trace_dump();
+    EXPECT_TRUE(take_trace_dump_request());
+    EXPECT_FALSE(take_trace_dump_request());
+}
@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <transport/tcp_transport.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace lute::runtime::transport;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::size_t SMALL_RING = 64 * 1024;
+
+TransportOptions options(const std::size_t ring_bytes = SMALL_RING) {
+    return TransportOptions{ .io_threads = 1, .io_cpus = {}, .ring_bytes = ring_bytes, .max_write_bytes = 256 * 1024 };
+}
+
+std::byte pattern(const std::size_t i) {
+    return static_cast<std::byte>((i * 131 + (i >> 11)) & 0xff);
+}
+
+/**
+ * Sends \p total pattern bytes in chunks of varying size, retrying short sends, then closes the edge
+ */
+void sendPattern(OutboundEdge& edge, const std::size_t total) {
+    std::vector<std::byte> chunk(7919);
+    std::size_t sent = 0;
+    std::size_t round = 0;
+
+    while (sent < total) {
+        const std::size_t size = std::min(total - sent, 1 + (round++ * 2654435761u) % chunk.size());
+        for (std::size_t i = 0; i < size; ++i) chunk[i] = pattern(sent + i);
+
+        std::size_t offset = 0;
+        while (offset < size) {
+            const std::size_t n = edge.send(chunk.data() + offset, size - offset);
+            if (n == 0) std::this_thread::yield();
+            offset += n;
+        }
+        sent += size;
+    }
+    edge.close();
+}
+
+/**
+ * Receives until the edge reports closed, or gives up after \p timeout
+ */
+std::vector<std::byte> receiveAll(InboundEdge& edge, const std::chrono::seconds timeout = 20s) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::vector<std::byte> received;
+    std::vector<std::byte> buffer(16 * 1024);
+
+    while (!edge.closed() && std::chrono::steady_clock::now() < deadline) {
+        const std::size_t n = edge.receive(buffer.data(), buffer.size());
+        if (n == 0) std::this_thread::yield();
+        received.insert(received.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(n));
+    }
+    return received;
+}
+
+bool isPattern(const std::vector<std::byte>& bytes) {
+    for (std::size_t i = 0; i < bytes.size(); ++i) {
+        if (bytes[i] != pattern(i)) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+// ============================================================================
+// Loopback Stream Tests
+// ============================================================================
+
+TEST(TcpTransportTest, StreamArrivesInOrderAndCloses) {
+    constexpr std::size_t TOTAL = 8 << 20;
+
+    TcpTransport server(options());
+    TcpTransport client(options());
+
+    const std::uint16_t port = server.listen("127.0.0.1", 0);
+    ASSERT_NE(port, 0);
+
+    std::unique_ptr<OutboundEdge> out = client.connect("127.0.0.1", port, 1);
+    std::unique_ptr<InboundEdge> in = server.accept(1, 5000ms);
+    ASSERT_NE(in, nullptr);
+
+    std::thread producer([&]() { sendPattern(*out, TOTAL); });
+    const std::vector<std::byte> received = receiveAll(*in);
+    producer.join();
+
+    ASSERT_EQ(received.size(), TOTAL);
+    EXPECT_TRUE(isPattern(received));
+    EXPECT_TRUE(in->closed());
+    EXPECT_TRUE(out->drained());
+    EXPECT_FALSE(out->failed());
+
+    EXPECT_EQ(client.stats().bytes_sent, TOTAL);
+    EXPECT_EQ(server.stats().bytes_received, TOTAL);
+}
+
+TEST(TcpTransportTest, EdgesWithinOneTransportStayApart) {
+    TcpTransport transport(options());
+    const std::uint16_t port = transport.listen("127.0.0.1", 0);
+
+    const std::vector<EdgeId> edges{7, 3, 5};
+    for (const EdgeId edge : edges) {
+        std::unique_ptr<OutboundEdge> out = transport.connect("127.0.0.1", port, edge);
+        ASSERT_EQ(out->send(&edge, sizeof(edge)), sizeof(edge));
+        // Destroying the edge closes it once the id is on the wire
+    }
+
+    for (const EdgeId edge : { EdgeId{5}, EdgeId{3}, EdgeId{7} }) {
+        std::unique_ptr<InboundEdge> in = transport.accept(edge, 5000ms);
+        ASSERT_NE(in, nullptr) << edge;
+
+        const std::vector<std::byte> received = receiveAll(*in);
+        ASSERT_EQ(received.size(), sizeof(EdgeId));
+
+        EdgeId payload;
+        std::memcpy(&payload, received.data(), sizeof(payload));
+        EXPECT_EQ(payload, edge);
+    }
+}
+
+TEST(TcpTransportTest, InboundEdgeSeesNothingBeforeTheSenderWrites) {
+    TcpTransport transport(options());
+    const std::uint16_t port = transport.listen("127.0.0.1", 0);
+
+    std::unique_ptr<OutboundEdge> out = transport.connect("127.0.0.1", port, 1);
+    std::unique_ptr<InboundEdge> in = transport.accept(1, 5000ms);
+    ASSERT_NE(in, nullptr);
+
+    std::byte buffer[16];
+    EXPECT_EQ(in->receive(buffer, sizeof(buffer)), 0u);
+    EXPECT_FALSE(in->closed());
+    EXPECT_EQ(in->send(buffer, sizeof(buffer)), 0u);
+    EXPECT_EQ(out->receive(buffer, sizeof(buffer)), 0u);
+}
+
+// ============================================================================
+// Backpressure Tests
+// ============================================================================
+
+/**
+ * A receiver that does not read fills its ring, then both socket buffers, then the sender's ring: sends
+ * start returning 0 instead of buffering without bound. Everything is delivered once the receiver reads.
+ */
+TEST(TcpTransportTest, StalledReceiverPushesBackOnSender) {
+    constexpr std::size_t LIMIT = 512 << 20;
+
+    TcpTransport transport(options(4096));
+    const std::uint16_t port = transport.listen("127.0.0.1", 0);
+
+    std::unique_ptr<OutboundEdge> out = transport.connect("127.0.0.1", port, 1);
+    std::unique_ptr<InboundEdge> in = transport.accept(1, 5000ms);
+    ASSERT_NE(in, nullptr);
+
+    std::vector<std::byte> chunk(64 * 1024);
+    std::size_t sent = 0;
+    auto refused_since = std::chrono::steady_clock::now();
+    bool refused = false;
+
+    while (sent < LIMIT) {
+        for (std::size_t i = 0; i < chunk.size(); ++i) chunk[i] = pattern(sent + i);
+        const std::size_t n = out->send(chunk.data(), chunk.size());
+        sent += n;
+
+        if (n != 0) {
+            refused_since = std::chrono::steady_clock::now();
+        } else if (std::chrono::steady_clock::now() - refused_since > 200ms) {
+            refused = true;
+            break;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    ASSERT_TRUE(refused) << "sender accepted " << sent << " bytes without a reader";
+    out->close();
+
+    const std::vector<std::byte> received = receiveAll(*in);
+    ASSERT_EQ(received.size(), sent);
+    EXPECT_TRUE(isPattern(received));
+}
+
+// ============================================================================
+// Setup Tests
+// ============================================================================
+
+TEST(TcpTransportTest, AcceptTimesOutForAnEdgeThatNeverConnects) {
+    TcpTransport transport(options());
+    transport.listen("127.0.0.1", 0);
+
+    EXPECT_EQ(transport.accept(42, 20ms), nullptr);
+}
+
+TEST(TcpTransportTest, ConnectWithoutListenerThrows) {
+    TcpTransport transport(options());
+
+    // Bind a port, then stop listening on it by letting the transport go
+    std::uint16_t port;
+    {
+        TcpTransport listener(options());
+        port = listener.listen("127.0.0.1", 0);
+    }
+
+    EXPECT_THROW(transport.connect("127.0.0.1", port, 1), std::runtime_error);
+}
+
+TEST(TcpTransportTest, RejectsUnusableOptions) {
+    TransportOptions no_threads = options();
+    no_threads.io_threads = 0;
+    EXPECT_THROW(TcpTransport{no_threads}, std::runtime_error);
+
+    EXPECT_THROW(TcpTransport{options(1000)}, std::runtime_error);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <channels/CachedInMemoryChannel.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+using namespace lute::tm::channels;
+
+class CachedInMemoryChannelTest : public ::testing::Test {
+protected:
+    static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+    CachedInMemoryChannel channel{DEFAULT_CAPACITY};
+};
+
+// ============================================================================
+// Cached Index Refresh Tests
+// ============================================================================
+
+TEST_F(CachedInMemoryChannelTest, SendAndReceiveRoundTrip) {
+    std::array<int, 4> sent{1, 2, 3, 4};
+    EXPECT_EQ(channel.send(sent.data(), sizeof(sent)), sizeof(sent));
+
+    std::array<int, 4> received{};
+    EXPECT_EQ(channel.receive(received.data(), sizeof(received)), sizeof(received));
+    EXPECT_EQ(received, sent);
+}
+
+TEST_F(CachedInMemoryChannelTest, ConsumerRefreshesStaleWriteIndex) {
+    int value = 1;
+    channel.send(&value, sizeof(value));
+    EXPECT_EQ(channel.peek(sizeof(value)).size(), sizeof(value));
+
+    // The consumer's cached copy only covers the first record; asking for more must refresh it
+    channel.send(&value, sizeof(value));
+    EXPECT_EQ(channel.peek(2 * sizeof(value)).size(), 2 * sizeof(value));
+}
+
+TEST_F(CachedInMemoryChannelTest, ProducerRefreshesStaleReadIndex) {
+    std::vector<std::byte> data(DEFAULT_CAPACITY);
+    ASSERT_EQ(channel.send(data.data(), data.size()), DEFAULT_CAPACITY);
+    EXPECT_EQ(channel.send(data.data(), 1), 0);
+
+    channel.receive(data.data(), 100);
+    EXPECT_EQ(channel.send(data.data(), 100), 100);
+    EXPECT_EQ(channel.send(data.data(), 1), 0);
+}
+
+TEST_F(CachedInMemoryChannelTest, WrapAroundPreservesBytes) {
+    std::vector<std::byte> filler(DEFAULT_CAPACITY - 30);
+    channel.send(filler.data(), filler.size());
+    channel.receive(filler.data(), filler.size());
+
+    std::vector<std::byte> payload(100);
+    for (std::size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = std::byte{static_cast<unsigned char>(i)};
+    }
+    ASSERT_EQ(channel.send(payload.data(), payload.size()), payload.size());
+
+    ReadableRegion region = channel.peek(payload.size());
+    EXPECT_EQ(region.first.size(), 30);
+    EXPECT_EQ(region.second.size(), 70);
+
+    std::vector<std::byte> received(payload.size());
+    EXPECT_EQ(channel.receive(received.data(), received.size()), received.size());
+    EXPECT_EQ(received, payload);
+}
+
+// ============================================================================
+// Concurrent Access Tests
+// ============================================================================
+
+TEST_F(CachedInMemoryChannelTest, SingleProducerSingleConsumer) {
+    constexpr std::size_t NUM_MESSAGES = 20000;
+
+    std::thread producer([&]() {
+        for (std::size_t i = 0; i < NUM_MESSAGES; ++i) {
+            while (channel.send(&i, sizeof(i)) == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::thread consumer([&]() {
+        for (std::size_t i = 0; i < NUM_MESSAGES; ++i) {
+            std::size_t val = 0;
+            std::size_t got = 0;
+            while (got < sizeof(val)) {
+                const std::size_t n = channel.receive(reinterpret_cast<std::byte*>(&val) + got, sizeof(val) - got);
+                if (n == 0) std::this_thread::yield();
+                got += n;
+            }
+            ASSERT_EQ(val, i);
+        }
+    });
+
+    producer.join();
+    consumer.join();
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <channels/CachedInMemoryChannel.h>
+#include <channels/ChannelAdapter.h>
+#include <channels/InMemoryChannel.h>
+#include <channels/MpscChannel.h>
+#include <channels/StaticInMemoryChannel.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+using namespace lute::tm::channels;
+
+// ============================================================================
+// Static Dispatch (L4) Tests
+// ============================================================================
+
+static_assert(ZeroCopyChannel<InMemoryChannel>);
+static_assert(ZeroCopyChannel<CachedInMemoryChannel>);
+static_assert(ZeroCopyChannel<StaticInMemoryChannel<1024>>);
+static_assert(ByteChannel<MpscChannel>);
+static_assert(!ZeroCopyChannel<MpscChannel>);
+
+// CRTP channels carry no vtable
+static_assert(!std::is_polymorphic_v<InMemoryChannel>);
+static_assert(!std::is_polymorphic_v<MpscChannel>);
+static_assert(!std::is_base_of_v<IChannel, InMemoryChannel>);
+
+namespace {
+
+template<ByteChannel C>
+std::uint64_t roundTrip(C& channel, std::uint64_t value) {
+    channel.send(&value, sizeof(value));
+
+    std::uint64_t out = 0;
+    channel.receive(&out, sizeof(out));
+    return out;
+}
+
+} // namespace
+
+TEST(ChannelDispatchTest, CrtpBaseForwardsToImplementation) {
+    InMemoryChannel channel(64);
+    Channel<InMemoryChannel>& base = channel;
+
+    EXPECT_EQ(roundTrip(base, 17), 17);
+    EXPECT_EQ(roundTrip(channel, 18), 18);
+}
+
+// ============================================================================
+// Type-Erased (L3) Adapter Tests
+// ============================================================================
+
+TEST(ChannelAdapterTest, AdaptsEveryChannelType) {
+    InMemoryChannel spsc(64);
+    CachedInMemoryChannel cached(64);
+    auto fixed = std::make_unique<StaticInMemoryChannel<64>>();
+    MpscChannel mpsc(8, 16);
+
+    ChannelAdapter<InMemoryChannel> a(spsc);
+    ChannelAdapter<CachedInMemoryChannel> b(cached);
+    ChannelAdapter<StaticInMemoryChannel<64>> c(*fixed);
+    ChannelAdapter<MpscChannel> d(mpsc);
+
+    IChannel* channels[] = { &a, &b, &c, &d };
+    std::uint64_t value = 100;
+    for (IChannel* channel : channels) {
+        ++value;
+        ASSERT_EQ(channel->send(&value, sizeof(value)), sizeof(value));
+
+        std::uint64_t out = 0;
+        ASSERT_EQ(channel->receive(&out, sizeof(out)), sizeof(out));
+        EXPECT_EQ(out, value);
+    }
+}
+
+TEST(ChannelAdapterTest, AdapterDoesNotOwnChannel) {
+    InMemoryChannel channel(64);
+    {
+        ChannelAdapter<InMemoryChannel> adapter(channel);
+        std::uint32_t value = 3;
+        adapter.send(&value, sizeof(value));
+        EXPECT_EQ(&adapter.channel(), &channel);
+    }
+
+    std::uint32_t out = 0;
+    EXPECT_EQ(channel.receive(&out, sizeof(out)), sizeof(out));
+    EXPECT_EQ(out, 3);
+}
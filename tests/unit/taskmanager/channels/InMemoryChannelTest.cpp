@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <channels/ChannelAdapter.h>
 #include <channels/InMemoryChannel.h>
 
 #include <array>
@@ -333,7 +334,8 @@ TEST_F(InMemoryChannelTest, ConcurrentStressTest) {
 // ============================================================================
 
 TEST_F(InMemoryChannelTest, WorksThroughIChannelInterface) {
-    IChannel* iface = channel.get();
+    ChannelAdapter<InMemoryChannel> adapter(*channel);
+    IChannel* iface = &adapter;
     
     int sent_value = 42;
     std::size_t sent = iface->send(&sent_value, sizeof(sent_value));
@@ -345,6 +347,143 @@ TEST_F(InMemoryChannelTest, WorksThroughIChannelInterface) {
     EXPECT_EQ(received_value, sent_value);
 }
 
+// ============================================================================
+// Zero-Copy Reserve/Publish and Peek/Release Tests
+// ============================================================================
+
+TEST_F(InMemoryChannelTest, ReservedBytesInvisibleUntilPublished) {
+    WritableRegion region = channel->reserve(16);
+    ASSERT_EQ(region.size(), 16);
+    EXPECT_TRUE(region.second.empty());
+
+    std::fill(region.first.begin(), region.first.end(), std::byte{7});
+    EXPECT_TRUE(channel->peek().empty());
+
+    channel->publish(16);
+
+    ReadableRegion readable = channel->peek();
+    ASSERT_EQ(readable.size(), 16);
+    for (std::byte b : readable.first) {
+        EXPECT_EQ(b, std::byte{7});
+    }
+}
+
+TEST_F(InMemoryChannelTest, PeekDoesNotConsume) {
+    int value = 42;
+    channel->send(&value, sizeof(value));
+
+    EXPECT_EQ(channel->peek().size(), sizeof(value));
+    EXPECT_EQ(channel->peek().size(), sizeof(value));
+
+    channel->release(sizeof(value));
+    EXPECT_TRUE(channel->peek().empty());
+}
+
+TEST_F(InMemoryChannelTest, ReserveClampsToFreeSpace) {
+    std::vector<std::byte> data(DEFAULT_CAPACITY - 10);
+    channel->send(data.data(), data.size());
+
+    EXPECT_EQ(channel->reserve(20).size(), 10);
+
+    channel->publish(10);
+    EXPECT_TRUE(channel->reserve(1).empty());
+}
+
+TEST_F(InMemoryChannelTest, PartialPublishAndRelease) {
+    WritableRegion region = channel->reserve(100);
+    ASSERT_EQ(region.size(), 100);
+    for (std::size_t i = 0; i < region.first.size(); ++i) {
+        region.first[i] = std::byte{static_cast<unsigned char>(i)};
+    }
+
+    channel->publish(40);
+    ASSERT_EQ(channel->peek().size(), 40);
+
+    channel->release(15);
+    ReadableRegion readable = channel->peek();
+    ASSERT_EQ(readable.size(), 25);
+    EXPECT_EQ(readable.first[0], std::byte{15});
+}
+
+TEST_F(InMemoryChannelTest, RegionsSplitAtWrapAround) {
+    std::vector<std::byte> filler(DEFAULT_CAPACITY - 30);
+    channel->send(filler.data(), filler.size());
+    channel->receive(filler.data(), filler.size());
+
+    WritableRegion region = channel->reserve(100);
+    ASSERT_EQ(region.size(), 100);
+    EXPECT_EQ(region.first.size(), 30);
+    EXPECT_EQ(region.second.size(), 70);
+
+    std::vector<std::byte> payload(100);
+    for (std::size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = std::byte{static_cast<unsigned char>(i)};
+    }
+    copy_into(region, payload.data(), payload.size());
+    channel->publish(region.size());
+
+    ReadableRegion readable = channel->peek();
+    ASSERT_EQ(readable.size(), 100);
+    EXPECT_EQ(readable.first.size(), 30);
+    EXPECT_EQ(readable.second.size(), 70);
+
+    std::vector<std::byte> received(100);
+    copy_from(readable, received.data(), received.size());
+    EXPECT_EQ(received, payload);
+
+    channel->release(readable.size());
+    EXPECT_TRUE(channel->peek().empty());
+}
+
+TEST_F(InMemoryChannelTest, ZeroCopyInteroperatesWithSendReceive) {
+    std::uint32_t sent_value = 0xCAFEBABE;
+    WritableRegion region = channel->reserve(sizeof(sent_value));
+    copy_into(region, &sent_value, sizeof(sent_value));
+    channel->publish(sizeof(sent_value));
+
+    std::uint32_t received_value = 0;
+    EXPECT_EQ(channel->receive(&received_value, sizeof(received_value)), sizeof(received_value));
+    EXPECT_EQ(received_value, sent_value);
+
+    channel->send(&sent_value, sizeof(sent_value));
+    ReadableRegion readable = channel->peek();
+    received_value = 0;
+    copy_from(readable, &received_value, sizeof(received_value));
+    channel->release(sizeof(received_value));
+    EXPECT_EQ(received_value, sent_value);
+}
+
+TEST_F(InMemoryChannelTest, ZeroCopySingleProducerSingleConsumer) {
+    constexpr std::size_t NUM_MESSAGES = 10000;
+
+    std::thread producer([&]() {
+        for (std::size_t i = 0; i < NUM_MESSAGES; ++i) {
+            WritableRegion region;
+            while ((region = channel->reserve(sizeof(i))).size() < sizeof(i)) {
+                std::this_thread::yield();
+            }
+            copy_into(region, &i, sizeof(i));
+            channel->publish(sizeof(i));
+        }
+    });
+
+    std::thread consumer([&]() {
+        for (std::size_t i = 0; i < NUM_MESSAGES; ++i) {
+            ReadableRegion region;
+            while ((region = channel->peek(sizeof(i))).size() < sizeof(i)) {
+                std::this_thread::yield();
+            }
+            std::size_t val = 0;
+            copy_from(region, &val, sizeof(val));
+            channel->release(sizeof(val));
+            EXPECT_EQ(val, i);
+        }
+    });
+
+    producer.join();
+    consumer.join();
+}
+
 // ============================================================================
 // Edge Cases Tests
 // ============================================================================
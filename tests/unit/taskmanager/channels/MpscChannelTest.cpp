@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <channels/MpscChannel.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace lute::tm::channels;
+
+class MpscChannelTest : public ::testing::Test {
+protected:
+    static constexpr std::size_t DEFAULT_SLOTS = 64;
+    static constexpr std::size_t DEFAULT_PAYLOAD = 32;
+
+    MpscChannel channel{DEFAULT_SLOTS, DEFAULT_PAYLOAD};
+};
+
+// ============================================================================
+// Basic Functionality Tests
+// ============================================================================
+
+TEST_F(MpscChannelTest, SendAndReceiveSingleMessage) {
+    std::uint64_t sent = 0xDEADBEEF;
+    EXPECT_EQ(channel.send(&sent, sizeof(sent)), sizeof(sent));
+
+    std::uint64_t received = 0;
+    EXPECT_EQ(channel.receive(&received, sizeof(received)), sizeof(received));
+    EXPECT_EQ(received, sent);
+}
+
+TEST_F(MpscChannelTest, ReceiveFromEmptyChannel) {
+    std::byte buffer[8];
+    EXPECT_EQ(channel.receive(buffer, sizeof(buffer)), 0);
+    EXPECT_TRUE(channel.peek().empty());
+}
+
+TEST_F(MpscChannelTest, RejectsOversizedAndEmptyMessages) {
+    std::array<std::byte, DEFAULT_PAYLOAD + 1> big{};
+    EXPECT_EQ(channel.send(big.data(), big.size()), 0);
+    EXPECT_EQ(channel.send(big.data(), 0), 0);
+    EXPECT_EQ(channel.send(big.data(), DEFAULT_PAYLOAD), DEFAULT_PAYLOAD);
+}
+
+TEST_F(MpscChannelTest, SendToFullChannel) {
+    int value = 1;
+    for (std::size_t i = 0; i < DEFAULT_SLOTS; ++i) {
+        ASSERT_EQ(channel.send(&value, sizeof(value)), sizeof(value));
+    }
+    EXPECT_EQ(channel.send(&value, sizeof(value)), 0);
+
+    channel.receive(&value, sizeof(value));
+    EXPECT_EQ(channel.send(&value, sizeof(value)), sizeof(value));
+}
+
+TEST_F(MpscChannelTest, ReceiveSplitsAndCoalescesMessages) {
+    std::array<std::uint8_t, 6> first{1, 2, 3, 4, 5, 6};
+    std::array<std::uint8_t, 2> second{7, 8};
+    channel.send(first.data(), first.size());
+    channel.send(second.data(), second.size());
+
+    std::array<std::uint8_t, 4> head{};
+    EXPECT_EQ(channel.receive(head.data(), head.size()), 4);
+    EXPECT_EQ(head, (std::array<std::uint8_t, 4>{1, 2, 3, 4}));
+
+    std::array<std::uint8_t, 8> rest{};
+    EXPECT_EQ(channel.receive(rest.data(), rest.size()), 4);
+    EXPECT_EQ(rest[0], 5);
+    EXPECT_EQ(rest[3], 8);
+}
+
+TEST_F(MpscChannelTest, PeekReleaseIsZeroCopy) {
+    int value = 42;
+    channel.send(&value, sizeof(value));
+
+    std::span<const std::byte> message = channel.peek();
+    ASSERT_EQ(message.size(), sizeof(value));
+    EXPECT_EQ(channel.peek().data(), message.data());
+
+    int read = 0;
+    std::memcpy(&read, message.data(), sizeof(read));
+    EXPECT_EQ(read, value);
+
+    channel.release();
+    EXPECT_TRUE(channel.peek().empty());
+}
+
+TEST_F(MpscChannelTest, WrapsAroundManyLaps) {
+    for (std::uint64_t i = 0; i < DEFAULT_SLOTS * 10; ++i) {
+        ASSERT_EQ(channel.send(&i, sizeof(i)), sizeof(i));
+        std::uint64_t out = 0;
+        ASSERT_EQ(channel.receive(&out, sizeof(out)), sizeof(out));
+        ASSERT_EQ(out, i);
+    }
+}
+
+// ============================================================================
+// Contention Stress Tests
+// ============================================================================
+
+TEST_F(MpscChannelTest, ManyProducersPreservePerProducerOrder) {
+    constexpr std::uint32_t NUM_PRODUCERS = 8;
+    constexpr std::uint32_t MESSAGES_PER_PRODUCER = 5000;
+
+    struct Message {
+        std::uint32_t producer;
+        std::uint32_t sequence;
+    };
+
+    std::atomic<bool> start{false};
+    std::vector<std::thread> producers;
+    for (std::uint32_t p = 0; p < NUM_PRODUCERS; ++p) {
+        producers.emplace_back([&, p]() {
+            while (!start.load()) { std::this_thread::yield(); }
+
+            for (std::uint32_t i = 0; i < MESSAGES_PER_PRODUCER; ++i) {
+                Message m{p, i};
+                while (channel.send(&m, sizeof(m)) == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    start.store(true);
+
+    std::array<std::uint32_t, NUM_PRODUCERS> next{};
+    std::size_t total = 0;
+    while (total < NUM_PRODUCERS * MESSAGES_PER_PRODUCER) {
+        std::span<const std::byte> raw = channel.peek();
+        if (raw.empty()) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        ASSERT_EQ(raw.size(), sizeof(Message));
+        Message m;
+        std::memcpy(&m, raw.data(), sizeof(m));
+        channel.release();
+
+        ASSERT_LT(m.producer, NUM_PRODUCERS);
+        ASSERT_EQ(m.sequence, next[m.producer]);
+        ++next[m.producer];
+        ++total;
+    }
+
+    for (auto& t : producers) t.join();
+    EXPECT_TRUE(channel.peek().empty());
+}
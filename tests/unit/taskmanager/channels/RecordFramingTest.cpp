@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+#include <channels/InMemoryChannel.h>
+#include <channels/RecordFraming.h>
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace lute::tm::channels;
+
+namespace {
+
+std::span<const std::byte> asBytes(const std::uint64_t& value) {
+    return { reinterpret_cast<const std::byte*>(&value), sizeof(value) };
+}
+
+std::uint64_t readU64(std::span<const std::byte> payload) {
+    std::uint64_t value = 0;
+    std::memcpy(&value, payload.data(), sizeof(value));
+    return value;
+}
+
+} // namespace
+
+class RecordFramingTest : public ::testing::Test {
+protected:
+    static constexpr std::size_t DEFAULT_CAPACITY = 256;
+
+    static constexpr BatchPolicy unbounded() {
+        return BatchPolicy{ .maxRecords = SIZE_MAX, .maxBytes = SIZE_MAX, .maxDelay = {} };
+    }
+
+    InMemoryChannel channel{DEFAULT_CAPACITY};
+    FramedReader<InMemoryChannel> reader{channel};
+};
+
+// ============================================================================
+// Batched Publish Tests
+// ============================================================================
+
+TEST_F(RecordFramingTest, PendingRecordsInvisibleUntilFlush) {
+    FramedWriter<InMemoryChannel> writer(channel, unbounded());
+
+    std::uint64_t value = 7;
+    ASSERT_TRUE(writer.append(asBytes(value)));
+    ASSERT_TRUE(writer.append(asBytes(value)));
+    EXPECT_EQ(writer.pendingRecords(), 2);
+    EXPECT_TRUE(reader.fetch().empty());
+
+    writer.flush();
+    EXPECT_EQ(reader.fetch().size(), 2);
+}
+
+TEST_F(RecordFramingTest, RecordBudgetPublishesBatch) {
+    FramedWriter<InMemoryChannel> writer(channel, BatchPolicy{ .maxRecords = 3, .maxBytes = SIZE_MAX, .maxDelay = {} });
+
+    for (std::uint64_t i = 0; i < 2; ++i) writer.append(asBytes(i));
+    EXPECT_TRUE(reader.fetch().empty());
+
+    std::uint64_t last = 2;
+    writer.append(asBytes(last));
+    EXPECT_EQ(writer.pendingRecords(), 0);
+
+    FrameBatch batch = reader.fetch();
+    ASSERT_EQ(batch.size(), 3);
+
+    std::uint64_t expected = 0;
+    for (Frame frame : batch) {
+        EXPECT_EQ(frame.kind, FrameKind::Record);
+        EXPECT_EQ(readU64(frame.payload), expected++);
+    }
+}
+
+TEST_F(RecordFramingTest, ByteBudgetPublishesBatch) {
+    FramedWriter<InMemoryChannel> writer(channel, BatchPolicy{ .maxRecords = SIZE_MAX, .maxBytes = 32, .maxDelay = {} });
+
+    std::uint64_t value = 1;
+    writer.append(asBytes(value));
+    EXPECT_TRUE(reader.fetch().empty());
+
+    writer.append(asBytes(value));
+    EXPECT_EQ(reader.fetch().size(), 2);
+}
+
+TEST_F(RecordFramingTest, DelayBudgetPublishesOnPoll) {
+    FramedWriter<InMemoryChannel> writer(channel, BatchPolicy{ .maxRecords = SIZE_MAX, .maxBytes = SIZE_MAX,
+                                                               .maxDelay = std::chrono::microseconds(10) });
+
+    std::uint64_t value = 1;
+    writer.append(asBytes(value));
+
+    writer.poll(FramedWriter<InMemoryChannel>::Clock::now() - std::chrono::seconds(1));
+    EXPECT_TRUE(reader.fetch().empty());
+
+    writer.poll(FramedWriter<InMemoryChannel>::Clock::now() + std::chrono::seconds(1));
+    EXPECT_EQ(reader.fetch().size(), 1);
+}
+
+TEST_F(RecordFramingTest, AllocateSerializesInPlace) {
+    FramedWriter<InMemoryChannel> writer(channel, unbounded());
+
+    std::span<std::byte> slot = writer.allocate(12);
+    ASSERT_EQ(slot.size(), 12);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(slot.data()) % FRAME_ALIGNMENT, 0);
+    std::memset(slot.data(), 0x5A, slot.size());
+    writer.commit();
+    writer.flush();
+
+    FrameBatch batch = reader.fetch();
+    ASSERT_EQ(batch.size(), 1);
+    Frame frame = *batch.begin();
+    EXPECT_EQ(frame.payload.data(), slot.data());
+    EXPECT_EQ(frame.payload.size(), 12);
+    EXPECT_EQ(frame.payload[11], std::byte{0x5A});
+}
+
+// ============================================================================
+// Batch Receive Tests
+// ============================================================================
+
+TEST_F(RecordFramingTest, FetchRespectsMaxFramesAndRelease) {
+    FramedWriter<InMemoryChannel> writer(channel, unbounded());
+    for (std::uint64_t i = 0; i < 5; ++i) writer.append(asBytes(i));
+    writer.flush();
+
+    FrameBatch first = reader.fetch(2);
+    ASSERT_EQ(first.size(), 2);
+    EXPECT_EQ(reader.fetch(2).bytes().data(), first.bytes().data());
+
+    reader.release(first);
+    FrameBatch rest = reader.fetch();
+    ASSERT_EQ(rest.size(), 3);
+    EXPECT_EQ(readU64((*rest.begin()).payload), 2);
+}
+
+TEST_F(RecordFramingTest, FullRingAppliesBackpressure) {
+    FramedWriter<InMemoryChannel> writer(channel, unbounded());
+
+    std::uint64_t value = 0;
+    std::size_t accepted = 0;
+    while (writer.append(asBytes(value))) ++accepted;
+
+    EXPECT_EQ(accepted, DEFAULT_CAPACITY / frame_size(sizeof(value)));
+
+    reader.release(reader.fetch(1));
+    EXPECT_TRUE(writer.append(asBytes(value)));
+}
+
+TEST_F(RecordFramingTest, FramesNeverStraddleWrapAround) {
+    FramedWriter<InMemoryChannel> writer(channel, unbounded());
+
+    // Move the ring position to 16 bytes before the end
+    std::vector<std::byte> filler(DEFAULT_CAPACITY - 16 - sizeof(FrameHeader));
+    writer.append(filler);
+    writer.flush();
+    reader.release(reader.fetch());
+
+    // 24-byte frame does not fit in the 16-byte tail: it must land at the ring start
+    std::vector<std::byte> payload(16, std::byte{0x11});
+    ASSERT_TRUE(writer.append(payload));
+    writer.flush();
+
+    FrameBatch batch = reader.fetch();
+    ASSERT_EQ(batch.size(), 1);
+    Frame frame = *batch.begin();
+    EXPECT_EQ(frame.kind, FrameKind::Record);
+    ASSERT_EQ(frame.payload.size(), payload.size());
+    EXPECT_TRUE(std::equal(payload.begin(), payload.end(), frame.payload.begin()));
+
+    reader.release(batch);
+    EXPECT_TRUE(reader.fetch().empty());
+}
+
+// ============================================================================
+// Concurrent Access Tests
+// ============================================================================
+
+TEST_F(RecordFramingTest, ProducerConsumerVariableSizedRecords) {
+    constexpr std::uint64_t NUM_RECORDS = 20000;
+
+    std::thread producer([&]() {
+        FramedWriter<InMemoryChannel> writer(channel, BatchPolicy{ .maxRecords = 7, .maxBytes = 96, .maxDelay = {} });
+
+        for (std::uint64_t i = 0; i < NUM_RECORDS; ++i) {
+            const std::size_t size = sizeof(i) + (i % 5) * 3;
+            std::span<std::byte> slot;
+            while ((slot = writer.allocate(size)).data() == nullptr) {
+                std::this_thread::yield();
+            }
+            std::memcpy(slot.data(), &i, sizeof(i));
+            writer.commit();
+        }
+        writer.flush();
+    });
+
+    std::uint64_t expected = 0;
+    while (expected < NUM_RECORDS) {
+        FrameBatch batch = reader.fetch(16);
+        if (batch.empty()) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (Frame frame : batch) {
+            ASSERT_EQ(frame.payload.size(), sizeof(expected) + (expected % 5) * 3);
+            ASSERT_EQ(readU64(frame.payload), expected);
+            ++expected;
+        }
+        reader.release(batch);
+    }
+
+    producer.join();
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <channels/RecordFraming.h>
+#include <channels/SharedMemoryChannel.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace lute::tm::channels;
+
+namespace {
+
+constexpr std::size_t CAPACITY = 4096;
+
+std::string uniqueName(const char* test) {
+    return "/lute-test-" + std::string(test) + "-" + std::to_string(::getpid());
+}
+
+} // namespace
+
+// ============================================================================
+// Attach & Header Validation
+// ============================================================================
+
+TEST(SharedMemoryChannelTest, AttachedMappingSeesCreatorsBytes) {
+    SharedMemoryChannel producer = SharedMemoryChannel::create_memfd(CAPACITY);
+    SharedMemoryChannel consumer = SharedMemoryChannel::attach(producer.fd());
+
+    EXPECT_EQ(consumer.capacity(), CAPACITY);
+
+    const std::array<int, 4> sent{1, 2, 3, 4};
+    ASSERT_EQ(producer.send(sent.data(), sizeof(sent)), sizeof(sent));
+
+    std::array<int, 4> received{};
+    ASSERT_EQ(consumer.receive(received.data(), sizeof(received)), sizeof(received));
+    EXPECT_EQ(received, sent);
+}
+
+TEST(SharedMemoryChannelTest, AttachResumesAtCurrentIndices) {
+    SharedMemoryChannel producer = SharedMemoryChannel::create_memfd(CAPACITY);
+
+    const std::uint64_t first = 1;
+    const std::uint64_t second = 2;
+    producer.send(&first, sizeof(first));
+    producer.send(&second, sizeof(second));
+
+    SharedMemoryChannel consumer = SharedMemoryChannel::attach(producer.fd());
+    std::uint64_t value = 0;
+    ASSERT_EQ(consumer.receive(&value, sizeof(value)), sizeof(value));
+    EXPECT_EQ(value, first);
+}
+
+TEST(SharedMemoryChannelTest, NamedRingOpensByName) {
+    const std::string name = uniqueName("named");
+
+    SharedMemoryChannel producer = SharedMemoryChannel::create(name, CAPACITY);
+    EXPECT_THROW(SharedMemoryChannel::create(name, CAPACITY), std::system_error);
+
+    SharedMemoryChannel consumer = SharedMemoryChannel::open(name);
+    SharedMemoryChannel::unlink(name);
+
+    const std::uint64_t sent = 0xfeed;
+    producer.send(&sent, sizeof(sent));
+    std::uint64_t received = 0;
+    consumer.receive(&received, sizeof(received));
+    EXPECT_EQ(received, sent);
+
+    EXPECT_THROW(SharedMemoryChannel::open(name), std::system_error);
+}
+
+TEST(SharedMemoryChannelTest, RejectsOtherLayoutVersion) {
+    SharedMemoryChannel channel = SharedMemoryChannel::create_memfd(CAPACITY);
+
+    const std::uint32_t future = SharedRingHeader::VERSION + 1;
+    ASSERT_EQ(::pwrite(channel.fd(), &future, sizeof(future), offsetof(SharedRingHeader, version)),
+              static_cast<ssize_t>(sizeof(future)));
+
+    EXPECT_THROW(SharedMemoryChannel::attach(channel.fd()), std::runtime_error);
+}
+
+TEST(SharedMemoryChannelTest, RejectsRingSizeThatIsNotAPowerOfTwo) {
+    SharedMemoryChannel channel = SharedMemoryChannel::create_memfd(CAPACITY);
+
+    // Consistent with the mapping, but indices could not be masked into it
+    const std::uint64_t capacity = CAPACITY - 1000;
+    ASSERT_EQ(::ftruncate(channel.fd(), static_cast<off_t>(SharedMemoryChannel::HEADER_BYTES + capacity)), 0);
+    ASSERT_EQ(::pwrite(channel.fd(), &capacity, sizeof(capacity), offsetof(SharedRingHeader, capacity)),
+              static_cast<ssize_t>(sizeof(capacity)));
+
+    EXPECT_THROW(SharedMemoryChannel::attach(channel.fd()), std::runtime_error);
+}
+
+TEST(SharedMemoryChannelTest, RejectsForeignMapping) {
+    const int fd = ::memfd_create("not-a-ring", MFD_CLOEXEC);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(::ftruncate(fd, SharedMemoryChannel::HEADER_BYTES + CAPACITY), 0);
+
+    EXPECT_THROW(SharedMemoryChannel::attach(fd), std::runtime_error);
+    ::close(fd);
+}
+
+// ============================================================================
+// Cross-Process Tests
+// ============================================================================
+
+/**
+ * A forked producer frames a numbered sequence through a small ring; the parent must read every record,
+ * in order, across many wrap-arounds
+ */
+TEST(SharedMemoryChannelTest, ForkedProducerStreamsFramedRecords) {
+    constexpr std::uint64_t RECORDS = 100'000;
+
+    SharedMemoryChannel consumer = SharedMemoryChannel::create_memfd(CAPACITY);
+    const int fd = consumer.fd();
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+
+    if (child == 0) {
+        SharedMemoryChannel channel = SharedMemoryChannel::attach(fd);
+        FramedWriter writer(channel, BatchPolicy{ .maxRecords = 16, .maxBytes = SIZE_MAX, .maxDelay = {} });
+
+        for (std::uint64_t i = 0; i < RECORDS; ++i) {
+            while (!writer.append({ reinterpret_cast<const std::byte*>(&i), sizeof(i) })) {}
+        }
+        writer.flush();
+        ::_exit(0);
+    }
+
+    FramedReader reader(consumer);
+    std::uint64_t expected = 0;
+    bool ordered = true;
+
+    while (expected < RECORDS) {
+        const FrameBatch batch = reader.fetch();
+        for (const Frame frame : batch) {
+            std::uint64_t value;
+            std::memcpy(&value, frame.payload.data(), sizeof(value));
+            ordered = ordered && value == expected;
+            ++expected;
+        }
+        reader.release(batch);
+    }
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(consumer.peek().empty());
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <channels/RecordFraming.h>
+#include <channels/StaticInMemoryChannel.h>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace lute::tm::channels;
+
+class StaticInMemoryChannelTest : public ::testing::Test {
+protected:
+    static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+    using ChannelType = StaticInMemoryChannel<DEFAULT_CAPACITY>;
+
+    // Large inline channels are meant for arenas; keep it off the test thread's stack
+    std::unique_ptr<ChannelType> channel = std::make_unique<ChannelType>();
+};
+
+// ============================================================================
+// Layout Tests
+// ============================================================================
+
+TEST_F(StaticInMemoryChannelTest, StorageIsInlineAndAligned) {
+    static_assert(ChannelType::capacity() == DEFAULT_CAPACITY);
+    static_assert(sizeof(ChannelType) >= DEFAULT_CAPACITY);
+    static_assert(alignof(StaticInMemoryChannel<256, 4096>) == 4096);
+
+    const auto* base = reinterpret_cast<const std::byte*>(channel.get());
+    WritableRegion region = channel->reserve(1);
+    EXPECT_GE(region.first.data(), base);
+    EXPECT_LT(region.first.data(), base + sizeof(ChannelType));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(region.first.data()) % 64, 0);
+}
+
+// ============================================================================
+// Basic Functionality Tests
+// ============================================================================
+
+TEST_F(StaticInMemoryChannelTest, SendAndReceive) {
+    std::uint64_t sent = 99;
+    EXPECT_EQ(channel->send(&sent, sizeof(sent)), sizeof(sent));
+
+    std::uint64_t received = 0;
+    EXPECT_EQ(channel->receive(&received, sizeof(received)), sizeof(received));
+    EXPECT_EQ(received, sent);
+}
+
+TEST_F(StaticInMemoryChannelTest, FullAndEmptyBoundaries) {
+    std::vector<std::byte> data(DEFAULT_CAPACITY + 10);
+    EXPECT_EQ(channel->send(data.data(), data.size()), DEFAULT_CAPACITY);
+    EXPECT_EQ(channel->send(data.data(), 1), 0);
+
+    EXPECT_EQ(channel->receive(data.data(), data.size()), DEFAULT_CAPACITY);
+    EXPECT_EQ(channel->receive(data.data(), 1), 0);
+}
+
+TEST_F(StaticInMemoryChannelTest, WrapAroundSplitsRegions) {
+    std::vector<std::byte> filler(DEFAULT_CAPACITY - 8);
+    channel->send(filler.data(), filler.size());
+    channel->receive(filler.data(), filler.size());
+
+    WritableRegion region = channel->reserve(24);
+    EXPECT_EQ(region.first.size(), 8);
+    EXPECT_EQ(region.second.size(), 16);
+}
+
+TEST_F(StaticInMemoryChannelTest, WorksWithRecordFraming) {
+    FramedWriter<ChannelType> writer(*channel, BatchPolicy{ .maxRecords = 1 });
+    FramedReader<ChannelType> reader(*channel);
+
+    std::uint64_t value = 5;
+    ASSERT_TRUE(writer.append({ reinterpret_cast<const std::byte*>(&value), sizeof(value) }));
+
+    FrameBatch batch = reader.fetch();
+    ASSERT_EQ(batch.size(), 1);
+    EXPECT_EQ((*batch.begin()).payload.size(), sizeof(value));
+}
+
+// ============================================================================
+// Concurrent Access Tests
+// ============================================================================
+
+TEST_F(StaticInMemoryChannelTest, SingleProducerSingleConsumer) {
+    constexpr std::size_t NUM_MESSAGES = 20000;
+
+    std::thread producer([&]() {
+        for (std::size_t i = 0; i < NUM_MESSAGES; ++i) {
+            while (channel->reserve(sizeof(i)).size() < sizeof(i)) {
+                std::this_thread::yield();
+            }
+            channel->send(&i, sizeof(i));
+        }
+    });
+
+    for (std::size_t i = 0; i < NUM_MESSAGES; ++i) {
+        while (channel->peek(sizeof(i)).size() < sizeof(i)) {
+            std::this_thread::yield();
+        }
+        std::size_t val = 0;
+        channel->receive(&val, sizeof(val));
+        ASSERT_EQ(val, i);
+    }
+
+    producer.join();
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <channels/InMemoryChannel.h>
+#include <channels/RecordFraming.h>
+#include <channels/WaitableChannel.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+using namespace lute::tm::channels;
+using namespace std::chrono_literals;
+
+class WaitableChannelTest : public ::testing::Test {
+protected:
+    static constexpr std::size_t DEFAULT_CAPACITY = 64;
+
+    InMemoryChannel inner{DEFAULT_CAPACITY};
+    WaitableChannel<InMemoryChannel> channel{inner, WaitPolicy{ .spinIterations = 10 }};
+};
+
+// ============================================================================
+// Non-Blocking Operation Tests
+// ============================================================================
+
+TEST_F(WaitableChannelTest, NonBlockingContractUnchanged) {
+    std::uint64_t value = 42;
+    std::uint64_t out = 0;
+
+    EXPECT_EQ(channel.receive(&out, sizeof(out)), 0u);
+    EXPECT_EQ(channel.send(&value, sizeof(value)), sizeof(value));
+    EXPECT_EQ(channel.receive(&out, sizeof(out)), sizeof(out));
+    EXPECT_EQ(out, 42u);
+
+    const WaitStats stats = channel.stats();
+    EXPECT_EQ(stats.consumerParks, 0u);
+    EXPECT_EQ(stats.producerParks, 0u);
+    EXPECT_EQ(stats.wakes, 0u);
+}
+
+TEST_F(WaitableChannelTest, ReadyWaitDoesNotPark) {
+    std::uint64_t value = 1;
+    channel.send(&value, sizeof(value));
+
+    EXPECT_EQ(channel.wait_readable(sizeof(value)).size(), sizeof(value));
+    EXPECT_EQ(channel.wait_writable(DEFAULT_CAPACITY - sizeof(value)).size(), DEFAULT_CAPACITY - sizeof(value));
+    EXPECT_EQ(channel.stats().consumerParks, 0u);
+    EXPECT_EQ(channel.stats().producerParks, 0u);
+}
+
+// ============================================================================
+// Parking Tests
+// ============================================================================
+
+TEST_F(WaitableChannelTest, WaitTimesOutOnEmptyChannel) {
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(channel.wait_readable(1, 5ms).empty());
+
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 5ms);
+    EXPECT_GE(channel.stats().consumerParks, 1u);
+}
+
+TEST_F(WaitableChannelTest, PublishWakesParkedConsumer) {
+    std::uint64_t out = 0;
+    std::thread consumer([&]() { channel.receive_wait(&out, sizeof(out), 10s); });
+
+    while (channel.stats().consumerParks == 0) std::this_thread::yield();
+
+    std::uint64_t value = 7;
+    channel.send(&value, sizeof(value));
+    consumer.join();
+
+    EXPECT_EQ(out, 7u);
+    EXPECT_GE(channel.stats().wakes, 1u);
+}
+
+TEST_F(WaitableChannelTest, ReleaseWakesParkedProducer) {
+    std::byte fill[DEFAULT_CAPACITY]{};
+    ASSERT_EQ(channel.send(fill, DEFAULT_CAPACITY), DEFAULT_CAPACITY);
+
+    std::size_t sent = 0;
+    std::thread producer([&]() { sent = channel.send_wait(fill, 16, 10s); });
+
+    while (channel.stats().producerParks == 0) std::this_thread::yield();
+    EXPECT_EQ(channel.receive(fill, 8), 8u);
+    EXPECT_EQ(channel.receive(fill, 8), 8u);
+    producer.join();
+
+    EXPECT_EQ(sent, 16u);
+}
+
+TEST_F(WaitableChannelTest, CloseReleasesWaiters) {
+    std::thread consumer([&]() { EXPECT_TRUE(channel.wait_readable(8).empty()); });
+
+    while (channel.stats().consumerParks == 0) std::this_thread::yield();
+    channel.close();
+    consumer.join();
+
+    EXPECT_TRUE(channel.closed());
+    EXPECT_TRUE(channel.wait_readable(8).empty());
+}
+
+// ============================================================================
+// Concurrent Access Tests
+// ============================================================================
+
+TEST(WaitableChannelStressTest, NoLostWakeupsWhenBothSidesPark) {
+    constexpr std::uint64_t NUM_MESSAGES = 20000;
+
+    InMemoryChannel inner(64);
+    WaitableChannel<InMemoryChannel> channel(inner, WaitPolicy{ .spinIterations = 0 });
+
+    std::thread producer([&]() {
+        for (std::uint64_t i = 0; i < NUM_MESSAGES; ++i) {
+            ASSERT_EQ(channel.send_wait(&i, sizeof(i), 5s), sizeof(i)) << "producer stuck at " << i;
+        }
+    });
+
+    for (std::uint64_t expected = 0; expected < NUM_MESSAGES; ++expected) {
+        std::uint64_t value = 0;
+        ASSERT_EQ(channel.receive_wait(&value, sizeof(value), 5s), sizeof(value)) << "consumer stuck at " << expected;
+        ASSERT_EQ(value, expected);
+    }
+
+    producer.join();
+}
+
+TEST(WaitableChannelStressTest, FramedReaderBlocksBetweenBatches) {
+    constexpr std::uint64_t NUM_RECORDS = 5000;
+
+    InMemoryChannel inner(256);
+    WaitableChannel<InMemoryChannel> channel(inner, WaitPolicy{ .spinIterations = 0 });
+
+    std::thread producer([&]() {
+        FramedWriter<WaitableChannel<InMemoryChannel>> writer(channel, BatchPolicy{ .maxRecords = 3, .maxBytes = 64, .maxDelay = {} });
+        for (std::uint64_t i = 0; i < NUM_RECORDS; ++i) {
+            const std::span<const std::byte> bytes{ reinterpret_cast<const std::byte*>(&i), sizeof(i) };
+            while (!writer.append(bytes)) channel.wait_writable(frame_size(sizeof(i)), 5s);
+        }
+        writer.flush();
+    });
+
+    FramedReader<WaitableChannel<InMemoryChannel>> reader(channel);
+    std::uint64_t expected = 0;
+    while (expected < NUM_RECORDS) {
+        FrameBatch batch = reader.fetch();
+        if (batch.empty()) {
+            ASSERT_FALSE(channel.wait_readable(1, 5s).empty());
+            continue;
+        }
+        for (Frame frame : batch) {
+            std::uint64_t value = 0;
+            std::memcpy(&value, frame.payload.data(), sizeof(value));
+            ASSERT_EQ(value, expected++);
+        }
+        reader.release(batch);
+    }
+
+    producer.join();
+}
@@ -0,0 +1,270 @@
+#include <gtest/gtest.h>
+#include <checkpoint/Barrier.h>
+#include <watermarks/FanIn.h>
+
+#include <channels/InMemoryChannel.h>
+#include <channels/RecordFraming.h>
+#include <gates/InputGate.h>
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace lute::tm::checkpoint;
+using namespace lute::tm::channels;
+using lute::tm::gates::InputGate;
+using lute::tm::watermarks::Element;
+using lute::tm::watermarks::EventTime;
+using lute::tm::watermarks::FramedFanIn;
+using lute::tm::watermarks::GateFanIn;
+using lute::tm::watermarks::END_OF_TIME;
+
+namespace {
+
+std::span<const std::byte> asBytes(const std::uint64_t& value) {
+    return { reinterpret_cast<const std::byte*>(&value), sizeof(value) };
+}
+
+std::uint64_t valueOf(const std::span<const std::byte> payload) {
+    std::uint64_t value;
+    std::memcpy(&value, payload.data(), sizeof(value));
+    return value;
+}
+
+struct Input {
+    Input() : channel(4096), writer(channel) {}
+
+    void record(const std::uint64_t value) { ASSERT_TRUE(writer.append(asBytes(value))); }
+
+    InMemoryChannel channel;
+    FramedWriter<InMemoryChannel> writer;
+};
+
+/**
+ * Operator state of the fan-in tests: a running sum, and the sum as of each aligned barrier
+ */
+struct Summing {
+    std::uint64_t sum = 0;
+    std::vector<std::pair<CheckpointId, std::uint64_t>> snapshots;
+    std::vector<EventTime> watermarks;
+
+    auto onRecord() {
+        return [this](std::size_t, const std::span<const std::byte> payload) {
+            sum += valueOf(payload);
+            return true;
+        };
+    }
+    auto onWatermark() {
+        return [this](const EventTime watermark) { watermarks.push_back(watermark); };
+    }
+    auto onBarrier() {
+        return [this](const CheckpointId checkpoint) { snapshots.emplace_back(checkpoint, sum); };
+    }
+};
+
+} // namespace
+
+// ============================================================================
+// Aligner
+// ============================================================================
+
+TEST(BarrierAlignerTest, AlignsOnceEveryInputDelivered) {
+    BarrierAligner aligner(3);
+
+    EXPECT_FALSE(aligner.arrive(1, 1));
+    EXPECT_TRUE(aligner.blocked(1));
+    EXPECT_EQ(aligner.pending(), 1u);
+
+    EXPECT_FALSE(aligner.arrive(1, 1));         // a repeat does not count twice
+    EXPECT_FALSE(aligner.arrive(0, 1));
+    EXPECT_TRUE(aligner.arrive(2, 1));
+
+    EXPECT_EQ(aligner.completed(), 1u);
+    EXPECT_EQ(aligner.pending(), NO_CHECKPOINT);
+    for (std::size_t i = 0; i < 3; ++i) EXPECT_FALSE(aligner.blocked(i));
+}
+
+TEST(BarrierAlignerTest, NewerBarrierSupersedesPendingAlignment) {
+    BarrierAligner aligner(2);
+
+    aligner.arrive(0, 1);
+    EXPECT_FALSE(aligner.arrive(1, 2));
+    EXPECT_EQ(aligner.aborted(), 1u);
+    EXPECT_FALSE(aligner.blocked(0));
+    EXPECT_TRUE(aligner.blocked(1));
+
+    EXPECT_FALSE(aligner.arrive(0, 1));         // stale: checkpoint 1 is gone
+    EXPECT_FALSE(aligner.blocked(0));
+    EXPECT_TRUE(aligner.arrive(0, 2));
+    EXPECT_EQ(aligner.completed(), 2u);
+}
+
+TEST(BarrierAlignerTest, ClosedInputsNoLongerHoldAlignmentBack) {
+    BarrierAligner aligner(3);
+
+    aligner.arrive(0, 1);
+    aligner.arrive(1, 1);
+    EXPECT_TRUE(aligner.close(2));
+    EXPECT_EQ(aligner.completed(), 1u);
+
+    EXPECT_FALSE(aligner.arrive(0, 2));
+    EXPECT_TRUE(aligner.arrive(1, 2));
+}
+
+TEST(BarrierTriggerTest, CoalescesRequestsTheSourceHasNotSeen) {
+    BarrierTrigger trigger;
+    EXPECT_FALSE(trigger.take().has_value());
+
+    EXPECT_EQ(trigger.request(), 1u);
+    EXPECT_EQ(trigger.request(), 2u);
+    EXPECT_EQ(trigger.take(), 2u);
+    EXPECT_FALSE(trigger.take().has_value());
+    EXPECT_EQ(trigger.injected(), 2u);
+}
+
+// ============================================================================
+// Framed Fan-In
+// ============================================================================
+
+/**
+ * Input 0 delivers its barrier early and keeps producing. Those later records must wait until input 1's
+ * barrier arrives, so the snapshot holds exactly the records before the barrier on both inputs.
+ */
+TEST(FramedFanInBarrierTest, HoldsBackRecordsBehindAnEarlyBarrier) {
+    Input a;
+    Input b;
+    std::vector<InMemoryChannel*> channels{ &a.channel, &b.channel };
+    FramedFanIn<InMemoryChannel> fanIn(channels);
+    Summing op;
+
+    a.record(1);
+    a.record(2);
+    append_barrier(a.writer, 1);
+    a.record(100);
+    a.writer.flush();
+
+    b.record(10);
+    b.writer.flush();
+
+    EXPECT_EQ(fanIn.poll(op.onRecord(), op.onWatermark(), op.onBarrier()), 4u);
+    EXPECT_EQ(op.sum, 13u);
+    EXPECT_TRUE(fanIn.aligner().blocked(0));
+    EXPECT_TRUE(op.snapshots.empty());
+
+    EXPECT_EQ(fanIn.poll(op.onRecord(), op.onWatermark(), op.onBarrier()), 0u);
+    EXPECT_EQ(op.sum, 13u);                     // 100 is still queued behind input 0's barrier
+
+    b.record(20);
+    append_barrier(b.writer, 1);
+    b.record(1000);
+    b.writer.flush();
+
+    fanIn.poll(op.onRecord(), op.onWatermark(), op.onBarrier());
+    ASSERT_EQ(op.snapshots.size(), 1u);
+    EXPECT_EQ(op.snapshots[0], (std::pair<CheckpointId, std::uint64_t>{ 1, 33 }));
+
+    while (fanIn.poll(op.onRecord(), op.onWatermark(), op.onBarrier()) != 0) {}
+    EXPECT_EQ(op.sum, 1133u);
+}
+
+TEST(FramedFanInBarrierTest, SettlesWatermarksBeforeTheBarrier) {
+    Input a;
+    Input b;
+    std::vector<InMemoryChannel*> channels{ &a.channel, &b.channel };
+    FramedFanIn<InMemoryChannel> fanIn(channels);
+
+    std::vector<std::string> events;
+    const auto onRecord = [](std::size_t, std::span<const std::byte>) { return true; };
+    const auto onWatermark = [&](const EventTime watermark) { events.push_back("wm" + std::to_string(watermark)); };
+    const auto onBarrier = [&](const CheckpointId checkpoint) { events.push_back("cp" + std::to_string(checkpoint)); };
+
+    lute::tm::watermarks::append_watermark(a.writer, 50);
+    append_barrier(a.writer, 1);
+    a.writer.flush();
+    lute::tm::watermarks::append_watermark(b.writer, 40);
+    append_barrier(b.writer, 1);
+    lute::tm::watermarks::append_watermark(b.writer, 60);
+    b.writer.flush();
+
+    fanIn.poll(onRecord, onWatermark, onBarrier);
+    fanIn.poll(onRecord, onWatermark, onBarrier);
+
+    EXPECT_EQ(events, (std::vector<std::string>{ "wm40", "cp1", "wm50" }));
+}
+
+TEST(FramedFanInBarrierTest, FinishedInputCompletesAlignment) {
+    Input a;
+    Input b;
+    std::vector<InMemoryChannel*> channels{ &a.channel, &b.channel };
+    FramedFanIn<InMemoryChannel> fanIn(channels);
+    Summing op;
+
+    a.record(5);
+    append_barrier(a.writer, 3);
+    a.writer.flush();
+    fanIn.poll(op.onRecord(), op.onWatermark(), op.onBarrier());
+    EXPECT_TRUE(op.snapshots.empty());
+
+    b.record(7);
+    lute::tm::watermarks::append_watermark(b.writer, END_OF_TIME);
+    b.writer.flush();
+    fanIn.poll(op.onRecord(), op.onWatermark(), op.onBarrier());
+
+    ASSERT_EQ(op.snapshots.size(), 1u);
+    EXPECT_EQ(op.snapshots[0], (std::pair<CheckpointId, std::uint64_t>{ 3, 12 }));
+}
+
+TEST(FramedFanInBarrierTest, StatelessPollStillAligns) {
+    Input a;
+    Input b;
+    std::vector<InMemoryChannel*> channels{ &a.channel, &b.channel };
+    FramedFanIn<InMemoryChannel> fanIn(channels);
+
+    append_barrier(a.writer, 1);
+    a.record(1);
+    a.writer.flush();
+
+    std::size_t records = 0;
+    const auto onRecord = [&](std::size_t, std::span<const std::byte>) { return ++records, true; };
+    fanIn.poll(onRecord, [](EventTime) {});
+
+    EXPECT_EQ(records, 0u);
+    EXPECT_TRUE(fanIn.aligner().blocked(0));
+}
+
+// ============================================================================
+// Gate Fan-In
+// ============================================================================
+
+TEST(GateFanInBarrierTest, AlignsBarrierElements) {
+    using Gate = InputGate<Element<std::uint64_t>>;
+    Gate a(64);
+    Gate b(64);
+    std::vector<Gate*> gates{ &a, &b };
+    GateFanIn<Gate> fanIn(gates);
+
+    std::uint64_t sum = 0;
+    std::vector<std::pair<CheckpointId, std::uint64_t>> snapshots;
+    const auto onRecord = [&](std::size_t, EventTime, const std::uint64_t& value) { sum += value; return true; };
+    const auto onWatermark = [](EventTime) {};
+    const auto onBarrier = [&](const CheckpointId checkpoint) { snapshots.emplace_back(checkpoint, sum); };
+
+    a.emplace(Element<std::uint64_t>::record(1, 1));
+    a.emplace(Element<std::uint64_t>::barrier(4));
+    a.emplace(Element<std::uint64_t>::record(2, 100));
+    b.emplace(Element<std::uint64_t>::record(1, 10));
+
+    fanIn.poll(onRecord, onWatermark, onBarrier);
+    EXPECT_EQ(sum, 11u);
+    EXPECT_TRUE(snapshots.empty());
+
+    b.emplace(Element<std::uint64_t>::barrier(4));
+    fanIn.poll(onRecord, onWatermark, onBarrier);
+    ASSERT_EQ(snapshots.size(), 1u);
+    EXPECT_EQ(snapshots[0], (std::pair<CheckpointId, std::uint64_t>{ 4, 11 }));
+
+    fanIn.poll(onRecord, onWatermark, onBarrier);
+    EXPECT_EQ(sum, 111u);
+}
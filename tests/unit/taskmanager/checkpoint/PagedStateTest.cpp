@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <checkpoint/PagedState.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using namespace lute::tm::checkpoint;
+
+namespace {
+
+// 64-byte pages: 8 elements each, so the tests span several pages with little state
+constexpr std::size_t PAGE_BYTES = 64;
+
+std::uint64_t snapshotElement(const StateSnapshot& snapshot, const std::size_t i) {
+    for (const SnapshotPage& page : snapshot.pages) {
+        if (page.index != i / snapshot.pageElements) continue;
+
+        std::uint64_t value;
+        std::memcpy(&value, page.bytes.get() + (i % snapshot.pageElements) * sizeof(value), sizeof(value));
+        return value;
+    }
+    ADD_FAILURE() << "element " << i << " is not in the snapshot";
+    return 0;
+}
+
+} // namespace
+
+TEST(PagedStateTest, SplitsIntoPowerOfTwoPages) {
+    PagedState<std::uint64_t> state(20, 100);
+
+    EXPECT_EQ(state.pageElements(), 8u);
+    EXPECT_EQ(state.pages(), 3u);
+    for (std::size_t i = 0; i < state.size(); ++i) EXPECT_EQ(state[i], 0u);
+}
+
+TEST(PagedStateTest, SnapshotIsIsolatedFromLaterWrites) {
+    PagedState<std::uint64_t> state(20, PAGE_BYTES);
+    for (std::size_t i = 0; i < state.size(); ++i) state.mutate(i) = i;
+
+    const StateSnapshot snapshot = state.snapshot(1);
+    EXPECT_FALSE(snapshot.incremental());
+    EXPECT_EQ(snapshot.pages.size(), 3u);
+    EXPECT_EQ(snapshot.pages[2].size, 4 * sizeof(std::uint64_t));       // the last page is partial
+    EXPECT_EQ(state.copies(), 0u);
+
+    state.mutate(3) = 300;
+    state.mutate(5) = 500;                      // same page: copied once
+    EXPECT_EQ(state.copies(), 1u);
+
+    EXPECT_EQ(state[3], 300u);
+    EXPECT_EQ(snapshotElement(snapshot, 3), 3u);
+    EXPECT_EQ(snapshotElement(snapshot, 5), 5u);
+}
+
+TEST(PagedStateTest, ReleasedPagesAreWrittenInPlace) {
+    PagedState<std::uint64_t> state(16, PAGE_BYTES);
+
+    {
+        const StateSnapshot snapshot = state.snapshot(1);
+    }
+    state.mutate(0) = 1;
+    state.mutate(15) = 2;
+
+    EXPECT_EQ(state.copies(), 0u);
+}
+
+TEST(PagedStateTest, IncrementalSnapshotCarriesChangedPagesOnly) {
+    PagedState<std::uint64_t> state(64, PAGE_BYTES);
+    state.snapshot(1);
+
+    state.mutate(50) = 1;
+    state.mutate(2) = 1;
+    state.mutate(3) = 1;
+    EXPECT_EQ(state.changedPages(), 2u);
+
+    const StateSnapshot delta = state.snapshot(2);
+    EXPECT_TRUE(delta.incremental());
+    EXPECT_EQ(delta.base, 1u);
+    ASSERT_EQ(delta.pages.size(), 2u);
+    EXPECT_EQ(delta.pages[0].index, 0u);
+    EXPECT_EQ(delta.pages[1].index, 6u);
+    EXPECT_EQ(state.changedPages(), 0u);
+
+    const StateSnapshot full = state.snapshot(3, true);
+    EXPECT_FALSE(full.incremental());
+    EXPECT_EQ(full.pages.size(), 8u);
+}
+
+TEST(PagedStateTest, RestoresAChain) {
+    PagedState<std::uint64_t> state(40, PAGE_BYTES);
+    std::vector<StateSnapshot> chain;
+
+    for (std::size_t i = 0; i < state.size(); ++i) state.mutate(i) = i;
+    chain.push_back(state.snapshot(1));
+    state.mutate(9) = 900;
+    chain.push_back(state.snapshot(2));
+    state.mutate(33) = 3300;
+    state.mutate(9) = 901;
+    chain.push_back(state.snapshot(3));
+
+    PagedState<std::uint64_t> restored(40, PAGE_BYTES);
+    for (const StateSnapshot& snapshot : chain) restored.restore(snapshot);
+
+    for (std::size_t i = 0; i < state.size(); ++i) EXPECT_EQ(restored[i], state[i]) << "element " << i;
+    EXPECT_EQ(restored.lastSnapshot(), 3u);
+
+    // The next snapshot continues the chain
+    restored.mutate(0) = 7;
+    EXPECT_EQ(restored.snapshot(4).base, 3u);
+}
+
+TEST(PagedStateTest, RejectsSnapshotOfDifferentShape) {
+    PagedState<std::uint64_t> state(40, PAGE_BYTES);
+    const StateSnapshot snapshot = state.snapshot(1);
+
+    PagedState<std::uint64_t> longer(48, PAGE_BYTES);
+    EXPECT_THROW(longer.restore(snapshot), std::runtime_error);
+
+    PagedState<std::uint32_t> narrower(40, PAGE_BYTES);
+    EXPECT_THROW(narrower.restore(snapshot), std::runtime_error);
+}
@@ -0,0 +1,372 @@
+#include <gtest/gtest.h>
+#include <columnar/Kernels.h>
+#include <gates/ColumnarGate.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace lute::tm::columnar;
+
+namespace {
+
+constexpr std::array<SimdLevel, 3> LEVELS{ SimdLevel::Scalar, SimdLevel::Avx2, SimdLevel::Avx512 };
+constexpr std::array<Compare, 6> COMPARES{
+    Compare::Less, Compare::LessEqual, Compare::Greater, Compare::GreaterEqual, Compare::Equal, Compare::NotEqual
+};
+
+// Around every vector width and unroll boundary, so each tail path runs
+constexpr std::array<std::size_t, 14> SIZES{ 0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 63, 65, 1000 };
+
+std::string name(const SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar: return "scalar";
+        case SimdLevel::Avx2: return "avx2";
+        case SimdLevel::Avx512: return "avx512";
+    }
+    return "?";
+}
+
+/**
+ * Values drawn from a small range so that every predicate selects some records and equality hits
+ */
+template<typename T>
+std::vector<T> column(const std::size_t count, const std::uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> value(-8, 8);
+    std::vector<T> values(count);
+    for (T& v : values) v = static_cast<T>(value(rng));
+    return values;
+}
+
+template<typename T>
+std::vector<std::uint32_t> expectedFilter(const std::vector<T>& values, const Compare op, const T operand) {
+    std::vector<std::uint32_t> selected;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const bool keep = detail::with_compare(op, [&]<Compare Op>(std::integral_constant<Compare, Op>) {
+            return scalar::compare<Op>(values[i], operand);
+        });
+        if (keep) selected.push_back(static_cast<std::uint32_t>(i));
+    }
+    return selected;
+}
+
+std::vector<std::uint32_t> selected(const SelectionVector& selection) {
+    return { selection.begin(), selection.end() };
+}
+
+} // namespace
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+TEST(ColumnarKernelsTest, DetectedLevelIsSupportedAndDefault) {
+    EXPECT_TRUE(supported(SimdLevel::Scalar));
+    EXPECT_TRUE(supported(detected_level()));
+    EXPECT_EQ(kernels().level, detected_level());
+    for (const SimdLevel level : LEVELS) {
+        if (supported(level)) {
+            EXPECT_EQ(kernels(level).level, level);
+        }
+    }
+}
+
+// ============================================================================
+// Filter
+// ============================================================================
+
+template<typename T>
+void checkFilters() {
+    for (const SimdLevel level : LEVELS) {
+        if (!supported(level)) continue;
+        SCOPED_TRACE(name(level));
+
+        for (const std::size_t size : SIZES) {
+            const std::vector<T> values = column<T>(size, size);
+            SelectionVector selection(size);
+
+            for (const Compare op : COMPARES) {
+                SCOPED_TRACE(static_cast<int>(op));
+                filter<T>(values, op, T{2}, selection, kernels(level));
+                EXPECT_EQ(selected(selection), expectedFilter(values, op, T{2})) << "size " << size;
+            }
+        }
+    }
+}
+
+TEST(ColumnarKernelsTest, FiltersMatchReferenceAtEveryLevel) {
+    checkFilters<std::int64_t>();
+    checkFilters<double>();
+}
+
+TEST(ColumnarKernelsTest, FiltersCompareSignedAndExtremeValues) {
+    const std::vector<std::int64_t> values{
+        std::numeric_limits<std::int64_t>::min(), -1, 0, 1, std::numeric_limits<std::int64_t>::max(), -5, 5, 0
+    };
+
+    for (const SimdLevel level : LEVELS) {
+        if (!supported(level)) continue;
+        SCOPED_TRACE(name(level));
+
+        SelectionVector selection(values.size());
+        filter<std::int64_t>(values, Compare::Less, 0, selection, kernels(level));
+        EXPECT_EQ(selected(selection), (std::vector<std::uint32_t>{ 0, 1, 5 }));
+
+        filter<std::int64_t>(values, Compare::GreaterEqual, std::numeric_limits<std::int64_t>::max(), selection, kernels(level));
+        EXPECT_EQ(selected(selection), (std::vector<std::uint32_t>{ 4 }));
+    }
+}
+
+TEST(ColumnarKernelsTest, NaNOnlySatisfiesNotEqual) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<double> values{ nan, 1.0, nan, 2.0, nan, nan, 3.0, nan, nan };
+
+    for (const SimdLevel level : LEVELS) {
+        if (!supported(level)) continue;
+        SCOPED_TRACE(name(level));
+
+        SelectionVector selection(values.size());
+        for (const Compare op : COMPARES) {
+            filter<double>(values, op, 2.0, selection, kernels(level));
+            EXPECT_EQ(selected(selection), expectedFilter(values, op, 2.0));
+        }
+    }
+}
+
+TEST(ColumnarKernelsTest, RefiningASelectionIsAConjunction) {
+    const std::vector<std::int64_t> prices = column<std::int64_t>(1000, 1);
+    const std::vector<double> sizes = column<double>(1000, 2);
+
+    std::vector<std::uint32_t> expected;
+    for (std::uint32_t i = 0; i < prices.size(); ++i) {
+        if (prices[i] > -3 && sizes[i] <= 4.0 && prices[i] != 5) expected.push_back(i);
+    }
+
+    for (const SimdLevel level : LEVELS) {
+        if (!supported(level)) continue;
+        SCOPED_TRACE(name(level));
+        const Kernels& table = kernels(level);
+
+        SelectionVector selection(prices.size());
+        filter<std::int64_t>(prices, Compare::Greater, -3, selection, table);
+        refine<double>(sizes, Compare::LessEqual, 4.0, selection, table);
+        refine<std::int64_t>(prices, Compare::NotEqual, 5, selection, table);
+        EXPECT_EQ(selected(selection), expected);
+    }
+}
+
+// ============================================================================
+// Aggregates
+// ============================================================================
+
+TEST(ColumnarKernelsTest, AggregatesMatchReferenceAtEveryLevel) {
+    for (const SimdLevel level : LEVELS) {
+        if (!supported(level)) continue;
+        SCOPED_TRACE(name(level));
+
+        for (const std::size_t size : SIZES) {
+            const std::vector<std::int64_t> integers = column<std::int64_t>(size, size + 100);
+            EXPECT_EQ(aggregate<std::int64_t>(integers, kernels(level)), scalar::aggregate(integers.data(), size)) << size;
+
+            // Small integers in doubles add exactly in any order
+            const std::vector<double> reals = column<double>(size, size + 200);
+            EXPECT_EQ(aggregate<double>(reals, kernels(level)), scalar::aggregate(reals.data(), size)) << size;
+        }
+    }
+}
+
+TEST(ColumnarKernelsTest, EmptyAggregateHasIdentityBounds) {
+    const Aggregate<std::int64_t> empty = aggregate<std::int64_t>(std::span<const std::int64_t>{});
+    EXPECT_EQ(empty.count, 0u);
+    EXPECT_EQ(empty.sum, 0);
+    EXPECT_EQ(empty.min, std::numeric_limits<std::int64_t>::max());
+    EXPECT_EQ(empty.max, std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(aggregate<double>(std::span<const double>{}).min, std::numeric_limits<double>::infinity());
+}
+
+TEST(ColumnarKernelsTest, IntegerSumsWrapAndBoundsAreExact) {
+    const std::int64_t top = std::numeric_limits<std::int64_t>::max();
+    const std::vector<std::int64_t> values{ top, 1, std::numeric_limits<std::int64_t>::min(), -7, top, 3, 2, 9, 11 };
+
+    const std::uint64_t wrapped = std::accumulate(values.begin(), values.end(), std::uint64_t{0},
+                                                  [](const std::uint64_t sum, const std::int64_t v) { return sum + static_cast<std::uint64_t>(v); });
+
+    for (const SimdLevel level : LEVELS) {
+        if (!supported(level)) continue;
+        SCOPED_TRACE(name(level));
+
+        const Aggregate<std::int64_t> result = aggregate<std::int64_t>(values, kernels(level));
+        EXPECT_EQ(result.sum, static_cast<std::int64_t>(wrapped));
+        EXPECT_EQ(result.min, std::numeric_limits<std::int64_t>::min());
+        EXPECT_EQ(result.max, top);
+        EXPECT_EQ(result.count, values.size());
+    }
+}
+
+TEST(ColumnarKernelsTest, AggregatesOverSelectionReadOnlySelectedRecords) {
+    for (const SimdLevel level : LEVELS) {
+        if (!supported(level)) continue;
+        SCOPED_TRACE(name(level));
+
+        for (const std::size_t size : SIZES) {
+            const std::vector<std::int64_t> keys = column<std::int64_t>(size, size + 300);
+            const std::vector<double> values = column<double>(size, size + 400);
+
+            SelectionVector selection(size);
+            filter<std::int64_t>(keys, Compare::GreaterEqual, 0, selection, kernels(level));
+
+            std::vector<double> picked;
+            for (const std::uint32_t i : selection) picked.push_back(values[i]);
+
+            EXPECT_EQ(aggregate<double>(values, selection, kernels(level)), scalar::aggregate(picked.data(), picked.size())) << size;
+        }
+    }
+}
+
+// ============================================================================
+// Hash Partitioning
+// ============================================================================
+
+TEST(ColumnarKernelsTest, HashPartitionIsIdenticalAtEveryLevel) {
+    std::mt19937_64 rng(3);
+    std::vector<std::uint64_t> keys(1003);
+    for (std::uint64_t& key : keys) key = rng();
+
+    for (const std::uint32_t partitions : { 1u, 2u, 7u, 64u, 1000u }) {
+        std::vector<std::uint32_t> expected(keys.size());
+        for (std::size_t i = 0; i < keys.size(); ++i) expected[i] = partition_of(hash_key(keys[i]), partitions);
+
+        for (const SimdLevel level : LEVELS) {
+            if (!supported(level)) continue;
+            SCOPED_TRACE(name(level));
+
+            std::vector<std::uint32_t> ids(keys.size(), ~0u);
+            hash_partition(keys, partitions, ids.data(), kernels(level));
+            EXPECT_EQ(ids, expected) << partitions << " partitions";
+        }
+
+#if defined(__x86_64__)
+        // Kept out of the AVX2 table, but must stay interchangeable with it
+        if (supported(SimdLevel::Avx2)) {
+            std::vector<std::uint32_t> ids(keys.size(), ~0u);
+            avx2::hash_partition(keys.data(), keys.size(), partitions, ids.data());
+            EXPECT_EQ(ids, expected) << partitions << " partitions, avx2::hash_partition";
+        }
+#endif
+    }
+}
+
+TEST(ColumnarKernelsTest, HashPartitionSpreadsSequentialKeys) {
+    constexpr std::uint32_t PARTITIONS = 16;
+    std::vector<std::uint64_t> keys(1 << 16);
+    std::iota(keys.begin(), keys.end(), std::uint64_t{0});
+
+    std::vector<std::uint32_t> ids(keys.size());
+    hash_partition(keys, PARTITIONS, ids.data());
+
+    std::array<std::size_t, PARTITIONS> counts{};
+    for (const std::uint32_t id : ids) ++counts.at(id);
+
+    const double expected = static_cast<double>(keys.size()) / PARTITIONS;
+    for (const std::size_t count : counts) {
+        EXPECT_LT(std::abs(static_cast<double>(count) - expected), expected * 0.05);
+    }
+}
+
+// ============================================================================
+// Columnar Gate
+// ============================================================================
+
+TEST(ColumnarGateTest, EmplaceScattersFieldsIntoAlignedColumns) {
+    lute::tm::gates::ColumnarGate<std::int64_t, double, std::uint32_t> gate(16);
+
+    EXPECT_TRUE(gate.emplace(10, 1.5, 7u));
+    EXPECT_TRUE(gate.emplace(20, 2.5, 8u));
+
+    const auto batch = gate.fetch(8);
+    ASSERT_EQ(batch.recordCount, 2u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.column<0>().data()) % COLUMN_ALIGNMENT, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.column<1>().data()) % COLUMN_ALIGNMENT, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.column<2>().data()) % COLUMN_ALIGNMENT, 0u);
+
+    EXPECT_EQ(batch.column<0>()[1], 20);
+    EXPECT_EQ(batch.column<1>()[0], 1.5);
+    EXPECT_EQ(batch.column<2>()[1], 8u);
+    gate.commit(2);
+    EXPECT_EQ(gate.pending(), 0u);
+}
+
+TEST(ColumnarGateTest, RejectsRecordsWhenFull) {
+    lute::tm::gates::ColumnarGate<std::int64_t> gate(4);
+    const std::vector<std::int64_t> values{ 1, 2, 3, 4, 5, 6 };
+
+    EXPECT_EQ(gate.push(values.data(), values.size()), 4u);
+    EXPECT_FALSE(gate.emplace(7));
+
+    gate.commit(1);
+    EXPECT_TRUE(gate.emplace(7));
+}
+
+TEST(ColumnarGateTest, PushWrapsAndFetchStopsAtTheEndOfTheRing) {
+    lute::tm::gates::ColumnarGate<std::int64_t, double> gate(8);
+
+    std::vector<std::int64_t> keys(6);
+    std::vector<double> values(6);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::iota(values.begin(), values.end(), 100.0);
+
+    ASSERT_EQ(gate.push(keys.data(), values.data(), 6), 6u);
+    gate.commit(gate.fetch(6).recordCount);
+
+    std::iota(keys.begin(), keys.end(), 6);
+    std::iota(values.begin(), values.end(), 106.0);
+    ASSERT_EQ(gate.push(keys.data(), values.data(), 6), 6u);
+
+    auto batch = gate.fetch(8);
+    ASSERT_EQ(batch.recordCount, 2u);               // slots 6 and 7
+    EXPECT_EQ(batch.column<0>()[0], 6);
+    gate.commit(2);
+
+    batch = gate.fetch(8);
+    ASSERT_EQ(batch.recordCount, 4u);               // wrapped to slot 0
+    EXPECT_EQ(batch.column<0>()[3], 11);
+    EXPECT_EQ(batch.column<1>()[3], 111.0);
+}
+
+TEST(ColumnarGateTest, TransposesRecordsAndFeedsTheKernels) {
+    struct Trade {
+        std::uint64_t time;
+        std::int64_t price;
+        double quantity;
+    };
+
+    std::vector<Trade> trades;
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        trades.push_back(Trade{ i, static_cast<std::int64_t>(i % 10), static_cast<double>(i) });
+    }
+
+    lute::tm::gates::ColumnarGate<std::int64_t, double> gate(128);
+    ASSERT_EQ(gate.transpose(trades.data(), trades.size(), &Trade::price, &Trade::quantity), trades.size());
+
+    const auto batch = gate.fetch(128);
+    ASSERT_EQ(batch.recordCount, 100u);
+
+    SelectionVector selection(batch.recordCount);
+    filter<std::int64_t>(batch.column<0>(), Compare::GreaterEqual, 8, selection);
+    const Aggregate<double> quantity = aggregate<double>(batch.column<1>(), selection);
+
+    double expected = 0;
+    for (const Trade& trade : trades) if (trade.price >= 8) expected += trade.quantity;
+
+    EXPECT_EQ(quantity.count, 20u);
+    EXPECT_EQ(quantity.sum, expected);
+    EXPECT_EQ(quantity.min, 8.0);
+    EXPECT_EQ(quantity.max, 99.0);
+    gate.commit(batch.recordCount);
+}
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+#include <flow/CreditLink.h>
+#include <flow/CreditedInputGate.h>
+#include <flow/CreditedWriter.h>
+
+#include <channels/InMemoryChannel.h>
+#include <channels/RecordFraming.h>
+#include <gates/InputGate.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace lute::tm::flow;
+using namespace lute::tm::channels;
+using lute::tm::gates::InputGate;
+using lute::tm::metrics::FlowMetrics;
+using namespace std::chrono_literals;
+
+namespace {
+
+std::span<const std::byte> asBytes(const std::uint64_t& value) {
+    return { reinterpret_cast<const std::byte*>(&value), sizeof(value) };
+}
+
+constexpr BatchPolicy immediate() {
+    return BatchPolicy{ .maxRecords = 1, .maxBytes = SIZE_MAX, .maxDelay = {} };
+}
+
+} // namespace
+
+class CreditFlowTest : public ::testing::Test {
+protected:
+    static constexpr std::uint32_t CREDITS = 4;
+
+    /**
+     * @brief Moves every published frame into the gate, as the InputGate thread does
+     */
+    std::size_t pump() {
+        std::size_t moved = 0;
+        for (;;) {
+            const FrameBatch batch = reader.fetch();
+            if (batch.empty()) return moved;
+            for (const Frame frame : batch) {
+                std::uint64_t value = 0;
+                std::memcpy(&value, frame.payload.data(), sizeof(value));
+                EXPECT_TRUE(consumer.emplace(value)) << "credits must keep the gate from filling up";
+                ++moved;
+            }
+            reader.release(batch);
+        }
+    }
+
+    /**
+     * @brief Fetches and commits everything in the gate, returning the records in order
+     */
+    std::vector<std::uint64_t> consume() {
+        std::vector<std::uint64_t> records;
+        for (;;) {
+            const auto batch = consumer.fetch(CREDITS);
+            if (batch.recordCount == 0) return records;
+            records.insert(records.end(), batch.data, batch.data + batch.recordCount);
+            consumer.commit(batch.recordCount);
+        }
+    }
+
+    InMemoryChannel channel{1024};
+    FramedReader<InMemoryChannel> reader{channel};
+    InputGate<std::uint64_t> gate{CREDITS};
+
+    FlowMetrics metrics;
+    CreditLink link{CREDITS};
+    CreditedInputGate<InputGate<std::uint64_t>> consumer{gate, link, metrics, 2};
+};
+
+// ============================================================================
+// Policy Tests
+// ============================================================================
+
+TEST_F(CreditFlowTest, BlockRefusesRecordsBeyondCredits) {
+    CreditedWriter<InMemoryChannel> writer(channel, link, metrics, EdgePolicy{}, immediate());
+
+    for (std::uint64_t i = 0; i < CREDITS; ++i) EXPECT_EQ(writer.append(asBytes(i)), Admission::Sent);
+
+    const std::uint64_t extra = CREDITS;
+    EXPECT_EQ(writer.append(asBytes(extra)), Admission::Blocked);
+    EXPECT_EQ(writer.append(asBytes(extra)), Admission::Blocked);
+    EXPECT_EQ(metrics.stalls.load(), 1u);
+    EXPECT_EQ(metrics.blocked.load(), 2u);
+
+    EXPECT_EQ(pump(), CREDITS);
+    EXPECT_EQ(consume().size(), CREDITS);
+    EXPECT_EQ(metrics.creditsGranted.load(), CREDITS);
+
+    EXPECT_EQ(writer.append(asBytes(extra)), Admission::Sent);
+    EXPECT_EQ(metrics.stallNs.snapshot().count(), 1u);
+    EXPECT_EQ(metrics.recordsSent.load(), CREDITS + 1);
+}
+
+TEST_F(CreditFlowTest, ShedDropsAndCounts) {
+    CreditedWriter<InMemoryChannel> writer(channel, link, metrics,
+                                           EdgePolicy{ .backpressure = Backpressure::Shed, .spillBytes = 0 }, immediate());
+
+    std::size_t shed = 0;
+    for (std::uint64_t i = 0; i < 10; ++i) {
+        if (writer.append(asBytes(i)) == Admission::Shed) ++shed;
+    }
+
+    EXPECT_EQ(shed, 6u);
+    EXPECT_EQ(metrics.shedRecords.load(), 6u);
+    EXPECT_EQ(metrics.recordsSent.load(), CREDITS);
+    EXPECT_EQ(pump(), CREDITS);
+}
+
+TEST_F(CreditFlowTest, SpillKeepsOrderAndDrainsAsCreditsReturn) {
+    CreditedWriter<InMemoryChannel> writer(channel, link, metrics,
+                                           EdgePolicy{ .backpressure = Backpressure::Spill, .spillBytes = 4096 }, immediate());
+
+    for (std::uint64_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(writer.append(asBytes(i)), i < CREDITS ? Admission::Sent : Admission::Spilled);
+    }
+    EXPECT_EQ(writer.spilledRecords(), 6u);
+
+    std::vector<std::uint64_t> received;
+    while (received.size() < 10) {
+        pump();
+        const std::vector<std::uint64_t> batch = consume();
+        ASSERT_FALSE(batch.empty());
+        received.insert(received.end(), batch.begin(), batch.end());
+        writer.poll();
+    }
+
+    for (std::uint64_t i = 0; i < 10; ++i) EXPECT_EQ(received[i], i);
+    EXPECT_EQ(writer.spilledRecords(), 0u);
+    EXPECT_EQ(metrics.spilledRecords.load(), 6u);
+}
+
+TEST_F(CreditFlowTest, SpillStaysBehindQueuedRecords) {
+    CreditedWriter<InMemoryChannel> writer(channel, link, metrics,
+                                           EdgePolicy{ .backpressure = Backpressure::Spill, .spillBytes = 4096 }, immediate());
+
+    for (std::uint64_t i = 0; i < 6; ++i) writer.append(asBytes(i));
+    pump();
+    consume();                              // grants credits while two records are still spilled
+
+    const std::uint64_t next = 6;
+    EXPECT_EQ(writer.append(asBytes(next)), Admission::Sent);
+    pump();
+    EXPECT_EQ(consume(), (std::vector<std::uint64_t>{4, 5, 6}));
+}
+
+TEST_F(CreditFlowTest, FullSpillBufferBlocks) {
+    CreditedWriter<InMemoryChannel> writer(channel, link, metrics,
+                                           EdgePolicy{ .backpressure = Backpressure::Spill, .spillBytes = 32 }, immediate());
+
+    std::vector<Admission> admissions;
+    for (std::uint64_t i = 0; i < CREDITS + 3; ++i) admissions.push_back(writer.append(asBytes(i)));
+
+    EXPECT_EQ(admissions[CREDITS], Admission::Spilled);
+    EXPECT_EQ(admissions[CREDITS + 1], Admission::Spilled);
+    EXPECT_EQ(admissions[CREDITS + 2], Admission::Blocked);
+}
+
+// ============================================================================
+// Concurrent Access Tests
+// ============================================================================
+
+TEST_F(CreditFlowTest, WaitingProducerIsWokenByGrant) {
+    CreditedWriter<InMemoryChannel> writer(channel, link, metrics, EdgePolicy{}, immediate());
+    for (std::uint64_t i = 0; i < CREDITS; ++i) writer.append(asBytes(i));
+
+    bool woken = false;
+    std::thread producer([&]() { woken = writer.wait(10s); });
+
+    std::this_thread::sleep_for(5ms);
+    pump();
+    consume();
+    producer.join();
+
+    EXPECT_TRUE(woken);
+}
+
+TEST(CreditFlowStressTest, GateNeverOverflowsUnderBlockingProducer) {
+    constexpr std::uint64_t NUM_RECORDS = 50000;
+    constexpr std::uint32_t CREDITS = 64;
+
+    InMemoryChannel channel(4096);
+    InputGate<std::uint64_t> gate(CREDITS);
+    FlowMetrics metrics;
+    CreditLink link(CREDITS);
+    CreditedInputGate<InputGate<std::uint64_t>> consumer(gate, link, metrics);
+
+    std::thread producer([&]() {
+        CreditedWriter<InMemoryChannel> writer(channel, link, metrics, EdgePolicy{},
+                                               BatchPolicy{ .maxRecords = 8, .maxBytes = 1024, .maxDelay = {} });
+        for (std::uint64_t i = 0; i < NUM_RECORDS; ++i) {
+            while (writer.append(asBytes(i)) != Admission::Sent) {
+                ASSERT_TRUE(writer.wait(5s)) << "no credit granted at record " << i;
+            }
+        }
+        writer.flush();
+    });
+
+    FramedReader<InMemoryChannel> reader(channel);
+    std::uint64_t expected = 0;
+    while (expected < NUM_RECORDS) {
+        const FrameBatch batch = reader.fetch();
+        for (const Frame frame : batch) {
+            std::uint64_t value = 0;
+            std::memcpy(&value, frame.payload.data(), sizeof(value));
+            ASSERT_TRUE(consumer.emplace(value));
+        }
+        reader.release(batch);
+
+        const auto records = consumer.fetch(CREDITS);
+        for (std::size_t i = 0; i < records.recordCount; ++i) ASSERT_EQ(records.data[i], expected++);
+        consumer.commit(records.recordCount);
+        if (records.recordCount == 0) std::this_thread::yield();
+    }
+
+    producer.join();
+    EXPECT_EQ(metrics.recordsSent.load(), NUM_RECORDS);
+    EXPECT_EQ(metrics.shedRecords.load(), 0u);
+}
@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+#include <gates/InputGate.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace lute::tm::gates;
+
+namespace {
+
+struct Record {
+    std::uint64_t sequence;
+    std::uint64_t payload[7];
+};
+
+/**
+ * Record with a non-trivial destructor, counting destructions to observe where cleanup ran
+ */
+struct TrackedRecord {
+    static inline std::atomic<std::size_t> live{0};
+
+    explicit TrackedRecord(std::uint64_t seq) noexcept : sequence(seq) { live.fetch_add(1); }
+    TrackedRecord(const TrackedRecord& other) noexcept : sequence(other.sequence) { live.fetch_add(1); }
+    ~TrackedRecord() { live.fetch_sub(1); }
+
+    std::uint64_t sequence;
+};
+
+/**
+ * Runs whatever cleanup the policy delegated, mimicking the InputGate thread
+ */
+template<typename Gate>
+void drainCleanup(Gate& gate) {
+    while (gate.service() != 0) {}
+}
+
+} // namespace
+
+template<typename Policy>
+class InputGateTest : public ::testing::Test {
+protected:
+    static constexpr std::size_t DEFAULT_CAPACITY = 64;
+
+    InputGate<Record, Policy> gate{DEFAULT_CAPACITY};
+};
+
+using CleanupPolicies = ::testing::Types<SynchronousCleanup, DeferredCleanup, SignaledCleanup, OmittedCleanup>;
+TYPED_TEST_SUITE(InputGateTest, CleanupPolicies);
+
+// ============================================================================
+// Fetch–Commit Cycle Tests
+// ============================================================================
+
+TYPED_TEST(InputGateTest, FetchFromEmptyGate) {
+    auto batch = this->gate.fetch(8);
+    EXPECT_EQ(batch.recordCount, 0);
+}
+
+TYPED_TEST(InputGateTest, FetchReturnsRecordsInPlace) {
+    ASSERT_TRUE(this->gate.emplace(Record{1, {}}));
+    ASSERT_TRUE(this->gate.emplace(Record{2, {}}));
+
+    auto batch = this->gate.fetch(8);
+    ASSERT_EQ(batch.recordCount, 2);
+    EXPECT_EQ(batch.data[0].sequence, 1);
+    EXPECT_EQ(batch.data[1].sequence, 2);
+
+    // No copy: fetching again without commit hands out the very same slots
+    auto again = this->gate.fetch(8);
+    EXPECT_EQ(again.data, batch.data);
+    EXPECT_EQ(again.recordCount, 2);
+}
+
+TYPED_TEST(InputGateTest, CommitAdvancesFetchPosition) {
+    for (std::uint64_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(this->gate.emplace(Record{i, {}}));
+    }
+
+    this->gate.commit(3);
+
+    auto batch = this->gate.fetch(8);
+    ASSERT_EQ(batch.recordCount, 1);
+    EXPECT_EQ(batch.data[0].sequence, 3);
+}
+
+TYPED_TEST(InputGateTest, FetchRespectsMaxRecords) {
+    for (std::uint64_t i = 0; i < 10; ++i) {
+        ASSERT_TRUE(this->gate.emplace(Record{i, {}}));
+    }
+
+    EXPECT_EQ(this->gate.fetch().recordCount, 1);
+    EXPECT_EQ(this->gate.fetch(4).recordCount, 4);
+}
+
+TYPED_TEST(InputGateTest, FullGateRejectsUntilCleanedUp) {
+    constexpr std::size_t capacity = TestFixture::DEFAULT_CAPACITY;
+    for (std::uint64_t i = 0; i < capacity; ++i) {
+        ASSERT_TRUE(this->gate.emplace(Record{i, {}}));
+    }
+    EXPECT_FALSE(this->gate.emplace(Record{capacity, {}}));
+
+    this->gate.commit(4);
+    drainCleanup(this->gate);
+
+    EXPECT_TRUE(this->gate.emplace(Record{capacity, {}}));
+}
+
+TYPED_TEST(InputGateTest, BatchStopsAtWrapAround) {
+    constexpr std::size_t capacity = TestFixture::DEFAULT_CAPACITY;
+    std::vector<Record> records(capacity - 4);
+    ASSERT_EQ(this->gate.push(records.data(), records.size()), records.size());
+
+    this->gate.commit(records.size());
+    drainCleanup(this->gate);
+
+    std::vector<Record> wrapped(10);
+    for (std::uint64_t i = 0; i < wrapped.size(); ++i) wrapped[i].sequence = i;
+    ASSERT_EQ(this->gate.push(wrapped.data(), wrapped.size()), wrapped.size());
+
+    auto tail = this->gate.fetch(capacity);
+    ASSERT_EQ(tail.recordCount, 4);
+    EXPECT_EQ(tail.data[3].sequence, 3);
+    this->gate.commit(tail.recordCount);
+
+    auto head = this->gate.fetch(capacity);
+    ASSERT_EQ(head.recordCount, 6);
+    EXPECT_EQ(head.data[0].sequence, 4);
+}
+
+TYPED_TEST(InputGateTest, PushClampsToFreeSlots) {
+    std::vector<Record> records(TestFixture::DEFAULT_CAPACITY + 16);
+    EXPECT_EQ(this->gate.push(records.data(), records.size()), TestFixture::DEFAULT_CAPACITY);
+    EXPECT_EQ(this->gate.push(records.data(), 1), 0);
+}
+
+// ============================================================================
+// Concurrent Access Tests
+// ============================================================================
+
+TYPED_TEST(InputGateTest, ProducerOperatorPreservesOrder) {
+    constexpr std::uint64_t NUM_RECORDS = 20000;
+    std::atomic<bool> stop{false};
+
+    std::thread producer([&]() {
+        for (std::uint64_t i = 0; i < NUM_RECORDS; ++i) {
+            while (!this->gate.emplace(Record{i, {}})) {
+                this->gate.service();
+                std::this_thread::yield();
+            }
+            this->gate.service();
+        }
+        while (!stop.load()) {
+            this->gate.service();
+            std::this_thread::yield();
+        }
+    });
+
+    std::uint64_t expected = 0;
+    while (expected < NUM_RECORDS) {
+        auto batch = this->gate.fetch(16);
+        if (batch.recordCount == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (std::size_t i = 0; i < batch.recordCount; ++i) {
+            ASSERT_EQ(batch.data[i].sequence, expected++);
+        }
+        this->gate.commit(batch.recordCount);
+    }
+
+    stop.store(true);
+    producer.join();
+}
+
+// ============================================================================
+// Cleanup Policy Tests
+// ============================================================================
+
+TEST(InputGateCleanupTest, SynchronousCleanupDestroysOnCommit) {
+    {
+        InputGate<TrackedRecord, SynchronousCleanup> gate(8);
+        gate.emplace(1U);
+        gate.emplace(2U);
+        ASSERT_EQ(TrackedRecord::live.load(), 2);
+
+        gate.commit(1);
+        EXPECT_EQ(TrackedRecord::live.load(), 1);
+    }
+    EXPECT_EQ(TrackedRecord::live.load(), 0);
+}
+
+TEST(InputGateCleanupTest, DeferredCleanupWaitsForService) {
+    {
+        InputGate<TrackedRecord, DeferredCleanup> gate(8);
+        gate.emplace(1U);
+        gate.emplace(2U);
+
+        gate.commit(2);
+        EXPECT_EQ(TrackedRecord::live.load(), 2);
+        EXPECT_EQ(gate.cleanedIndex(), 0);
+
+        EXPECT_EQ(gate.service(), 2);
+        EXPECT_EQ(TrackedRecord::live.load(), 0);
+        EXPECT_EQ(gate.cleanedIndex(), 2);
+    }
+    EXPECT_EQ(TrackedRecord::live.load(), 0);
+}
+
+TEST(InputGateCleanupTest, DestructorReleasesCommittedButUncleanedRecords) {
+    {
+        InputGate<TrackedRecord, DeferredCleanup> gate(8);
+        gate.emplace(1U);
+        gate.emplace(2U);
+        gate.emplace(3U);
+        gate.commit(2);
+    }
+    EXPECT_EQ(TrackedRecord::live.load(), 0);
+}
+
+TEST(InputGateCleanupTest, SignaledCleanupWakesParkedThread) {
+    InputGate<TrackedRecord, SignaledCleanup> gate(8);
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> cleaned{0};
+
+    std::thread cleaner([&]() {
+        while (!stop.load()) {
+            cleaned.fetch_add(gate.service());
+            gate.waitForCommits(stop);
+        }
+        cleaned.fetch_add(gate.service());
+    });
+
+    gate.emplace(1U);
+    gate.emplace(2U);
+    gate.commit(2);
+
+    while (cleaned.load() < 2) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(TrackedRecord::live.load(), 0);
+
+    stop.store(true);
+    gate.wakeCleanup();
+    cleaner.join();
+}
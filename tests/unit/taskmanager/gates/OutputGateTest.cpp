@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include <gates/OutputGate.h>
+#include <gates/Partitioners.h>
+
+#include <channels/InMemoryChannel.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace lute::tm::gates;
+using lute::tm::channels::InMemoryChannel;
+
+namespace {
+
+struct Record {
+    std::uint64_t key;
+    std::uint64_t sequence;
+};
+
+struct KeyOf {
+    std::uint64_t operator()(const Record& record) const noexcept { return record.key; }
+};
+
+/**
+ * One downstream channel per partition, and the pointers the gate takes
+ */
+struct Downstream {
+    explicit Downstream(const std::size_t partitions, const std::size_t bytes = 1 << 16) {
+        for (std::size_t i = 0; i < partitions; ++i) {
+            owned.push_back(std::make_unique<InMemoryChannel>(bytes));
+            channels.push_back(owned.back().get());
+        }
+    }
+
+    /**
+     * Everything published to \p partition so far, consumed
+     */
+    std::vector<Record> drain(const std::size_t partition) {
+        std::vector<Record> records(channels[partition]->peek().size() / sizeof(Record));
+        channels[partition]->receive(records.data(), records.size() * sizeof(Record));
+        return records;
+    }
+
+    std::vector<std::unique_ptr<InMemoryChannel>> owned;
+    std::vector<InMemoryChannel*> channels;
+};
+
+std::vector<Record> records(const std::size_t count) {
+    std::vector<Record> result(count);
+    for (std::size_t i = 0; i < count; ++i) result[i] = Record{ i * 7919 % 1000, i };
+    return result;
+}
+
+} // namespace
+
+// ============================================================================
+// Partitioners
+// ============================================================================
+
+TEST(PartitionerTest, HashAssignsKernelPartitionsAcrossBatches) {
+    const std::vector<Record> input = records(PARTITION_BATCH * 2 + 5);
+    HashPartitioner partitioner(12, KeyOf{});
+
+    std::vector<std::uint32_t> assigned(input.size());
+    partitioner.assign(input.data(), input.size(), assigned.data());
+
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        EXPECT_EQ(assigned[i], lute::tm::columnar::partition_of(lute::tm::columnar::hash_key(input[i].key), 12));
+    }
+}
+
+TEST(PartitionerTest, RangeBoundsAreLowerBoundsOfTheNextPartition) {
+    RangePartitioner partitioner({ 10, 20, 20, 30 }, KeyOf{});
+    EXPECT_EQ(partitioner.partitions(), 5u);
+
+    const std::vector<Record> input{ {0, 0}, {9, 0}, {10, 0}, {19, 0}, {20, 0}, {29, 0}, {30, 0}, {~0ull, 0} };
+    std::vector<std::uint32_t> assigned(input.size());
+    partitioner.assign(input.data(), input.size(), assigned.data());
+
+    // Partition 2 ([20, 20)) is empty
+    EXPECT_EQ(assigned, (std::vector<std::uint32_t>{ 0, 0, 1, 1, 3, 3, 4, 4 }));
+}
+
+TEST(PartitionerTest, RoundRobinCarriesItsTurnAcrossBatches) {
+    RoundRobinPartitioner partitioner(3);
+    const std::vector<Record> input = records(4);
+
+    std::vector<std::uint32_t> assigned(4);
+    partitioner.assign(input.data(), 4, assigned.data());
+    EXPECT_EQ(assigned, (std::vector<std::uint32_t>{ 0, 1, 2, 0 }));
+    partitioner.assign(input.data(), 4, assigned.data());
+    EXPECT_EQ(assigned, (std::vector<std::uint32_t>{ 1, 2, 0, 1 }));
+}
+
+// ============================================================================
+// Staging and Publishing
+// ============================================================================
+
+TEST(OutputGateTest, DefaultStagingStaysWithinBudget) {
+    using Gate = OutputGate<Record, InMemoryChannel, RoundRobinPartitioner>;
+
+    EXPECT_EQ(Gate::defaultStaging(1) * sizeof(Record), Gate::MAX_STAGING_BYTES);
+    for (const std::size_t partitions : { 1u, 16u, 64u, 1024u }) {
+        EXPECT_LE(Gate::defaultStaging(partitions) * sizeof(Record) * partitions, Gate::STAGING_BUDGET);
+    }
+    EXPECT_EQ(Gate::defaultStaging(1 << 20), 1u);
+}
+
+TEST(OutputGateTest, PublishesEachFullBufferAtOnce) {
+    Downstream downstream(2);
+    OutputGate<Record, InMemoryChannel, RangePartitioner<KeyOf>> gate(downstream.channels, RangePartitioner({ 100 }, KeyOf{}), 8);
+
+    std::vector<Record> input(7, Record{ 1, 0 });
+    EXPECT_EQ(gate.push(input.data(), input.size()), 7u);
+    EXPECT_EQ(gate.staged(0), 7u);
+    EXPECT_EQ(gate.publishes(), 0u);
+    EXPECT_TRUE(downstream.channels[0]->peek().empty());
+
+    EXPECT_EQ(gate.push(input.data(), 1), 1u);
+    EXPECT_EQ(gate.staged(0), 0u);
+    EXPECT_EQ(gate.publishes(), 1u);
+    EXPECT_EQ(downstream.channels[0]->peek().size(), 8 * sizeof(Record));
+    EXPECT_TRUE(downstream.channels[1]->peek().empty());
+}
+
+TEST(OutputGateTest, HashShuffleDeliversEveryRecordInOrderPerPartition) {
+    constexpr std::size_t PARTITIONS = 7;
+    Downstream downstream(PARTITIONS);
+    OutputGate<Record, InMemoryChannel, HashPartitioner<KeyOf>> gate(downstream.channels, HashPartitioner(PARTITIONS, KeyOf{}), 16);
+
+    const std::vector<Record> input = records(3000);
+    ASSERT_EQ(gate.push(input.data(), input.size()), input.size());
+    EXPECT_TRUE(gate.flush());
+
+    std::size_t delivered = 0;
+    for (std::size_t partition = 0; partition < PARTITIONS; ++partition) {
+        const std::vector<Record> received = downstream.drain(partition);
+        delivered += received.size();
+
+        for (std::size_t i = 0; i < received.size(); ++i) {
+            EXPECT_EQ(lute::tm::columnar::partition_of(lute::tm::columnar::hash_key(received[i].key), PARTITIONS), partition);
+            if (i != 0) {
+                EXPECT_LT(received[i - 1].sequence, received[i].sequence);
+            }
+        }
+    }
+
+    EXPECT_EQ(delivered, input.size());
+    EXPECT_EQ(gate.published(), input.size());
+    EXPECT_LT(gate.publishes(), input.size() / 10);
+}
+
+TEST(OutputGateTest, FullChannelStopsThePushWithoutLosingRecords) {
+    // Room for 16 records downstream, 4 staged
+    Downstream downstream(1, 256);
+    OutputGate<Record, InMemoryChannel, RoundRobinPartitioner> gate(downstream.channels, RoundRobinPartitioner(1), 4);
+
+    const std::vector<Record> input = records(40);
+    std::vector<Record> received;
+
+    std::size_t sent = 0;
+    while (sent < input.size()) {
+        const std::size_t accepted = gate.push(input.data() + sent, input.size() - sent);
+        sent += accepted;
+        if (sent < input.size()) {
+            EXPECT_EQ(gate.staged(0), 4u);
+            const std::vector<Record> batch = downstream.drain(0);
+            received.insert(received.end(), batch.begin(), batch.end());
+        }
+    }
+    while (!gate.flush()) {
+        const std::vector<Record> batch = downstream.drain(0);
+        received.insert(received.end(), batch.begin(), batch.end());
+    }
+    const std::vector<Record> rest = downstream.drain(0);
+    received.insert(received.end(), rest.begin(), rest.end());
+
+    ASSERT_EQ(received.size(), input.size());
+    for (std::size_t i = 0; i < received.size(); ++i) EXPECT_EQ(received[i].sequence, i);
+    EXPECT_GT(gate.stalls(), 0u);
+}
+
+TEST(OutputGateTest, PartialPublishKeepsTheRemainderStaged) {
+    // The channel takes 3 of the 4 staged records; a record never straddles the publish
+    Downstream downstream(1, 64);
+    OutputGate<Record, InMemoryChannel, RoundRobinPartitioner> gate(downstream.channels, RoundRobinPartitioner(1), 4);
+
+    const std::vector<Record> filler(1);
+    ASSERT_EQ(downstream.channels[0]->send(filler.data(), 8), 8u);
+
+    const std::vector<Record> input = records(4);
+    ASSERT_EQ(gate.push(input.data(), 4), 4u);
+    EXPECT_EQ(gate.staged(0), 1u);
+    EXPECT_EQ(gate.published(), 3u);
+    EXPECT_EQ(downstream.channels[0]->peek().size(), 8 + 3 * sizeof(Record));
+}
@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+#include <layout/RecordLayout.h>
+#include <layout/Schema.h>
+
+#include <channels/InMemoryChannel.h>
+#include <channels/RecordFraming.h>
+#include <gates/InputGate.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+using namespace lute::tm::layout;
+
+namespace {
+
+enum class Side : std::uint8_t { Buy = 1, Sell = 2 };
+
+using Trade = RecordLayout<
+    Field<std::uint64_t>,                       // event time
+    Field<std::uint32_t>,                       // quantity
+    Field<std::int64_t>,                        // price, in ticks
+    Bytes<4>,                                   // symbol
+    Field<std::uint16_t, ByteOrder::Big>,       // venue, as the exchange feed sends it
+    Field<Side>>;
+
+enum TradeField : std::size_t { TIME, QUANTITY, PRICE, SYMBOL, VENUE, SIDE };
+
+// The layout is fixed by its fields alone; these hold on every compiler and architecture
+static_assert(Trade::offsets == std::array<std::size_t, 6>{ 0, 8, 16, 24, 28, 30 });
+static_assert(Trade::size == 32 && Trade::alignment == 8);
+
+// Schema evolution: v2 adds a price, v3 widens the quantity and adds a symbol
+using TradeV1 = RecordLayout<Field<std::uint64_t>, Field<std::uint32_t>>;
+using TradeV2 = RecordLayout<Field<std::uint64_t>, Field<std::uint32_t>, Field<std::int64_t>>;
+using TradeV3 = RecordLayout<Field<std::uint64_t>, Field<std::uint64_t>, Field<std::int64_t>, Bytes<4>>;
+
+constexpr std::uint16_t TRADES = 7;
+using Trades = Schema<TRADES, TradeV1, TradeV2, TradeV3>;
+using TradesAtV1 = Schema<TRADES, TradeV1>;     // what an old producer still writes
+
+static_assert(Trades::version == 3 && Trades::recordBytes == 8 + 32 && Trades::maxRecordBytes == 40);
+
+std::vector<std::byte> tradeV1(const std::uint64_t time, const std::uint32_t quantity) {
+    std::vector<std::byte> record(TradesAtV1::recordBytes);
+    TradesAtV1::initialize(record.data()).set<0>(time).set<1>(quantity);
+    return record;
+}
+
+std::vector<std::byte> tradeV3(const std::uint64_t time, const std::uint64_t quantity, const std::int64_t price) {
+    std::vector<std::byte> record(Trades::recordBytes);
+    auto writer = Trades::initialize(record.data()).set<0>(time).set<1>(quantity).set<2>(price);
+    std::memcpy(writer.bytes<3>().data(), "LUTE", 4);
+    return record;
+}
+
+} // namespace
+
+// ============================================================================
+// Layout
+// ============================================================================
+
+TEST(RecordLayoutTest, WritesExplicitByteOrder) {
+    alignas(8) std::array<std::byte, Trade::size> record{};
+    RecordWriter<Trade> writer(record.data());
+    writer.clear().set<QUANTITY>(0x01020304u).set<VENUE>(0x0a0b).set<PRICE>(-2).set<SIDE>(Side::Sell);
+
+    EXPECT_EQ(record[8], std::byte{0x04});      // little-endian
+    EXPECT_EQ(record[11], std::byte{0x01});
+    EXPECT_EQ(record[28], std::byte{0x0a});     // big-endian
+    EXPECT_EQ(record[29], std::byte{0x0b});
+
+    const RecordView<Trade> view(record.data());
+    EXPECT_EQ(view.get<QUANTITY>(), 0x01020304u);
+    EXPECT_EQ(view.get<VENUE>(), 0x0a0b);
+    EXPECT_EQ(view.get<PRICE>(), -2);
+    EXPECT_EQ(view.get<SIDE>(), Side::Sell);
+}
+
+TEST(RecordLayoutTest, BytesFieldsAreViewedInPlace) {
+    alignas(8) std::array<std::byte, Trade::size> record{};
+    RecordWriter<Trade> writer(record.data());
+    std::memcpy(writer.bytes<SYMBOL>().data(), "ABCD", 4);
+
+    const auto symbol = RecordView<Trade>(record.data()).get<SYMBOL>();
+    EXPECT_EQ(symbol.data(), record.data() + 24);
+    EXPECT_EQ(std::memcmp(symbol.data(), "ABCD", 4), 0);
+}
+
+TEST(RecordLayoutTest, FingerprintCoversTypesOrderAndPlacement) {
+    using Same = RecordLayout<Field<std::uint64_t>, Field<std::uint32_t>>;
+    using Swapped = RecordLayout<Field<std::uint64_t>, Field<std::uint32_t, ByteOrder::Big>>;
+    using Signed = RecordLayout<Field<std::uint64_t>, Field<std::int32_t>>;
+    using Moved = RecordLayout<Field<std::uint32_t>, Field<std::uint64_t>>;
+
+    static_assert(Same::fingerprint == TradeV1::fingerprint);
+    // Pinned: a different value means records written by older builds no longer verify
+    static_assert(TradeV1::fingerprint == 0x0fb29b5654e10bc1);
+    EXPECT_NE(Swapped::fingerprint, TradeV1::fingerprint);
+    EXPECT_NE(Signed::fingerprint, TradeV1::fingerprint);
+    EXPECT_NE(Moved::fingerprint, TradeV1::fingerprint);
+}
+
+// ============================================================================
+// Schema Evolution
+// ============================================================================
+
+TEST(SchemaReaderTest, ReadsCurrentRecordsInPlace) {
+    const std::vector<std::byte> record = tradeV3(100, 5, 990);
+    SchemaReader<Trades> reader;
+
+    const auto view = reader.read(record);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->data(), record.data() + RecordHeader::size);
+    EXPECT_EQ(view->get<0>(), 100u);
+    EXPECT_EQ(view->get<1>(), 5u);
+    EXPECT_EQ(view->get<2>(), 990);
+    EXPECT_EQ(reader.upgraded(), 0u);
+}
+
+TEST(SchemaReaderTest, UpgradesOldVersionsThroughTheChain) {
+    const std::vector<std::byte> record = tradeV1(100, 0xffffffffu);
+    SchemaReader<Trades> reader;
+
+    const auto view = reader.read(record);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->get<0>(), 100u);
+    EXPECT_EQ(view->get<1>(), 0xffffffffu);     // widened to 64 bits
+    EXPECT_EQ(view->get<2>(), 0);               // added in v2
+    for (const std::byte b : view->get<3>()) EXPECT_EQ(b, std::byte{0});
+    EXPECT_EQ(reader.upgraded(), 1u);
+}
+
+TEST(SchemaReaderTest, RejectsForeignNewerAndTruncatedRecords) {
+    SchemaReader<Trades> reader;
+
+    std::vector<std::byte> foreign = tradeV3(1, 1, 1);
+    RecordWriter<RecordHeader>(foreign.data()).set<HEADER_SCHEMA>(TRADES + 1);
+    EXPECT_FALSE(reader.read(foreign));
+
+    std::vector<std::byte> newer = tradeV3(1, 1, 1);
+    RecordWriter<RecordHeader>(newer.data()).set<HEADER_VERSION>(4);
+    EXPECT_FALSE(reader.read(newer));
+
+    const std::vector<std::byte> whole = tradeV3(1, 1, 1);
+    EXPECT_FALSE(reader.read(std::span(whole).first(whole.size() - 1)));
+    EXPECT_FALSE(reader.read(std::span(whole).first(4)));
+
+    std::vector<std::byte> shortBody = tradeV1(1, 1);
+    RecordWriter<RecordHeader>(shortBody.data()).set<HEADER_VERSION>(2);    // claims v2 with a v1 body
+    EXPECT_FALSE(reader.read(shortBody));
+
+    EXPECT_EQ(reader.rejected(), 5u);
+}
+
+namespace {
+
+// Price was in whole dollars in v1; v2 has it in cents, with a currency code
+using QuoteV1 = RecordLayout<Field<std::int64_t>>;
+using QuoteV2 = RecordLayout<Field<std::int64_t>, Field<std::uint16_t>>;
+using Quotes = Schema<9, QuoteV1, QuoteV2>;
+
+constexpr std::uint16_t USD = 840;
+
+} // namespace
+
+template<>
+struct lute::tm::layout::Migration<QuoteV1, QuoteV2> {
+    static void apply(const RecordView<QuoteV1> from, RecordWriter<QuoteV2> to) noexcept {
+        to.clear().set<0>(from.get<0>() * 100).set<1>(USD);
+    }
+};
+
+TEST(SchemaReaderTest, UsesSpecialisedMigrations) {
+    std::vector<std::byte> record(Schema<9, QuoteV1>::recordBytes);
+    Schema<9, QuoteV1>::initialize(record.data()).set<0>(12);
+
+    SchemaReader<Quotes> reader;
+    const auto view = reader.read(record);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->get<0>(), 1200);
+    EXPECT_EQ(view->get<1>(), USD);
+}
+
+// ============================================================================
+// Channels and Gates
+// ============================================================================
+
+TEST(SchemaReaderTest, ReadsFramePayloadsWithoutCopying) {
+    using namespace lute::tm::channels;
+    InMemoryChannel channel(4096);
+    FramedWriter<InMemoryChannel> writer(channel);
+    FramedReader<InMemoryChannel> framed(channel);
+
+    const std::vector<std::byte> current = tradeV3(1, 10, 100);
+    const std::vector<std::byte> old = tradeV1(2, 20);
+    ASSERT_TRUE(writer.append(current));
+    ASSERT_TRUE(writer.append(old));
+    writer.flush();
+
+    SchemaReader<Trades> reader;
+    std::vector<std::uint64_t> quantities;
+    const FrameBatch batch = framed.fetch(8);
+    for (const Frame frame : batch) {
+        const auto view = reader.read(frame.payload);
+        ASSERT_TRUE(view.has_value());
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view->data()) % RECORD_ALIGNMENT, 0u);
+        quantities.push_back(view->get<1>());
+    }
+
+    EXPECT_EQ(quantities, (std::vector<std::uint64_t>{ 10, 20 }));
+    EXPECT_EQ(reader.upgraded(), 1u);
+}
+
+TEST(SchemaReaderTest, ReadsGateSlotsInPlace) {
+    lute::tm::gates::InputGate<SchemaSlot<Trades>> gate(4);
+
+    SchemaSlot<Trades> slot;
+    slot.initialize().set<0>(7).set<1>(70);
+    ASSERT_TRUE(gate.push(&slot, 1));
+
+    const auto batch = gate.fetch(1);
+    ASSERT_EQ(batch.recordCount, 1u);
+
+    SchemaReader<Trades> reader;
+    const auto view = reader.read(batch.data[0].record());
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->data(), batch.data[0].bytes + RecordHeader::size);
+    EXPECT_EQ(view->get<1>(), 70u);
+    gate.commit(1);
+}
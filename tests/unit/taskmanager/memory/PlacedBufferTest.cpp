@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <channels/InMemoryChannel.h>
+#include <gates/InputGate.h>
+#include <memory/PlacedBuffer.h>
+
+#include <cstdint>
+#include <utility>
+
+using namespace lute::tm::memory;
+
+// ============================================================================
+// Allocation Tests
+// ============================================================================
+
+TEST(PlacedBufferTest, DefaultPlacementUsesAlignedHeap) {
+    PlacedBuffer buffer(1000, {}, 128);
+    ASSERT_NE(buffer.get(), nullptr);
+    EXPECT_EQ(buffer.size(), 1000);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer.get()) % 128, 0);
+    EXPECT_FALSE(buffer.bound());
+}
+
+TEST(PlacedBufferTest, NodePlacementIsUsableWithOrWithoutNumaSupport) {
+    const int node = current_node() == MemoryPlacement::ANY_NODE ? 0 : current_node();
+    PlacedBuffer buffer(10000, MemoryPlacement{ .node = node, .policy = NumaPolicy::Preferred });
+
+    ASSERT_NE(buffer.get(), nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer.get()) % 4096, 0);
+    buffer.get()[9999] = std::byte{1};
+    EXPECT_EQ(buffer.get()[9999], std::byte{1});
+}
+
+TEST(PlacedBufferTest, HugePageRequestFallsBackGracefully) {
+    PlacedBuffer buffer(3 * PlacedBuffer::HUGE_PAGE_SIZE,
+                        MemoryPlacement{ .policy = NumaPolicy::FirstTouch, .hugePages = HugePages::IfAvailable });
+
+    ASSERT_NE(buffer.get(), nullptr);
+    buffer.get()[buffer.size() - 1] = std::byte{2};
+    EXPECT_EQ(buffer.get()[buffer.size() - 1], std::byte{2});
+}
+
+TEST(PlacedBufferTest, MoveTransfersOwnership) {
+    PlacedBuffer first(4096, MemoryPlacement{ .policy = NumaPolicy::FirstTouch });
+    std::byte* data = first.get();
+
+    PlacedBuffer second(std::move(first));
+    EXPECT_EQ(first.get(), nullptr);
+    EXPECT_EQ(second.get(), data);
+
+    PlacedBuffer third;
+    third = std::move(second);
+    EXPECT_EQ(third.get(), data);
+}
+
+// ============================================================================
+// Channel and Gate Placement Tests
+// ============================================================================
+
+TEST(PlacedBufferTest, ChannelAndGateAcceptPlacementHints) {
+    const MemoryPlacement placement{ .node = 0, .policy = NumaPolicy::Preferred, .hugePages = HugePages::IfAvailable };
+
+    lute::tm::channels::InMemoryChannel channel(1 << 12, placement);
+    std::uint64_t value = 11;
+    ASSERT_EQ(channel.send(&value, sizeof(value)), sizeof(value));
+    std::uint64_t out = 0;
+    ASSERT_EQ(channel.receive(&out, sizeof(out)), sizeof(out));
+    EXPECT_EQ(out, value);
+
+    lute::tm::gates::InputGate<std::uint64_t> gate(64, placement);
+    ASSERT_TRUE(gate.emplace(value));
+    EXPECT_EQ(*gate.fetch().data, value);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <metrics/Histogram.h>
+
+#include <cstdint>
+#include <thread>
+
+using namespace lute::tm::metrics;
+
+// ============================================================================
+// Bucket Layout Tests
+// ============================================================================
+
+TEST(HistogramTest, SmallValuesAreExact) {
+    for (std::uint64_t v = 0; v < Histogram::SUB_BUCKETS; ++v) {
+        EXPECT_EQ(Histogram::bucket_of(v), v);
+        EXPECT_EQ(Histogram::lower_bound(v), v);
+        EXPECT_EQ(Histogram::upper_bound(v), v);
+    }
+}
+
+TEST(HistogramTest, BucketsAreContiguousAndWithinRelativeError) {
+    for (std::size_t b = 0; b + 1 < Histogram::BUCKETS; ++b) {
+        ASSERT_EQ(Histogram::upper_bound(b) + 1, Histogram::lower_bound(b + 1));
+        ASSERT_EQ(Histogram::bucket_of(Histogram::lower_bound(b)), b);
+        ASSERT_EQ(Histogram::bucket_of(Histogram::upper_bound(b)), b);
+
+        const double width = static_cast<double>(Histogram::upper_bound(b) - Histogram::lower_bound(b));
+        ASSERT_LE(width / static_cast<double>(std::max<std::uint64_t>(Histogram::lower_bound(b), 1)),
+                  1.0 / Histogram::SUB_BUCKETS);
+    }
+}
+
+TEST(HistogramTest, HugeValuesSaturate) {
+    EXPECT_EQ(Histogram::bucket_of(UINT64_MAX), Histogram::BUCKETS - 1);
+}
+
+// ============================================================================
+// Recording Tests
+// ============================================================================
+
+TEST(HistogramTest, PercentilesOfUniformValues) {
+    Histogram histogram;
+    for (std::uint64_t v = 1; v <= 10000; ++v) histogram.record(v);
+
+    const HistogramSnapshot snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count(), 10000u);
+    EXPECT_EQ(snapshot.max(), 10000u);
+    EXPECT_DOUBLE_EQ(snapshot.mean(), 5000.5);
+
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(0.5)), 5000.0, 5000.0 / Histogram::SUB_BUCKETS);
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(0.99)), 9900.0, 9900.0 / Histogram::SUB_BUCKETS);
+    EXPECT_EQ(snapshot.percentile(1.0), 10000u);
+    EXPECT_EQ(snapshot.percentile(0.0), 1u);
+}
+
+TEST(HistogramTest, SnapshotDifferenceCoversInterval) {
+    Histogram histogram;
+    for (int i = 0; i < 100; ++i) histogram.record(10);
+    const HistogramSnapshot first = histogram.snapshot();
+
+    for (int i = 0; i < 100; ++i) histogram.record(1000);
+    const HistogramSnapshot interval = histogram.snapshot() - first;
+
+    EXPECT_EQ(interval.count(), 100u);
+    EXPECT_EQ(interval.sum(), 100000u);
+    EXPECT_GE(interval.percentile(0.01), 1000u - 1000u / Histogram::SUB_BUCKETS);
+}
+
+TEST(HistogramTest, ReaderNeverSeesCountsGoBackwards) {
+    Histogram histogram;
+    std::atomic<bool> stop{false};
+
+    std::thread writer([&]() {
+        std::uint64_t v = 0;
+        while (!stop.load(std::memory_order_relaxed)) histogram.record(v++ % 5000);
+    });
+
+    std::uint64_t last = 0;
+    for (int i = 0; i < 200; ++i) {
+        const std::uint64_t count = histogram.snapshot().count();
+        ASSERT_GE(count, last);
+        last = count;
+    }
+
+    stop = true;
+    writer.join();
+}
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include <metrics/ChannelMetrics.h>
+#include <metrics/GateMetrics.h>
+
+#include <channels/InMemoryChannel.h>
+#include <channels/RecordFraming.h>
+#include <gates/InputGate.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using namespace lute::tm::metrics;
+using namespace lute::tm::channels;
+using namespace lute::tm::gates;
+
+namespace {
+
+constexpr std::uint64_t HAND_OFFS = 20;
+constexpr auto PAUSE = std::chrono::milliseconds(2);
+constexpr auto PAUSE_NS = static_cast<std::uint64_t>(std::chrono::nanoseconds(PAUSE).count());
+
+/**
+ * Returns from publish only once the consumer has released what it published, so the release always lands
+ * between the data becoming visible and the metered wrapper getting control back
+ */
+struct HandOffChannel : InMemoryChannel {
+    using InMemoryChannel::InMemoryChannel;
+
+    void publish(const std::size_t size) noexcept {
+        InMemoryChannel::publish(size);
+        while (released.load(std::memory_order_acquire) != published + 1) std::this_thread::yield();
+        ++published;
+    }
+
+    std::uint64_t published = 0;
+    std::atomic<std::uint64_t> released{0};
+};
+
+/**
+ * The same for records committed from an InputGate
+ */
+struct HandOffGate : InputGate<std::uint64_t> {
+    using InputGate::InputGate;
+
+    bool emplace(const std::uint64_t record) noexcept {
+        if (!InputGate::emplace(record)) return false;
+        ++pushed;
+        while (committed.load(std::memory_order_acquire) != pushed) std::this_thread::yield();
+        return true;
+    }
+
+    std::uint64_t pushed = 0;
+    std::atomic<std::uint64_t> committed{0};
+};
+
+} // namespace
+
+// ============================================================================
+// Channel Tests
+// ============================================================================
+
+class MeteredChannelTest : public ::testing::Test {
+protected:
+    static constexpr std::size_t CAPACITY = 64;
+
+    InMemoryChannel inner{CAPACITY};
+    ChannelMetrics metrics;
+    MeteredChannel<InMemoryChannel> channel{inner, metrics};
+};
+
+TEST_F(MeteredChannelTest, CountsBytesAndBatches) {
+    const std::uint64_t value = 7;
+    std::uint64_t out = 0;
+
+    ASSERT_EQ(channel.send(&value, sizeof(value)), sizeof(value));
+    ASSERT_EQ(channel.send(&value, sizeof(value)), sizeof(value));
+    ASSERT_EQ(channel.receive(&out, sizeof(out)), sizeof(out));
+
+    EXPECT_EQ(metrics.bytesIn.load(), 16u);
+    EXPECT_EQ(metrics.publishes.load(), 2u);
+    EXPECT_EQ(metrics.bytesOut.load(), 8u);
+    EXPECT_EQ(metrics.releases.load(), 1u);
+    EXPECT_EQ(metrics.occupancy.snapshot().max(), 8u);
+}
+
+TEST_F(MeteredChannelTest, LatencyRecordedOncePublishIsFullyReleased) {
+    const std::uint64_t values[2] = {1, 2};
+    std::uint64_t out = 0;
+
+    channel.send(values, sizeof(values));
+    channel.receive(&out, sizeof(out));
+    EXPECT_EQ(metrics.latencyNs.snapshot().count(), 0u);
+
+    channel.receive(&out, sizeof(out));
+    EXPECT_EQ(metrics.latencyNs.snapshot().count(), 1u);
+}
+
+TEST_F(MeteredChannelTest, CountsFullAndEmptyStalls) {
+    std::uint64_t out = 0;
+    EXPECT_EQ(channel.receive(&out, sizeof(out)), 0u);
+    EXPECT_EQ(metrics.emptyStalls.load(), 1u);
+
+    std::byte fill[CAPACITY]{};
+    channel.send(fill, CAPACITY);
+    EXPECT_EQ(channel.send(fill, 1), 0u);
+    EXPECT_EQ(metrics.fullStalls.load(), 1u);
+}
+
+TEST_F(MeteredChannelTest, WorksUnderFraming) {
+    constexpr std::uint64_t NUM_RECORDS = 20000;
+
+    std::thread producer([&]() {
+        FramedWriter<MeteredChannel<InMemoryChannel>> writer(channel, BatchPolicy{ .maxRecords = 4, .maxBytes = 32, .maxDelay = {} });
+        for (std::uint64_t i = 0; i < NUM_RECORDS; ++i) {
+            const std::span<const std::byte> bytes{ reinterpret_cast<const std::byte*>(&i), sizeof(i) };
+            while (!writer.append(bytes)) std::this_thread::yield();
+        }
+        writer.flush();
+    });
+
+    FramedReader<MeteredChannel<InMemoryChannel>> reader(channel);
+    std::uint64_t received = 0;
+    while (received < NUM_RECORDS) {
+        const FrameBatch batch = reader.fetch();
+        received += batch.size();
+        reader.release(batch);
+    }
+    producer.join();
+
+    EXPECT_EQ(metrics.bytesIn.load(), metrics.bytesOut.load());
+    EXPECT_GT(metrics.latencyNs.snapshot().count(), 0u);
+    EXPECT_LE(metrics.latencyNs.snapshot().count(), metrics.publishes.load());
+}
+
+/**
+ * The consumer releases every publish before publish returns, then idles while the producer pauses: each
+ * latency must be the hand-off alone, never the pause before the next release
+ */
+TEST(MeteredChannelLatencyTest, ExcludesTheConsumersIdleTime) {
+    HandOffChannel inner(64);
+    ChannelMetrics metrics;
+    MeteredChannel<HandOffChannel> channel(inner, metrics);
+
+    std::thread consumer([&]() {
+        for (std::uint64_t released = 0; released < HAND_OFFS;) {
+            const ReadableRegion region = channel.peek();
+            if (region.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            channel.release(region.size());
+            inner.released.store(++released, std::memory_order_release);
+        }
+    });
+
+    for (std::uint64_t i = 0; i < HAND_OFFS; ++i) {
+        ASSERT_EQ(channel.send(&i, sizeof(i)), sizeof(i));
+        std::this_thread::sleep_for(PAUSE);
+    }
+    consumer.join();
+
+    const HistogramSnapshot latency = metrics.latencyNs.snapshot();
+    EXPECT_EQ(latency.count(), HAND_OFFS);
+    EXPECT_LT(latency.percentile(0.5), PAUSE_NS / 2);
+}
+
+// ============================================================================
+// Gate Tests
+// ============================================================================
+
+TEST(MeteredInputGateTest, CountsRecordsStallsAndLatency) {
+    InputGate<std::uint64_t> inner(4);
+    GateMetrics metrics;
+    MeteredInputGate gate(inner, metrics);
+
+    EXPECT_EQ(gate.fetch(4).recordCount, 0u);
+    EXPECT_EQ(metrics.emptyStalls.load(), 1u);
+
+    const std::uint64_t records[5] = {1, 2, 3, 4, 5};
+    EXPECT_EQ(gate.push(records, 5), 4u);
+    EXPECT_EQ(metrics.fullStalls.load(), 1u);
+    EXPECT_FALSE(gate.emplace(6u));
+    EXPECT_EQ(metrics.fullStalls.load(), 2u);
+
+    const auto batch = gate.fetch(4);
+    EXPECT_EQ(batch.recordCount, 4u);
+    EXPECT_EQ(metrics.occupancy.snapshot().max(), 4u);
+
+    gate.commit(2);
+    EXPECT_EQ(metrics.latencyNs.snapshot().count(), 0u);
+    gate.commit(2);
+    EXPECT_EQ(metrics.latencyNs.snapshot().count(), 1u);
+
+    EXPECT_EQ(metrics.recordsIn.load(), 4u);
+    EXPECT_EQ(metrics.recordsOut.load(), 4u);
+    EXPECT_EQ(metrics.commits.load(), 2u);
+}
+
+TEST(MeteredInputGateTest, LatencyExcludesTheOperatorsIdleTime) {
+    HandOffGate inner(16);
+    GateMetrics metrics;
+    MeteredInputGate gate(inner, metrics);
+
+    std::thread operatorThread([&]() {
+        for (std::uint64_t committed = 0; committed < HAND_OFFS;) {
+            const auto batch = gate.fetch(16);
+            if (batch.recordCount == 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            gate.commit(batch.recordCount);
+            committed += batch.recordCount;
+            inner.committed.store(committed, std::memory_order_release);
+        }
+    });
+
+    for (std::uint64_t i = 0; i < HAND_OFFS; ++i) {
+        ASSERT_TRUE(gate.emplace(i));
+        std::this_thread::sleep_for(PAUSE);
+    }
+    operatorThread.join();
+
+    const HistogramSnapshot latency = metrics.latencyNs.snapshot();
+    EXPECT_EQ(latency.count(), HAND_OFFS);
+    EXPECT_LT(latency.percentile(0.5), PAUSE_NS / 2);
+}
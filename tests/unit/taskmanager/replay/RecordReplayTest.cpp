@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+#include <replay/Recorder.h>
+#include <replay/Replayer.h>
+#include <replay/ReplayLog.h>
+
+#include <channels/InMemoryChannel.h>
+#include <channels/RecordFraming.h>
+#include <gates/InputGate.h>
+#include <watermarks/Watermark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace lute::tm::replay;
+using lute::tm::gates::InputGate;
+using lute::tm::watermarks::Element;
+
+namespace {
+
+/**
+ * Clock the tests move by hand
+ */
+struct ManualClock {
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<ManualClock, duration>;
+
+    static inline std::int64_t nanos = 0;
+    static time_point now() noexcept { return time_point(duration(nanos)); }
+};
+
+/**
+ * Recorder sink that concatenates chunks, as the log file does per stream
+ */
+struct Collected {
+    std::vector<std::byte> stream;
+    std::size_t chunks = 0;
+
+    Recorder<ManualClock>::Sink sink() {
+        return [this](std::vector<std::byte>&& chunk) {
+            stream.insert(stream.end(), chunk.begin(), chunk.end());
+            ++chunks;
+        };
+    }
+};
+
+std::span<const std::byte> asBytes(const std::uint64_t& value) {
+    return { reinterpret_cast<const std::byte*>(&value), sizeof(value) };
+}
+
+std::uint64_t valueOf(const std::span<const std::byte> payload) {
+    std::uint64_t value;
+    std::memcpy(&value, payload.data(), sizeof(value));
+    return value;
+}
+
+} // namespace
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+TEST(ReplayEncodingTest, RoundTripsEveryEventKind) {
+    const std::uint64_t payload = 0xfeedface;
+    ReplayEncoder encoder;
+    encoder.record(0, asBytes(payload));
+    encoder.timedRecord(3, 1'000'000'007, asBytes(payload));
+    encoder.watermark(30, 99);
+    encoder.barrier(31, 5);                     // first input that needs the escape
+    encoder.tick(1'500);
+    encoder.watermark(100'000, ~std::uint64_t{0});
+
+    ReplayDecoder decoder(encoder.encoded());
+    std::vector<ReplayEvent> events;
+    while (const auto event = decoder.next()) events.push_back(*event);
+
+    ASSERT_EQ(events.size(), 6u);
+    EXPECT_EQ(events[0].kind, EventKind::Record);
+    EXPECT_EQ(valueOf(events[0].payload), payload);
+    EXPECT_EQ(events[1].kind, EventKind::TimedRecord);
+    EXPECT_EQ(events[1].input, 3u);
+    EXPECT_EQ(events[1].value, 1'000'000'007u);
+    EXPECT_EQ(valueOf(events[1].payload), payload);
+    EXPECT_EQ(events[2].input, 30u);
+    EXPECT_EQ(events[2].value, 99u);
+    EXPECT_EQ(events[3].kind, EventKind::Barrier);
+    EXPECT_EQ(events[3].input, 31u);
+    EXPECT_EQ(events[4].kind, EventKind::Tick);
+    EXPECT_EQ(events[4].value, 1'500u);
+    EXPECT_EQ(events[5].input, 100'000u);
+    EXPECT_EQ(events[5].value, ~std::uint64_t{0});
+}
+
+TEST(ReplayEncodingTest, SmallRecordsStayCompact) {
+    const std::uint64_t payload = 1;
+    ReplayEncoder encoder;
+    encoder.timedRecord(2, 1000, asBytes(payload));
+
+    EXPECT_EQ(encoder.size(), 1 + 2 + 1 + sizeof(payload));     // tag, event time, length, payload
+}
+
+TEST(ReplayEncodingTest, RejectsTruncatedStream) {
+    const std::uint64_t payload = 7;
+    ReplayEncoder encoder;
+    encoder.record(0, asBytes(payload));
+
+    const auto encoded = encoder.encoded();
+    ReplayDecoder decoder(encoded.first(encoded.size() - 1));
+    EXPECT_THROW(decoder.next(), std::runtime_error);
+}
+
+// ============================================================================
+// Record and Replay
+// ============================================================================
+
+TEST(RecordReplayTest, RecordingGateLogsCommittedRecordsOnly) {
+    using Gate = InputGate<Element<std::uint64_t>>;
+    Gate gate(16);
+    Collected collected;
+    Recorder<ManualClock> recorder(collected.sink(), 4096);
+    RecordingGate<Gate, ManualClock> recording(gate, recorder, 2);
+
+    gate.emplace(Element<std::uint64_t>::record(10, 100));
+    gate.emplace(Element<std::uint64_t>::record(11, 110));
+    gate.emplace(Element<std::uint64_t>::watermark(11));
+
+    auto batch = recording.fetch(3);
+    ASSERT_EQ(batch.recordCount, 3u);
+    recording.commit(1);                        // the operator stopped after one record
+    batch = recording.fetch(3);
+    ASSERT_EQ(batch.recordCount, 2u);
+    recording.commit(2);
+    recorder.flush();
+
+    EXPECT_EQ(recorder.events(), 3u);
+    EXPECT_EQ(gate.pending(), 0u);
+
+    Replayer replayer(collected.stream);
+    std::vector<std::string> seen;
+    replayer.poll(
+        [&](std::size_t input, std::uint64_t time, std::span<const std::byte> payload) {
+            seen.push_back(std::to_string(input) + ":" + std::to_string(time) + "=" + std::to_string(valueOf(payload)));
+            return true;
+        },
+        [&](std::size_t input, std::uint64_t watermark) { seen.push_back(std::to_string(input) + ":wm" + std::to_string(watermark)); },
+        [](std::size_t, std::uint64_t) {});
+
+    EXPECT_EQ(seen, (std::vector<std::string>{ "2:10=100", "2:11=110", "2:wm11" }));
+    EXPECT_TRUE(replayer.done());
+}
+
+/**
+ * Three inputs whose consumption interleaves; the replay must reproduce that interleaving and the recorded
+ * time, without waiting for it
+ */
+TEST(RecordReplayTest, ReplaysInterleavingAndRecordedTime) {
+    ManualClock::nanos = 0;
+    Collected collected;
+    Recorder<ManualClock> recorder(collected.sink(), 4096, std::chrono::microseconds(1));
+
+    std::vector<std::pair<std::size_t, std::uint64_t>> expected;
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        ManualClock::nanos += (i % 10 == 0) ? 1'000'000 : 100;       // a 1 ms stall every 10 records
+        recorder.tick();
+
+        const std::size_t input = (i * 7) % 3;
+        recorder.record(static_cast<std::uint32_t>(input), asBytes(i));
+        expected.emplace_back(input, i);
+    }
+    recorder.barrier(1, 4);
+    recorder.flush();
+    EXPECT_GT(collected.chunks, 1u);
+
+    Replayer replayer(collected.stream);
+    std::vector<std::pair<std::size_t, std::uint64_t>> replayed;
+    std::uint64_t checkpoint = 0;
+    const auto started = std::chrono::steady_clock::now();
+    while (!replayer.done()) {
+        replayer.poll(
+            [&](std::size_t input, std::uint64_t, std::span<const std::byte> payload) {
+                replayed.emplace_back(input, valueOf(payload));
+                return true;
+            },
+            [](std::size_t, std::uint64_t) {},
+            [&](std::size_t, std::uint64_t id) { checkpoint = id; },
+            64);
+    }
+
+    EXPECT_EQ(replayed, expected);
+    EXPECT_EQ(checkpoint, 4u);
+    // Steps below the 1 µs resolution fold into the next recorded tick; only the last 9 steps are unrecorded
+    EXPECT_EQ(replayer.recordedNanos(), 100u * 1'000'000 + 891u * 100);
+    EXPECT_LT(std::chrono::steady_clock::now() - started, std::chrono::milliseconds(100));
+}
+
+TEST(RecordReplayTest, RejectedRecordIsDeliveredAgain) {
+    ReplayEncoder encoder;
+    for (std::uint64_t i = 0; i < 4; ++i) encoder.record(0, asBytes(i));
+
+    Replayer replayer(encoder.encoded());
+    std::vector<std::uint64_t> accepted;
+    const auto acceptBelow = [&](const std::uint64_t limit) {
+        return [&accepted, limit](std::size_t, std::uint64_t, std::span<const std::byte> payload) {
+            if (valueOf(payload) >= limit) return false;
+            accepted.push_back(valueOf(payload));
+            return true;
+        };
+    };
+    const auto ignore = [](std::size_t, std::uint64_t) {};
+
+    EXPECT_EQ(replayer.poll(acceptBelow(2), ignore, ignore), 2u);
+    EXPECT_FALSE(replayer.done());
+    EXPECT_EQ(replayer.poll(acceptBelow(10), ignore, ignore), 2u);
+    EXPECT_EQ(accepted, (std::vector<std::uint64_t>{ 0, 1, 2, 3 }));
+    EXPECT_TRUE(replayer.done());
+}
+
+TEST(RecordReplayTest, RecordsFramesByKind) {
+    using namespace lute::tm::channels;
+    InMemoryChannel channel(4096);
+    FramedWriter<InMemoryChannel> writer(channel);
+    FramedReader<InMemoryChannel> reader(channel);
+
+    const std::uint64_t value = 42;
+    writer.append(asBytes(value));
+    lute::tm::watermarks::append_watermark(writer, 9);
+    writer.flush();
+
+    Collected collected;
+    Recorder<ManualClock> recorder(collected.sink());
+    const FrameBatch batch = reader.fetch(8);
+    for (const Frame frame : batch) recorder.frame(1, frame);
+    recorder.flush();
+
+    ReplayDecoder decoder(collected.stream);
+    const auto record = decoder.next();
+    const auto watermark = decoder.next();
+    ASSERT_TRUE(record && watermark);
+    EXPECT_EQ(record->kind, EventKind::Record);
+    EXPECT_EQ(valueOf(record->payload), value);
+    EXPECT_EQ(watermark->kind, EventKind::Watermark);
+    EXPECT_EQ(watermark->value, 9u);
+    EXPECT_TRUE(decoder.done());
+}
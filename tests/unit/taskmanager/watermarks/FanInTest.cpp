@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+#include <watermarks/FanIn.h>
+#include <watermarks/Watermark.h>
+
+#include <channels/InMemoryChannel.h>
+#include <channels/RecordFraming.h>
+#include <gates/InputGate.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace lute::tm::watermarks;
+using namespace lute::tm::channels;
+using lute::tm::gates::InputGate;
+
+namespace {
+
+std::span<const std::byte> asBytes(const std::uint64_t& value) {
+    return { reinterpret_cast<const std::byte*>(&value), sizeof(value) };
+}
+
+std::uint64_t valueOf(const std::span<const std::byte> payload) {
+    std::uint64_t value;
+    std::memcpy(&value, payload.data(), sizeof(value));
+    return value;
+}
+
+/**
+ * One framed input: a channel and its writer
+ */
+struct Input {
+    Input() : channel(4096), writer(channel) {}
+
+    InMemoryChannel channel;
+    FramedWriter<InMemoryChannel> writer;
+};
+
+} // namespace
+
+// ============================================================================
+// Framing
+// ============================================================================
+
+TEST(WatermarkFramingTest, RoundTripsThroughChannel) {
+    InMemoryChannel channel(256);
+    FramedWriter writer(channel);
+    FramedReader reader(channel);
+
+    const std::uint64_t record = 42;
+    ASSERT_TRUE(writer.append(asBytes(record)));
+    ASSERT_TRUE(append_watermark(writer, 1234));
+    writer.flush();
+
+    const FrameBatch batch = reader.fetch();
+    ASSERT_EQ(batch.size(), 2u);
+
+    auto it = batch.begin();
+    EXPECT_FALSE(watermark_of(*it).has_value());
+    ++it;
+    EXPECT_EQ((*it).kind, FrameKind::Watermark);
+    EXPECT_EQ(watermark_of(*it), 1234u);
+}
+
+// ============================================================================
+// Batched Emission
+// ============================================================================
+
+TEST(WatermarkBatcherTest, CoalescesProgressUntilMinAdvance) {
+    WatermarkBatcher batcher(WatermarkPolicy{ .minAdvance = 10 });
+
+    for (EventTime t = 1; t < 10; ++t) batcher.advance(t);
+    EXPECT_FALSE(batcher.due());
+
+    batcher.advance(10);
+    EXPECT_TRUE(batcher.due());
+    EXPECT_EQ(batcher.take(), 10u);
+
+    batcher.advance(5);
+    EXPECT_EQ(batcher.pending(), 10u);
+    EXPECT_FALSE(batcher.due());
+
+    batcher.advance(END_OF_TIME);
+    EXPECT_TRUE(batcher.due());
+}
+
+TEST(WatermarkBatcherTest, SendsOneWatermarkPerPublishedBatch) {
+    InMemoryChannel channel(1 << 16);
+    FramedWriter writer(channel, BatchPolicy{ .maxRecords = SIZE_MAX, .maxBytes = SIZE_MAX, .maxDelay = {} });
+    FramedReader reader(channel);
+    WatermarkBatcher batcher;
+
+    // Three batches of 100 records, each record advancing the clock
+    for (std::uint64_t batch = 0; batch < 3; ++batch) {
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            const std::uint64_t t = batch * 100 + i;
+            ASSERT_TRUE(writer.append(asBytes(t)));
+            batcher.advance(t);
+        }
+        ASSERT_TRUE(batcher.flush_to(writer));
+        writer.flush();
+    }
+
+    std::vector<EventTime> watermarks;
+    std::size_t records = 0;
+    for (FrameBatch batch = reader.fetch(); !batch.empty(); batch = reader.fetch()) {
+        for (const Frame frame : batch) {
+            if (const auto watermark = watermark_of(frame)) {
+                watermarks.push_back(*watermark);
+            } else {
+                ++records;
+            }
+        }
+        reader.release(batch);
+    }
+
+    EXPECT_EQ(records, 300u);
+    EXPECT_EQ(watermarks, (std::vector<EventTime>{ 99, 199, 299 }));
+}
+
+TEST(BoundedLatenessTest, TrailsMaxEventTime) {
+    BoundedLateness source(10);
+
+    EXPECT_EQ(source.observe(5), NO_WATERMARK);
+    EXPECT_EQ(source.observe(30), 20u);
+    EXPECT_EQ(source.observe(25), 20u);
+}
+
+// ============================================================================
+// Fan-In
+// ============================================================================
+
+TEST(FramedFanInTest, ReportsCombinedWatermarkAfterPrecedingRecords) {
+    Input a;
+    Input b;
+    std::vector<InMemoryChannel*> channels{ &a.channel, &b.channel };
+    FramedFanIn<InMemoryChannel> fanIn(channels);
+
+    std::vector<std::pair<std::size_t, std::uint64_t>> seen;
+    std::vector<EventTime> reported;
+    std::size_t recordsAtReport = 0;
+
+    const auto onRecord = [&](const std::size_t input, const std::span<const std::byte> payload) {
+        seen.emplace_back(input, valueOf(payload));
+        return true;
+    };
+    const auto onWatermark = [&](const EventTime watermark) {
+        reported.push_back(watermark);
+        recordsAtReport = seen.size();
+    };
+
+    const std::uint64_t one = 1;
+    const std::uint64_t two = 2;
+
+    a.writer.append(asBytes(one));
+    append_watermark(a.writer, 100);
+    a.writer.flush();
+
+    EXPECT_EQ(fanIn.poll(onRecord, onWatermark), 2u);
+    EXPECT_TRUE(reported.empty());                      // b has not said anything yet
+    EXPECT_EQ(fanIn.merger().laggard(), 1u);
+
+    b.writer.append(asBytes(two));
+    append_watermark(b.writer, 50);
+    append_watermark(b.writer, 80);                     // coalesced with 50 within the round
+    b.writer.flush();
+
+    EXPECT_EQ(fanIn.poll(onRecord, onWatermark), 3u);
+    EXPECT_EQ(reported, (std::vector<EventTime>{ 80 }));
+    EXPECT_EQ(recordsAtReport, 2u);
+
+    append_watermark(b.writer, END_OF_TIME);
+    b.writer.flush();
+    fanIn.poll(onRecord, onWatermark);
+    EXPECT_EQ(reported.back(), 100u);
+    EXPECT_EQ(fanIn.watermark(), 100u);
+}
+
+TEST(FramedFanInTest, StoppedRecordKeepsLaterWatermarkQueued) {
+    Input a;
+    std::vector<InMemoryChannel*> channels{ &a.channel };
+    FramedFanIn<InMemoryChannel> fanIn(channels);
+
+    const std::uint64_t one = 1;
+    a.writer.append(asBytes(one));
+    append_watermark(a.writer, 10);
+    a.writer.flush();
+
+    std::vector<EventTime> reported;
+    const auto onWatermark = [&](const EventTime watermark) { reported.push_back(watermark); };
+
+    EXPECT_EQ(fanIn.poll([](std::size_t, std::span<const std::byte>) { return false; }, onWatermark), 0u);
+    EXPECT_TRUE(reported.empty());
+
+    EXPECT_EQ(fanIn.poll([](std::size_t, std::span<const std::byte>) { return true; }, onWatermark), 2u);
+    EXPECT_EQ(reported, (std::vector<EventTime>{ 10 }));
+}
+
+TEST(GateFanInTest, MergesWatermarkElementsAcrossGates) {
+    using Gate = InputGate<Element<std::uint64_t>>;
+
+    std::vector<std::unique_ptr<Gate>> gates;
+    std::vector<Gate*> inputs;
+    for (int i = 0; i < 4; ++i) {
+        gates.push_back(std::make_unique<Gate>(64));
+        inputs.push_back(gates.back().get());
+    }
+    GateFanIn<Gate> fanIn(inputs);
+
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        const EventTime base = 10 * (i + 1);
+        ASSERT_TRUE(inputs[i]->emplace(Element<std::uint64_t>::record(base, i)));
+        ASSERT_TRUE(inputs[i]->emplace(Element<std::uint64_t>::watermark(base)));
+    }
+
+    std::uint64_t recordSum = 0;
+    std::vector<EventTime> reported;
+    const auto onRecord = [&](std::size_t, EventTime, const std::uint64_t& value) {
+        recordSum += value;
+        return true;
+    };
+    const auto onWatermark = [&](const EventTime watermark) { reported.push_back(watermark); };
+
+    EXPECT_EQ(fanIn.poll(onRecord, onWatermark), 8u);
+    EXPECT_EQ(recordSum, 0u + 1 + 2 + 3);
+    EXPECT_EQ(reported, (std::vector<EventTime>{ 10 }));
+
+    ASSERT_TRUE(inputs[0]->emplace(Element<std::uint64_t>::watermark(35)));
+    fanIn.poll(onRecord, onWatermark);
+    EXPECT_EQ(reported.back(), 20u);
+    EXPECT_EQ(fanIn.merger().laggard(), 1u);
+
+    for (Gate* gate : inputs) EXPECT_EQ(gate->pending(), 0u);
+}
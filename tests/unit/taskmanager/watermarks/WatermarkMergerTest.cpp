@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <watermarks/WatermarkMerger.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace lute::tm::watermarks;
+
+namespace {
+
+EventTime naiveMin(const std::vector<EventTime>& watermarks) {
+    return *std::min_element(watermarks.begin(), watermarks.end());
+}
+
+} // namespace
+
+// ============================================================================
+// Basic Semantics
+// ============================================================================
+
+TEST(WatermarkMergerTest, StartsAtNoWatermark) {
+    const WatermarkMerger merger(5);
+
+    EXPECT_EQ(merger.current(), NO_WATERMARK);
+    EXPECT_EQ(merger.inputs(), 5u);
+}
+
+TEST(WatermarkMergerTest, AdvancesOnlyWhenSlowestInputMoves) {
+    WatermarkMerger merger(3);
+
+    EXPECT_FALSE(merger.update(0, 10));
+    EXPECT_FALSE(merger.update(1, 20));
+    EXPECT_TRUE(merger.update(2, 5));
+    EXPECT_EQ(merger.current(), 5u);
+    EXPECT_EQ(merger.laggard(), 2u);
+
+    EXPECT_TRUE(merger.update(2, 30));
+    EXPECT_EQ(merger.current(), 10u);
+    EXPECT_EQ(merger.laggard(), 0u);
+}
+
+TEST(WatermarkMergerTest, IgnoresRegressions) {
+    WatermarkMerger merger(2);
+
+    merger.update(0, 50);
+    merger.update(1, 40);
+    EXPECT_FALSE(merger.update(1, 30));
+
+    EXPECT_EQ(merger.watermark(1), 40u);
+    EXPECT_EQ(merger.current(), 40u);
+}
+
+TEST(WatermarkMergerTest, ClosedInputsStopHoldingBack) {
+    WatermarkMerger merger(3);
+
+    merger.update(0, 7);
+    merger.update(1, 9);
+    merger.close(2);
+    EXPECT_TRUE(merger.settle());
+    EXPECT_EQ(merger.current(), 7u);
+
+    merger.close(0);
+    merger.close(1);
+    EXPECT_TRUE(merger.settle());
+    EXPECT_EQ(merger.current(), END_OF_TIME);
+}
+
+TEST(WatermarkMergerTest, SingleInputPassesThrough) {
+    WatermarkMerger merger(1);
+
+    EXPECT_TRUE(merger.update(0, 3));
+    EXPECT_EQ(merger.current(), 3u);
+}
+
+// ============================================================================
+// Batched Settling
+// ============================================================================
+
+TEST(WatermarkMergerTest, ObserveDefersUntilSettle) {
+    WatermarkMerger merger(4);
+
+    for (std::size_t input = 0; input < 4; ++input) {
+        for (EventTime t = 1; t <= 10; ++t) merger.observe(input, t * (input + 1));
+    }
+    EXPECT_EQ(merger.current(), NO_WATERMARK);
+
+    EXPECT_TRUE(merger.settle());
+    EXPECT_EQ(merger.current(), 10u);
+    EXPECT_FALSE(merger.settle());
+}
+
+/**
+ * A holder that rose is replayed before the input below it: the input's replay must still carry its
+ * subtree's new winner (input 1) up instead of stopping at the node the holder kept
+ */
+TEST(WatermarkMergerTest, SeveralRisingInputsInSiblingSubtrees) {
+    WatermarkMerger merger(16);
+    const std::vector<EventTime> initial{ 1, 5, 2, 10 };
+    for (std::size_t input = 0; input < 16; ++input) merger.observe(input, input < initial.size() ? initial[input] : 100);
+    merger.settle();
+    ASSERT_EQ(merger.current(), 1u);
+
+    merger.observe(2, 7);
+    merger.observe(0, 8);
+    EXPECT_TRUE(merger.settle());
+    EXPECT_EQ(merger.current(), 5u);
+    EXPECT_EQ(merger.laggard(), 1u);
+}
+
+/**
+ * Two to five nearby inputs rising per settle, so the per-input replay always runs with several risen inputs in
+ * sibling subtrees at once
+ */
+TEST(WatermarkMergerTest, ReplaysOfNearbyRisingInputsMatchLinearScan) {
+    std::mt19937_64 rng(23);
+
+    for (const std::size_t inputs : {16u, 64u, 257u}) {
+        WatermarkMerger merger(inputs);
+        std::vector<EventTime> reference(inputs, NO_WATERMARK);
+
+        for (int round = 0; round < 2000; ++round) {
+            const std::size_t updates = 2 + rng() % 4;
+
+            for (std::size_t i = 0; i < updates; ++i) {
+                // The laggard and its neighbours, so risen inputs often held nodes their siblings now win
+                const std::size_t input = i == 0 ? merger.laggard() : (merger.laggard() + rng() % 8) % inputs;
+                const EventTime watermark = reference[input] + rng() % 50;
+                merger.observe(input, watermark);
+                reference[input] = std::max(reference[input], watermark);
+            }
+
+            merger.settle();
+            ASSERT_EQ(merger.current(), naiveMin(reference)) << inputs << " inputs, round " << round;
+            ASSERT_EQ(merger.watermark(merger.laggard()), merger.current());
+        }
+    }
+}
+
+/**
+ * Random rising watermarks on random subsets of inputs, settled in batches of varying size so both the
+ * per-input replay and the full rebuild run; the tree must agree with a linear scan after every settle
+ */
+TEST(WatermarkMergerTest, MatchesLinearScanUnderRandomUpdates) {
+    std::mt19937_64 rng(11);
+
+    for (const std::size_t inputs : {1u, 2u, 3u, 5u, 8u, 33u, 100u, 257u}) {
+        WatermarkMerger merger(inputs);
+        std::vector<EventTime> reference(inputs, NO_WATERMARK);
+
+        for (int round = 0; round < 400; ++round) {
+            const std::size_t updates = 1 + rng() % (round % 3 == 0 ? inputs : 2);
+
+            for (std::size_t i = 0; i < updates; ++i) {
+                const std::size_t input = rng() % inputs;
+                const EventTime watermark = reference[input] + rng() % 5;     // repeats and stalls included
+                merger.observe(input, watermark);
+                reference[input] = std::max(reference[input], watermark);
+            }
+
+            const EventTime before = merger.current();
+            const bool advanced = merger.settle();
+
+            ASSERT_EQ(merger.current(), naiveMin(reference)) << inputs << " inputs, round " << round;
+            ASSERT_EQ(advanced, merger.current() > before);
+            ASSERT_EQ(merger.watermark(merger.laggard()), merger.current());
+        }
+    }
+}
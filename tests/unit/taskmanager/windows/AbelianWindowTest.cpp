@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include <windows/AbelianWindow.h>
+#include <windows/MonoidWindow.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace lute::tm::windows;
+
+namespace {
+
+using SumCount = AbelianWindow<Sum<std::int64_t>, Count<std::int64_t>>;
+using Results = SumCount::Results;
+
+/**
+ * Keeps every accepted value and recomputes the window from scratch: the window ends with the newest
+ * pane seen and spans range / slide panes; a value for a pane that already left is late
+ */
+class NaiveWindow {
+public:
+    NaiveWindow(const std::uint64_t range, const std::uint64_t slide) : panes_(range / slide), slide_(slide) {}
+
+    bool insert(const std::uint64_t timestamp, const std::int64_t value) {
+        const std::uint64_t pane = timestamp / slide_;
+        if (started_ && pane + panes_ <= head_) return false;
+
+        head_ = started_ ? std::max(head_, pane) : pane;
+        started_ = true;
+        values_.emplace_back(pane, value);
+        return true;
+    }
+
+    Results results() const {
+        std::int64_t sum = 0;
+        std::uint64_t count = 0;
+        for (const auto& [pane, value] : values_) {
+            if (pane + panes_ <= head_) continue;
+            sum += value;
+            ++count;
+        }
+        return { sum, count };
+    }
+
+private:
+    const std::uint64_t panes_;
+    const std::uint64_t slide_;
+    std::uint64_t head_ = 0;
+    bool started_ = false;
+    std::vector<std::pair<std::uint64_t, std::int64_t>> values_;
+};
+
+/**
+ * Feeds \p timestamps to the window and the naive reference one by one, comparing after every value
+ */
+void expectMatchesNaive(const std::vector<std::uint64_t>& timestamps, const std::uint64_t range, const std::uint64_t slide) {
+    SumCount window(range, slide);
+    NaiveWindow reference(range, slide);
+    std::uint64_t late = 0;
+
+    for (std::size_t i = 0; i < timestamps.size(); ++i) {
+        const auto value = static_cast<std::int64_t>(timestamps[i] % 1000) - 500;
+        const bool accepted = reference.insert(timestamps[i], value);
+        if (!accepted) ++late;
+
+        ASSERT_EQ(window.insert(timestamps[i], value), accepted) << "value " << i;
+        ASSERT_EQ(window.results(), reference.results()) << "value " << i;
+    }
+
+    EXPECT_EQ(window.late(), late);
+}
+
+} // namespace
+
+// ============================================================================
+// Basic Semantics
+// ============================================================================
+
+TEST(AbelianWindowTest, SlidesByPanes) {
+    SumCount window(30, 10);
+
+    window.insert(5, 1);        // pane 0
+    window.insert(15, 2);       // pane 1
+    window.insert(25, 4);       // pane 2
+    EXPECT_EQ(window.results(), Results(7, 3));
+    EXPECT_EQ(window.end(), 30u);
+
+    window.insert(35, 8);       // pane 3, pane 0 leaves
+    EXPECT_EQ(window.results(), Results(14, 3));
+
+    window.advance(59);         // head pane 5: only pane 3 is left
+    EXPECT_EQ(window.results(), Results(8, 1));
+}
+
+TEST(AbelianWindowTest, LateValuesAreDroppedAndCounted) {
+    SumCount window(20, 10);
+
+    window.insert(100, 1);
+    EXPECT_TRUE(window.insert(90, 2));      // previous pane, still inside
+    EXPECT_FALSE(window.insert(89, 4));     // two panes back
+    EXPECT_FALSE(window.insert(0, 8));
+
+    EXPECT_EQ(window.results(), Results(3, 2));
+    EXPECT_EQ(window.late(), 2u);
+}
+
+TEST(AbelianWindowTest, FarFutureJumpEmptiesWindow) {
+    SumCount window(16, 4);
+
+    for (std::uint64_t t = 0; t < 16; ++t) window.insert(t, 1);
+    EXPECT_EQ(window.results(), Results(16, 16));
+
+    window.insert(1'000'000, 5);
+    EXPECT_EQ(window.results(), Results(5, 1));
+
+    window.insert(1'000'000 - 12, 7);       // three panes back, still inside
+    EXPECT_EQ(window.results(), Results(12, 2));
+}
+
+// ============================================================================
+// Adversarial Reordering
+// ============================================================================
+
+TEST(AbelianWindowTest, ReversedInputMatchesNaive) {
+    std::vector<std::uint64_t> timestamps(500);
+    std::iota(timestamps.rbegin(), timestamps.rend(), 0);
+
+    expectMatchesNaive(timestamps, 64, 1);
+    expectMatchesNaive(timestamps, 60, 6);
+}
+
+TEST(AbelianWindowTest, BoundedDisorderMatchesNaive) {
+    std::mt19937_64 rng(1234);
+
+    for (const std::uint64_t disorder : {1u, 7u, 64u, 300u}) {
+        std::vector<std::uint64_t> timestamps(2000);
+        std::iota(timestamps.begin(), timestamps.end(), 0);
+
+        // Shuffle within blocks of `disorder` values: every value arrives at most that far from its place
+        for (std::size_t begin = 0; begin < timestamps.size(); begin += disorder) {
+            const std::size_t end = std::min(timestamps.size(), begin + disorder);
+            std::shuffle(timestamps.begin() + static_cast<std::ptrdiff_t>(begin),
+                         timestamps.begin() + static_cast<std::ptrdiff_t>(end), rng);
+        }
+
+        expectMatchesNaive(timestamps, 100, 1);
+        expectMatchesNaive(timestamps, 100, 20);
+    }
+}
+
+/**
+ * Values on both sides of every pane edge, in alternating old/new order with exact-edge late values mixed in,
+ * plus bursts far ahead that force multi-pane evictions across the ring wrap
+ */
+TEST(AbelianWindowTest, PaneEdgesAndJumpsMatchNaive) {
+    constexpr std::uint64_t SLIDE = 8;
+    constexpr std::uint64_t RANGE = 5 * SLIDE;      // 5 panes in a ring of 8 slots
+
+    std::vector<std::uint64_t> timestamps;
+    for (std::uint64_t edge = SLIDE; edge < 400; edge += SLIDE) {
+        timestamps.push_back(edge);
+        timestamps.push_back(edge - 1);
+        timestamps.push_back(edge >= RANGE ? edge - RANGE : 0);
+        timestamps.push_back(edge >= RANGE - SLIDE ? edge - (RANGE - SLIDE) : 0);
+        if (edge % (7 * SLIDE) == 0) timestamps.push_back(edge + 3 * SLIDE + 1);
+    }
+
+    expectMatchesNaive(timestamps, RANGE, SLIDE);
+}
+
+TEST(AbelianWindowTest, RandomTimestampsMatchNaive) {
+    std::mt19937_64 rng(99);
+    std::vector<std::uint64_t> timestamps(3000);
+
+    std::uint64_t clock = 0;
+    for (std::uint64_t& t : timestamps) {
+        clock += rng() % 4;
+        const std::uint64_t lag = rng() % 120;
+        t = clock > lag ? clock - lag : 0;
+    }
+
+    expectMatchesNaive(timestamps, 96, 1);
+    expectMatchesNaive(timestamps, 96, 12);
+    expectMatchesNaive(timestamps, 96, 96);
+}
+
+// ============================================================================
+// Batches
+// ============================================================================
+
+TEST(AbelianWindowTest, BatchInsertMatchesSingleInserts) {
+    std::mt19937_64 rng(5);
+    std::vector<std::uint64_t> timestamps(4096);
+    std::vector<std::int64_t> values(timestamps.size());
+
+    std::uint64_t clock = 0;
+    for (std::size_t i = 0; i < timestamps.size(); ++i) {
+        clock += rng() % 3;
+        timestamps[i] = clock - std::min<std::uint64_t>(clock, rng() % 8 == 0 ? rng() % 50 : 0);
+        values[i] = static_cast<std::int64_t>(rng() % 100);
+    }
+
+    SumCount single(64, 8);
+    SumCount batched(64, 8);
+
+    for (std::size_t begin = 0; begin < timestamps.size(); begin += 37) {
+        const std::size_t count = std::min<std::size_t>(37, timestamps.size() - begin);
+
+        std::size_t accepted = 0;
+        for (std::size_t i = begin; i < begin + count; ++i) {
+            if (single.insert(timestamps[i], values[i])) ++accepted;
+        }
+
+        ASSERT_EQ(batched.insert_batch(timestamps.data() + begin, values.data() + begin, count), accepted);
+        ASSERT_EQ(batched.results(), single.results());
+    }
+
+    EXPECT_EQ(batched.late(), single.late());
+}
+
+TEST(AbelianWindowTest, AgreesWithMonoidWindowOnOrderedInput) {
+    std::mt19937_64 rng(17);
+    constexpr std::uint64_t RANGE = 50;
+
+    SumCount group(RANGE);
+    MonoidWindow<Sum<std::int64_t>, Count<std::int64_t>> monoid(1024, RANGE);
+
+    std::uint64_t t = 0;
+    for (int i = 0; i < 2000; ++i) {
+        t += rng() % 3;
+        const auto value = static_cast<std::int64_t>(rng() % 1000);
+
+        group.insert(t, value);
+        monoid.insert(t, value);
+        ASSERT_EQ(group.results(), monoid.results()) << "t " << t;
+    }
+}
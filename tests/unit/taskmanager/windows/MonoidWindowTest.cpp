@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+#include <windows/MonoidWindow.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <tuple>
+#include <utility>
+
+using namespace lute::tm::windows;
+
+namespace {
+
+/**
+ * Decimal concatenation modulo a prime: associative but not commutative, so any reordering of the
+ * window's values changes the result
+ */
+struct Concat {
+    static constexpr std::uint64_t MOD = 1'000'000'007;
+
+    struct Partial {
+        std::uint64_t value;
+        std::uint64_t scale;
+    };
+
+    using input_type = std::int64_t;
+    using partial_type = Partial;
+    using result_type = std::uint64_t;
+
+    static Partial identity() { return { 0, 1 }; }
+    static Partial lift(const std::int64_t digit) { return { static_cast<std::uint64_t>(digit) % 10, 10 }; }
+    static Partial combine(const Partial& a, const Partial& b) {
+        return { (a.value * b.scale + b.value) % MOD, (a.scale * b.scale) % MOD };
+    }
+    static std::uint64_t lower(const Partial& a) { return a.value; }
+};
+
+/**
+ * Max that counts its combines, to observe the per-operation cost
+ */
+struct CountingMax : Max<std::int64_t> {
+    static inline std::uint64_t combines = 0;
+
+    static std::int64_t combine(const std::int64_t a, const std::int64_t b) {
+        ++combines;
+        return Max<std::int64_t>::combine(a, b);
+    }
+};
+
+using Stats = MonoidWindow<Sum<std::int64_t>, Count<std::int64_t>, Min<std::int64_t>, Max<std::int64_t>, Concat>;
+
+/**
+ * Recomputes every aggregate from scratch
+ */
+Stats::Results naive(const std::deque<std::int64_t>& values) {
+    Stats::Partials acc = Stats::Columns::identity();
+    for (const std::int64_t value : values) acc = Stats::Columns::combine(acc, Stats::Columns::lift(value));
+    return Stats::Columns::lower(acc);
+}
+
+} // namespace
+
+static_assert(Monoid<Concat>);
+static_assert(!AbelianGroup<Concat>);
+static_assert(!AbelianGroup<Max<int>>);
+static_assert(AbelianGroup<Sum<int>> && AbelianGroup<Count<int>>);
+
+// ============================================================================
+// Basic Semantics
+// ============================================================================
+
+TEST(MonoidWindowTest, EmptyWindowQueriesIdentity) {
+    const Stats window(8);
+
+    EXPECT_TRUE(window.empty());
+    EXPECT_EQ(window.results(), Stats::Columns::lower(Stats::Columns::identity()));
+}
+
+TEST(MonoidWindowTest, CapacityEvictsOldest) {
+    Stats window(3);
+
+    for (std::int64_t i = 1; i <= 5; ++i) window.insert(static_cast<std::uint64_t>(i), i);
+
+    EXPECT_EQ(window.size(), 3u);
+    EXPECT_EQ(window.oldest(), 3u);
+    EXPECT_EQ(window.results(), naive({3, 4, 5}));
+}
+
+TEST(MonoidWindowTest, TimeRangeEvictsOnInsertAndAdvance) {
+    Stats window(64, 10);
+
+    window.insert(0, 1);
+    window.insert(5, 2);
+    window.insert(9, 3);
+    EXPECT_EQ(window.size(), 3u);
+
+    window.insert(10, 4);       // (0, 10]
+    EXPECT_EQ(window.results(), naive({2, 3, 4}));
+
+    window.advance(19);         // (9, 19]
+    EXPECT_EQ(window.results(), naive({4}));
+
+    window.advance(100);
+    EXPECT_TRUE(window.empty());
+}
+
+TEST(MonoidWindowTest, EqualTimestampsAreKept) {
+    Stats window(64, 1);
+
+    window.insert(7, 1);
+    window.insert(7, 2);
+    window.insert(7, 3);
+    EXPECT_EQ(window.results(), naive({1, 2, 3}));
+
+    window.insert(8, 4);
+    EXPECT_EQ(window.results(), naive({4}));
+}
+
+// ============================================================================
+// Naive Recomputation Equivalence
+// ============================================================================
+
+/**
+ * Random interleavings of inserts and evicts, checked against a from-scratch recomputation after every step.
+ * The mix is biased per phase so the window repeatedly grows, drains to empty and oscillates around
+ * every size, which exercises rebuilds starting at every front/back split.
+ */
+TEST(MonoidWindowTest, MatchesNaiveRecomputationUnderRandomInterleavings) {
+    std::mt19937_64 rng(42);
+    constexpr std::size_t CAPACITY = 50;
+
+    Stats window(CAPACITY);
+    std::deque<std::int64_t> reference;
+    std::uint64_t now = 0;
+
+    for (int phase = 0; phase < 60; ++phase) {
+        std::bernoulli_distribution grow(static_cast<double>(phase % 5) / 4.0);
+
+        for (int op = 0; op < 200; ++op) {
+            if (reference.empty() || grow(rng)) {
+                const auto value = static_cast<std::int64_t>(rng() % 2001) - 1000;
+                window.insert(++now, value);
+                reference.push_back(value);
+                if (reference.size() > CAPACITY) reference.pop_front();
+            } else {
+                window.evict();
+                reference.pop_front();
+            }
+
+            ASSERT_EQ(window.size(), reference.size());
+            ASSERT_EQ(window.results(), naive(reference)) << "phase " << phase << " op " << op;
+        }
+    }
+}
+
+TEST(MonoidWindowTest, MatchesNaiveRecomputationForEveryCapacity) {
+    std::mt19937_64 rng(7);
+
+    for (std::size_t capacity = 1; capacity <= 33; ++capacity) {
+        Stats window(capacity);
+        std::deque<std::int64_t> reference;
+
+        for (std::uint64_t t = 0; t < 4 * capacity + 16; ++t) {
+            const auto value = static_cast<std::int64_t>(rng() % 10);
+            window.insert(t, value);
+            reference.push_back(value);
+            if (reference.size() > capacity) reference.pop_front();
+
+            ASSERT_EQ(window.results(), naive(reference)) << "capacity " << capacity << " t " << t;
+        }
+    }
+}
+
+// ============================================================================
+// Worst-Case Cost
+// ============================================================================
+
+/**
+ * Patterns that make plain two-stacks flip a full back stack in one operation: fill, then drain; and a full
+ * window sliding by one. No single operation may exceed a constant number of combines.
+ */
+TEST(MonoidWindowTest, CombinesPerOperationAreBounded) {
+    constexpr std::size_t CAPACITY = 4096;
+    constexpr std::uint64_t INSERT_BOUND = 1 + MonoidWindow<CountingMax>::STEPS_PER_OPERATION;
+    constexpr std::uint64_t EVICT_BOUND = MonoidWindow<CountingMax>::STEPS_PER_OPERATION;
+
+    MonoidWindow<CountingMax> window(CAPACITY);
+    std::deque<std::int64_t> reference;
+    std::uint64_t now = 0;
+    std::uint64_t worstInsert = 0;
+    std::uint64_t worstEvict = 0;
+
+    const auto insert = [&](const std::int64_t value) {
+        CountingMax::combines = 0;
+        window.insert(++now, value);
+        worstInsert = std::max(worstInsert, CountingMax::combines);
+        reference.push_back(value);
+    };
+    const auto evict = [&]() {
+        CountingMax::combines = 0;
+        window.evict();
+        worstEvict = std::max(worstEvict, CountingMax::combines);
+        reference.pop_front();
+    };
+
+    for (int round = 0; round < 3; ++round) {
+        for (std::size_t i = 0; i < CAPACITY; ++i) insert(static_cast<std::int64_t>(CAPACITY - i));
+        while (reference.size() > 1) evict();
+        ASSERT_EQ(std::get<0>(window.results()), reference.front());
+        evict();
+    }
+
+    for (std::size_t i = 0; i < CAPACITY; ++i) insert(static_cast<std::int64_t>(i));
+    for (std::size_t i = 0; i < 4 * CAPACITY; ++i) {
+        evict();
+        insert(static_cast<std::int64_t>(i % 97));
+        ASSERT_EQ(std::get<0>(window.results()), *std::max_element(reference.begin(), reference.end()));
+    }
+
+    EXPECT_LE(worstInsert, INSERT_BOUND);
+    EXPECT_LE(worstEvict, EVICT_BOUND);
+}
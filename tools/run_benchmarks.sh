@@ -0,0 +1,102 @@
+#!/usr/bin/env bash
+#
+# Builds the benchmarks in Release and runs them, writing one Google Benchmark JSON file per executable.
+#
+#   tools/run_benchmarks.sh [--build-dir DIR] [--out DIR] [--bench NAME]... [--filter REGEX]
+#                           [--repetitions N] [--min-time SECONDS] [--cpus CONSUMER,PRODUCER]
+#
+# Results land in bench-results/<git-sha>[-dirty]/ unless --out is given. Every file carries the commit,
+# the CPU governor and the pinned CPUs in its "context" block, so a before/after pair can be diffed with
+# Google Benchmark's compare.py:
+#
+#   compare.py benchmarks bench-results/<before>/SpscChannelBench.json bench-results/<after>/SpscChannelBench.json
+#
+# Extra CMake arguments can be passed through the CMAKE_ARGS environment variable.
+
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+
+BUILD_DIR="${ROOT}/_bench_build"
+OUT_DIR=""
+FILTER=""
+REPETITIONS=5
+MIN_TIME=0.5
+CPUS=""
+BENCHES=()
+
+usage() {
+    sed -n '3,14p' "${BASH_SOURCE[0]}" | sed 's/^# \{0,1\}//'
+    exit "${1:-0}"
+}
+
+while [[ $# -gt 0 ]]; do
+    case "$1" in
+        --build-dir)   BUILD_DIR="$2"; shift 2 ;;
+        --out)         OUT_DIR="$2"; shift 2 ;;
+        --bench)       BENCHES+=("$2"); shift 2 ;;
+        --filter)      FILTER="$2"; shift 2 ;;
+        --repetitions) REPETITIONS="$2"; shift 2 ;;
+        --min-time)    MIN_TIME="$2"; shift 2 ;;
+        --cpus)        CPUS="$2"; shift 2 ;;
+        -h|--help)     usage 0 ;;
+        *)             echo "unknown argument: $1" >&2; usage 1 ;;
+    esac
+done
+
+SHA="$(git -C "${ROOT}" rev-parse --short HEAD 2>/dev/null || echo unknown)"
+if ! git -C "${ROOT}" diff --quiet HEAD 2>/dev/null; then
+    SHA="${SHA}-dirty"
+fi
+OUT_DIR="${OUT_DIR:-${ROOT}/bench-results/${SHA}}"
+
+# ---- Build ----
+# shellcheck disable=SC2086
+cmake -S "${ROOT}" -B "${BUILD_DIR}" \
+    -DCMAKE_BUILD_TYPE=Release \
+    -DENABLE_BENCHMARKS=ON \
+    -DENABLE_TRACING=OFF \
+    -DENABLE_SANITIZERS=OFF \
+    ${CMAKE_ARGS:-} >/dev/null
+cmake --build "${BUILD_DIR}" -j"$(nproc)" >/dev/null
+
+if [[ ${#BENCHES[@]} -eq 0 ]]; then
+    while IFS= read -r source; do
+        BENCHES+=("$(basename "${source}" .cpp)")
+    done < <(sed -n 's/^ *\([A-Za-z/]*Bench\.cpp\)$/\1/p' "${ROOT}/benchmarks/CMakeLists.txt")
+fi
+
+# ---- Environment ----
+if [[ -n "${CPUS}" ]]; then
+    export LUTE_BENCH_CPUS="${CPUS}"
+fi
+
+GOVERNOR_FILE=/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor
+GOVERNOR="$(cat "${GOVERNOR_FILE}" 2>/dev/null || echo unknown)"
+if [[ "${GOVERNOR}" != "performance" && "${GOVERNOR}" != "unknown" ]]; then
+    echo "warning: cpu0 frequency governor is '${GOVERNOR}'; numbers will be noisy" >&2
+fi
+
+CONTEXT="git_sha=${SHA},governor=${GOVERNOR},bench_cpus=${LUTE_BENCH_CPUS:-auto}"
+
+# ---- Run ----
+mkdir -p "${OUT_DIR}"
+for bench in "${BENCHES[@]}"; do
+    binary="${BUILD_DIR}/benchmarks/${bench}"
+    if [[ ! -x "${binary}" ]]; then
+        echo "no such benchmark: ${bench}" >&2
+        exit 1
+    fi
+
+    echo "==> ${bench}"
+    "${binary}" \
+        --benchmark_out="${OUT_DIR}/${bench}.json" \
+        --benchmark_out_format=json \
+        --benchmark_repetitions="${REPETITIONS}" \
+        --benchmark_report_aggregates_only=true \
+        --benchmark_min_time="${MIN_TIME}" \
+        --benchmark_context="${CONTEXT}" \
+        ${FILTER:+--benchmark_filter="${FILTER}"}
+done
+
+echo "results: ${OUT_DIR}"